@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Build and run the brunel, synth and vogels benchmark models across a sweep
+of network sizes, writing the results to a JSON and a CSV file and optionally
+comparing them against the JSON results of a previous (baseline) run.
+
+Each model is built with genn-buildmodel.sh for the selected backend at each
+size by rewriting its inputs.h (which is restored afterwards). The simulator
+prints its setup and simulation times and the per-phase timing counters as a
+JSON object (see benchmark.h) and peak resident set size is measured here.
+
+Usage example:
+    python3 bench/bench.py --backend multi_threaded_cpu --models vogels \\
+        --nsyn 250000000,500000000 --baseline bench_results_4.4.0.json
+"""
+import argparse
+import csv
+import datetime
+import json
+import os
+import platform
+import subprocess
+import sys
+import time
+
+GENN_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Default sweeps of synapse counts (as used by the original per-model bench.sh scripts)
+# **NOTE** defines are written to each model's inputs.h alongside its size
+MODELS = {
+    "brunel": {"dir": "brunel", "defines": [],
+               "nsyn": range(500000000, 10000000001, 500000000)},
+    "brunel+": {"dir": "brunel", "defines": ["STDP"],
+                "nsyn": range(100000000, 2000000001, 100000000)},
+    "synth": {"dir": "synth", "defines": [],
+              "nsyn": range(250000000, 3000000001, 250000000)},
+    "synth-sparse": {"dir": "synth", "defines": ["SPARSE"],
+                     "nsyn": range(250000000, 3000000001, 250000000)},
+    "synth-delta": {"dir": "synth", "defines": ["SPARSE", "DELTA_SPARSE_IND"],
+                    "nsyn": range(250000000, 3000000001, 250000000)},
+    "vogels": {"dir": "vogels", "defines": [],
+               "nsyn": range(250000000, 3000000001, 250000000)},
+}
+
+# genn-buildmodel.sh flags used to select each backend
+BACKENDS = {
+    "cuda": [],
+    "opencl": ["-l"],
+    "single_threaded_cpu": ["-c"],
+    "multi_threaded_cpu": ["-p"],
+}
+
+# Columns written to CSV file
+CSV_FIELDS = ["benchmark", "backend", "nsyn", "#syn", "timesteps", "buildtime",
+              "setuptime", "cached", "simtime", "initTime", "initSparseTime",
+              "neuronUpdateTime", "presynapticUpdateTime",
+              "postsynapticUpdateTime", "synapseDynamicsTime", "peak_rss_mb",
+              "baseline_simtime", "simtime_ratio", "regression", "error"]
+
+
+def write_inputs(path, nsyn, defines):
+    with open(path, "w") as inputs:
+        inputs.write("#pragma once\n")
+        for d in defines:
+            inputs.write("#define %s\n" % d)
+        inputs.write("double const NSYN = %d;\n" % nsyn)
+
+
+def run_simulator(command, cwd, env):
+    """Run simulator, returning its stdout and peak RSS in MiB (None if unavailable)"""
+    process = subprocess.Popen(command, cwd=cwd, env=env, stdout=subprocess.PIPE,
+                               universal_newlines=True)
+    stdout = process.stdout.read()
+    process.stdout.close()
+
+    # Use wait4 where available to get resource usage of this child alone
+    if hasattr(os, "wait4"):
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+
+        # **NOTE** ru_maxrss is in bytes on macOS and kilobytes elsewhere
+        scale = 1024.0 * 1024.0 if sys.platform == "darwin" else 1024.0
+        peak_rss = usage.ru_maxrss / scale
+    else:
+        process.wait()
+        peak_rss = None
+
+    if process.returncode != 0:
+        raise RuntimeError("simulator exited with status %d" % process.returncode)
+    return stdout, peak_rss
+
+
+def run_benchmark(name, nsyn, backend, env):
+    model = MODELS[name]
+    model_dir = os.path.join(GENN_DIR, model["dir"])
+    result = {"benchmark": name, "backend": backend, "nsyn": nsyn}
+
+    # Generate and build model code for this size
+    write_inputs(os.path.join(model_dir, "inputs.h"), nsyn, model["defines"])
+    build_start = time.time()
+    subprocess.check_call(["genn-buildmodel.sh"] + BACKENDS[backend] + ["model.cc"],
+                          cwd=model_dir, env=env, stdout=subprocess.DEVNULL)
+    subprocess.check_call(["make", "-B"], cwd=model_dir, env=env,
+                          stdout=subprocess.DEVNULL)
+    result["buildtime"] = time.time() - build_start
+
+    # Run simulator and add its output to result
+    stdout, peak_rss = run_simulator([os.path.join(".", model["dir"])], model_dir, env)
+    result.update(json.loads(stdout))
+    result["peak_rss_mb"] = peak_rss
+    return result
+
+
+def compare_baseline(results, baseline_path, tolerance):
+    """Annotate results with the simulation time ratio to matching baseline
+    results, returning the number which regressed by more than tolerance"""
+    with open(baseline_path, "r") as baseline_file:
+        baseline = json.load(baseline_file)
+
+    baseline_times = {(r["benchmark"], r["nsyn"]): r["simtime"]
+                      for r in baseline["results"] if "simtime" in r}
+
+    num_regressions = 0
+    for r in results:
+        key = (r["benchmark"], r["nsyn"])
+        if "simtime" not in r or key not in baseline_times:
+            continue
+
+        r["baseline_simtime"] = baseline_times[key]
+        r["simtime_ratio"] = r["simtime"] / baseline_times[key]
+        r["regression"] = r["simtime_ratio"] > (1.0 + tolerance)
+        if r["regression"]:
+            num_regressions += 1
+    return num_regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run GeNN benchmark suite")
+    parser.add_argument("--backend", choices=sorted(BACKENDS.keys()),
+                        default="single_threaded_cpu")
+    parser.add_argument("--models", default=",".join(sorted(MODELS.keys())),
+                        help="Comma-separated list of benchmarks to run")
+    parser.add_argument("--nsyn", default=None,
+                        help="Comma-separated list of synapse counts to run "
+                             "instead of each benchmark's default sweep")
+    parser.add_argument("--output", default="bench_results",
+                        help="Output filename prefix (.json and .csv are appended)")
+    parser.add_argument("--baseline", default=None,
+                        help="JSON results of a previous run to compare against")
+    parser.add_argument("--tolerance", type=float, default=0.1,
+                        help="Fractional increase in simulation time relative "
+                             "to baseline which is reported as a regression")
+    parser.add_argument("--connectivity-cache", default=None,
+                        help="Directory in which to cache initialised connectivity "
+                             "so subsequent runs of the same model can skip "
+                             "initialising it (CPU backends only)")
+    args = parser.parse_args()
+
+    models = [m.strip() for m in args.models.split(",") if m.strip()]
+    for m in models:
+        if m not in MODELS:
+            parser.error("unknown benchmark '%s'" % m)
+
+    # Put GeNN's scripts at the front of the path as benchmark Makefiles locate GeNN from them
+    env = dict(os.environ)
+    env["PATH"] = os.path.join(GENN_DIR, "bin") + os.pathsep + env.get("PATH", "")
+
+    # Pass connectivity cache directory to simulators (see benchmark.h)
+    if args.connectivity_cache is not None:
+        cache_dir = os.path.abspath(args.connectivity_cache)
+        if not os.path.isdir(cache_dir):
+            os.makedirs(cache_dir)
+        env["GENN_CONNECTIVITY_CACHE"] = cache_dir
+
+    results = []
+    for m in models:
+        sizes = ([int(float(n)) for n in args.nsyn.split(",")] if args.nsyn
+                 else list(MODELS[m]["nsyn"]))
+
+        # Restore original inputs.h once this benchmark has run
+        inputs_path = os.path.join(GENN_DIR, MODELS[m]["dir"], "inputs.h")
+        with open(inputs_path, "r") as inputs_file:
+            original_inputs = inputs_file.read()
+        try:
+            for nsyn in sizes:
+                print("Running %s with %d synapses on %s" % (m, nsyn, args.backend))
+                try:
+                    results.append(run_benchmark(m, nsyn, args.backend, env))
+                except (subprocess.CalledProcessError, RuntimeError, ValueError) as ex:
+                    print("\tFailed: %s" % ex)
+                    results.append({"benchmark": m, "backend": args.backend,
+                                    "nsyn": nsyn, "error": str(ex)})
+        finally:
+            with open(inputs_path, "w") as inputs_file:
+                inputs_file.write(original_inputs)
+
+    num_regressions = 0
+    if args.baseline is not None:
+        num_regressions = compare_baseline(results, args.baseline, args.tolerance)
+
+    # Write JSON results
+    with open(os.path.join(GENN_DIR, "version.txt"), "r") as version_file:
+        version = version_file.read().strip()
+    output = {"genn_version": version,
+              "backend": args.backend,
+              "host": platform.node(),
+              "date": datetime.datetime.now().isoformat(),
+              "results": results}
+    with open(args.output + ".json", "w") as json_file:
+        json.dump(output, json_file, indent=4)
+
+    # Write CSV results
+    with open(args.output + ".csv", "w") as csv_file:
+        writer = csv.DictWriter(csv_file, fieldnames=CSV_FIELDS, extrasaction="ignore")
+        writer.writeheader()
+        writer.writerows(results)
+
+    # Summarise
+    print("%-12s %14s %10s %10s %10s" % ("benchmark", "nsyn", "setup [s]", "sim [s]", "vs base"))
+    for r in results:
+        if "error" in r:
+            print("%-12s %14d %s" % (r["benchmark"], r["nsyn"], "FAILED"))
+        else:
+            ratio = ("%9.2fx" % r["simtime_ratio"]) if "simtime_ratio" in r else ""
+            print("%-12s %14d %10.3f %10.3f %10s" % (r["benchmark"], r["nsyn"],
+                                                     r["setuptime"], r["simtime"], ratio))
+
+    if num_regressions > 0:
+        print("%d benchmark(s) more than %.0f%% slower than baseline"
+              % (num_regressions, args.tolerance * 100.0))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,75 @@
+#pragma once
+
+// Standard C++ includes
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+// Standard C includes
+#include <cstdio>
+#include <cstdlib>
+
+//----------------------------------------------------------------------------
+// Benchmark
+//----------------------------------------------------------------------------
+// Shared driver for the benchmark simulators in brunel, synth and vogels.
+// **NOTE** this uses the generated model's globals so must be included after definitions.h
+namespace Benchmark
+{
+//! Initialise and simulate model for numTimesteps, printing timings to stdout as a single JSON object
+/*! Per-phase times are only non-zero if model was built with ModelSpec::setTiming(true).
+    If the GENN_CONNECTIVITY_CACHE environment variable is set, connectivity is cached in that directory */
+inline int run(const char *modelName, double numSynapses, unsigned long long numTimesteps)
+{
+    typedef std::chrono::high_resolution_clock Clock;
+    typedef std::chrono::duration<double> Seconds;
+
+    try
+    {
+        // If a connectivity cache directory is specified, try and load connectivity from it
+        const char *cacheDirectory = std::getenv("GENN_CONNECTIVITY_CACHE");
+
+        const auto setupStart = Clock::now();
+        allocateMem();
+        const bool cached = (cacheDirectory != nullptr) && loadConnectivityCache(cacheDirectory);
+        initialize();
+        initializeSparse();
+        const double setupTime = Seconds(Clock::now() - setupStart).count();
+
+        // If connectivity wasn't loaded from cache, save it before simulation (which may change weights)
+        if(cacheDirectory != nullptr && !cached) {
+            saveConnectivityCache(cacheDirectory);
+        }
+
+        const auto simStart = Clock::now();
+        if(iT < numTimesteps) {
+            stepTimeN(numTimesteps - iT);
+        }
+        const double simTime = Seconds(Clock::now() - simStart).count();
+
+        printf("{\n");
+        printf("\t\"sim\": \"genn\",\n");
+        printf("\t\"model\": \"%s\",\n", modelName);
+        printf("\t\"#syn\": %.2e,\n", numSynapses);
+        printf("\t\"#gpus\": 1,\n");
+        printf("\t\"timesteps\": %llu,\n", numTimesteps);
+        printf("\t\"setuptime\": %f,\n", setupTime);
+        printf("\t\"cached\": %s,\n", cached ? "true" : "false");
+        printf("\t\"simtime\": %f,\n", simTime);
+        printf("\t\"initTime\": %f,\n", initTime);
+        printf("\t\"initSparseTime\": %f,\n", initSparseTime);
+        printf("\t\"neuronUpdateTime\": %f,\n", neuronUpdateTime);
+        printf("\t\"presynapticUpdateTime\": %f,\n", presynapticUpdateTime);
+        printf("\t\"postsynapticUpdateTime\": %f,\n", postsynapticUpdateTime);
+        printf("\t\"synapseDynamicsTime\": %f\n", synapseDynamicsTime);
+        printf("}\n");
+
+        freeMem();
+    }
+    catch(const std::exception &ex) {
+        std::cerr << "Error:" << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+}   // namespace Benchmark
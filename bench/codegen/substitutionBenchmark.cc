@@ -0,0 +1,121 @@
+// Standard C++ includes
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+#include <cstdlib>
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/substitutions.h"
+
+//----------------------------------------------------------------------------
+// Code generation microbenchmark
+//----------------------------------------------------------------------------
+// Times the string substitutions performed on every code snippet during code generation
+// on synthetic snippets which are roughly the shape of those generated for a large model.
+// Results are printed to stdout as a single JSON object in the same style as ../benchmark.h
+using namespace CodeGenerator;
+
+namespace
+{
+typedef std::chrono::high_resolution_clock Clock;
+typedef std::chrono::duration<double> Seconds;
+
+// Number of variables substituted into each snippet
+const unsigned int numVars = 200;
+
+// Number of times each benchmark is repeated
+const unsigned int numRepeats = 200;
+
+//! Build snippet which references each variable, calls GeNN functions and uses single-precision maths functions
+std::string buildSnippet()
+{
+    std::string code;
+    for(unsigned int v = 0; v < numVars; v++) {
+        const std::string var = "$(var" + std::to_string(v) + ")";
+        code += var + " += expf(-DT / $(tau)) * " + var + " + $(gennrand_uniform) * 0.5;\n";
+        if((v % 10) == 0) {
+            code += "$(addToInSyn, sqrtf(" + var + ") * $(gennrand_normal));\n";
+        }
+    }
+    return code;
+}
+
+template<typename F>
+double timeRepeated(F func)
+{
+    const auto start = Clock::now();
+    for(unsigned int r = 0; r < numRepeats; r++) {
+        func();
+    }
+    return Seconds(Clock::now() - start).count() / (double)numRepeats;
+}
+}   // Anonymous namespace
+
+int main()
+{
+    try
+    {
+        const std::string snippet = buildSnippet();
+
+        // Build substitution chain in the same way as backends i.e. functions in
+        // the outermost Substitutions and variables in the innermost
+        Substitutions funcSubs;
+        funcSubs.addFuncSubstitution("gennrand_uniform", 0, "standardUniformDistribution(hostRNG)");
+        funcSubs.addFuncSubstitution("gennrand_normal", 0, "standardNormalDistribution(hostRNG)");
+        funcSubs.addVarSubstitution("t", "t");
+
+        Substitutions groupSubs(&funcSubs);
+        groupSubs.addVarSubstitution("id", "i");
+        groupSubs.addVarSubstitution("tau", "group->tau");
+        groupSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[$(id)] += $(0)");
+
+        Substitutions varSubs(&groupSubs);
+        for(unsigned int v = 0; v < numVars; v++) {
+            varSubs.addVarSubstitution("var" + std::to_string(v), "lvar" + std::to_string(v));
+        }
+
+        // Time substituting all variables and functions
+        std::string code;
+        const double substitutionTime = timeRepeated(
+            [&]()
+            {
+                code = snippet;
+                varSubs.applyCheckUnreplaced(code, "benchmark");
+            });
+
+        // Time ensuring floating point type of substituted code
+        const double ensureFtypeTime = timeRepeated(
+            [&]()
+            {
+                ensureFtype(code, "float");
+            });
+
+        // Time substituting individual variable names
+        const double varSubstituteTime = timeRepeated(
+            [&]()
+            {
+                std::string varCode = code;
+                for(unsigned int v = 0; v < 10; v++) {
+                    regexVarSubstitute(varCode, "lvar" + std::to_string(v), "$(lvar" + std::to_string(v) + ")");
+                }
+            });
+
+        printf("{\n");
+        printf("\t\"snippetLength\": %zu,\n", snippet.size());
+        printf("\t\"numVars\": %u,\n", numVars);
+        printf("\t\"substitutionTime\": %f,\n", substitutionTime);
+        printf("\t\"ensureFtypeTime\": %f,\n", ensureFtypeTime);
+        printf("\t\"varSubstituteTime\": %f\n", varSubstituteTime);
+        printf("}\n");
+    }
+    catch(const std::exception &ex) {
+        std::cerr << "Error:" << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
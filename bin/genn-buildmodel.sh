@@ -6,6 +6,7 @@ genn_help () {
     echo "genn-buildmodel.sh [cdho] model"
     echo "-c            only generate simulation code for the CPU"
     echo "-l            generate simulation code for OpenCL"
+    echo "-p            generate multi-threaded simulation code for the CPU"
     echo "-d            enables the debugging mode"
     echo "-m            generate MPI simulation code"
     echo "-v            generates coverage information"
@@ -28,10 +29,11 @@ BUILD_MODEL_INCLUDE=""
 GENERATOR_MAKEFILE="MakefileCUDA"
 CXX_STANDARD="c++11"
 while [[ -n "${!OPTIND}" ]]; do
-    while getopts "cldvs:o:i:h" option; do
+    while getopts "clpdvs:o:i:h" option; do
     case $option in
         c) GENERATOR_MAKEFILE="MakefileSingleThreadedCPU";;
         l) GENERATOR_MAKEFILE="MakefileOpenCL";;
+        p) GENERATOR_MAKEFILE="MakefileMultiThreadedCPU";;
         d) DEBUG=1;;
         v) COVERAGE=1;;
         h) genn_help; exit;;
@@ -0,0 +1,143 @@
+#pragma once
+#define EXPORT_VAR extern
+#define EXPORT_FUNC
+// Standard C++ includes
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+// Standard C includes
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#define DT 1.00000000000000006e-01f
+typedef float scalar;
+#define SCALAR_MIN 1.175494351e-38f
+#define SCALAR_MAX 3.402823466e+38f
+
+#define TIME_MIN 1.175494351e-38f
+#define TIME_MAX 3.402823466e+38f
+
+// ------------------------------------------------------------------------
+// bit tool macros
+#define B(x,i) ((x) & (0x80000000 >> (i))) //!< Extract the bit at the specified position i from x
+#define setB(x,i) x= ((x) | (0x80000000 >> (i))) //!< Set the bit at the specified position i in x to 1
+#define delB(x,i) x= ((x) & (~(0x80000000 >> (i)))) //!< Set the bit at the specified position i in x to 0
+
+extern "C" {
+// ------------------------------------------------------------------------
+// global variables
+// ------------------------------------------------------------------------
+EXPORT_VAR unsigned long long iT;
+EXPORT_VAR float t;
+
+// ------------------------------------------------------------------------
+// timers
+// ------------------------------------------------------------------------
+EXPORT_VAR double initTime;
+EXPORT_VAR double initSparseTime;
+EXPORT_VAR double neuronUpdateTime;
+EXPORT_VAR double presynapticUpdateTime;
+EXPORT_VAR double postsynapticUpdateTime;
+EXPORT_VAR double synapseDynamicsTime;
+
+// ------------------------------------------------------------------------
+// local neuron groups
+// ------------------------------------------------------------------------
+#define spikeCount_E glbSpkCntE[spkQuePtrE]
+#define spike_E (glbSpkE + (spkQuePtrE * 25298))
+#define glbSpkShiftE spkQuePtrE*25298
+
+EXPORT_VAR unsigned int* glbSpkCntE;
+EXPORT_VAR unsigned int* glbSpkE;
+EXPORT_VAR unsigned int spkQuePtrE;
+EXPORT_VAR scalar* VE;
+EXPORT_VAR scalar* RefracTimeE;
+#define spikeCount_I glbSpkCntI[spkQuePtrI]
+#define spike_I (glbSpkI + (spkQuePtrI * 6324))
+#define glbSpkShiftI spkQuePtrI*6324
+
+EXPORT_VAR unsigned int* glbSpkCntI;
+EXPORT_VAR unsigned int* glbSpkI;
+EXPORT_VAR unsigned int spkQuePtrI;
+EXPORT_VAR scalar* VI;
+EXPORT_VAR scalar* RefracTimeI;
+#define spikeCount_Poisson glbSpkCntPoisson[spkQuePtrPoisson]
+#define spike_Poisson (glbSpkPoisson + (spkQuePtrPoisson * 31622))
+#define glbSpkShiftPoisson spkQuePtrPoisson*31622
+
+EXPORT_VAR unsigned int* glbSpkCntPoisson;
+EXPORT_VAR unsigned int* glbSpkPoisson;
+EXPORT_VAR unsigned int spkQuePtrPoisson;
+EXPORT_VAR scalar* timeStepToSpikePoisson;
+
+// ------------------------------------------------------------------------
+// postsynaptic variables
+// ------------------------------------------------------------------------
+EXPORT_VAR float* inSynMerged0_E;
+EXPORT_VAR float* inSynEE;
+EXPORT_VAR float* inSynMerged0_I;
+
+// ------------------------------------------------------------------------
+// synapse connectivity
+// ------------------------------------------------------------------------
+EXPORT_VAR const unsigned int maxRowLengthEE;
+EXPORT_VAR unsigned int* rowLengthEE;
+EXPORT_VAR uint32_t* indEE;
+EXPORT_VAR unsigned int* colLengthEE;
+EXPORT_VAR unsigned int* remapEE;
+EXPORT_VAR uint32_t* gpEI;
+EXPORT_VAR uint32_t* gpIE;
+EXPORT_VAR uint32_t* gpII;
+EXPORT_VAR uint32_t* gpPoissonE;
+EXPORT_VAR uint32_t* gpPoissonI;
+
+// ------------------------------------------------------------------------
+// synapse variables
+// ------------------------------------------------------------------------
+EXPORT_VAR scalar* gEE;
+EXPORT_VAR scalar* preTraceEE;
+EXPORT_VAR scalar* postTraceEE;
+
+EXPORT_FUNC void pushEStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullEStateFromDevice();
+EXPORT_FUNC void pushIStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullIStateFromDevice();
+EXPORT_FUNC void pushPoissonStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullPoissonStateFromDevice();
+EXPORT_FUNC void pushEEStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullEEStateFromDevice();
+EXPORT_FUNC void pushEIStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullEIStateFromDevice();
+EXPORT_FUNC void pushIEStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullIEStateFromDevice();
+EXPORT_FUNC void pushIIStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullIIStateFromDevice();
+EXPORT_FUNC void pushPoissonEStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullPoissonEStateFromDevice();
+EXPORT_FUNC void pushPoissonIStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void pullPoissonIStateFromDevice();
+// Runner functions
+EXPORT_FUNC void copyStateToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void copyConnectivityToDevice(bool uninitialisedOnly = false);
+EXPORT_FUNC void copyStateFromDevice();
+EXPORT_FUNC void copyCurrentSpikesFromDevice();
+EXPORT_FUNC void copyCurrentSpikeEventsFromDevice();
+EXPORT_FUNC void allocateMem();
+EXPORT_FUNC void freeMem();
+EXPORT_FUNC size_t getFreeDeviceMemBytes();
+EXPORT_FUNC void stepTime();
+EXPORT_FUNC void stepTimeN(unsigned long long n, void (*callback)(unsigned long long) = nullptr, unsigned long long interval = 0);
+EXPORT_FUNC void saveCheckpoint(const char *filename);
+EXPORT_FUNC void loadCheckpoint(const char *filename);
+EXPORT_FUNC bool loadConnectivityCache(const char *directory);
+EXPORT_FUNC void saveConnectivityCache(const char *directory);
+
+// Functions generated by backend
+EXPORT_FUNC void updateNeurons(float t); 
+EXPORT_FUNC void updateSynapses(float t);
+EXPORT_FUNC void initialize();
+EXPORT_FUNC void initializeSparse();
+}  // extern "C"
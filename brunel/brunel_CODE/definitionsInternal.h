@@ -0,0 +1,68 @@
+#pragma once
+#include "definitions.h"
+
+#define SUPPORT_CODE_FUNC inline
+using std::min;
+using std::max;
+#define gennCLZ __builtin_clz
+#define gennCTZ __builtin_ctz
+#define gennCLZ64 __builtin_clzll
+
+#ifdef __AVX512F__
+#include <immintrin.h>
+#endif
+
+// Counter-based RNG used for simulation and initialisation
+#include "single_threaded_cpu/philoxRNG.h"
+extern uint64_t philoxSeed;
+
+// ------------------------------------------------------------------------
+// merged group structures
+// ------------------------------------------------------------------------
+extern "C" {
+// ------------------------------------------------------------------------
+// global variables
+// ------------------------------------------------------------------------
+EXPORT_VAR bool connectivityCacheLoaded;
+
+// ------------------------------------------------------------------------
+// timers
+// ------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------
+// local neuron groups
+// ------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------
+// postsynaptic variables
+// ------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------
+// synapse connectivity
+// ------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------
+// synapse variables
+// ------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------
+// merged group arrays for host initialisation
+// ------------------------------------------------------------------------
+// ------------------------------------------------------------------------
+// copying merged group structures to device
+// ------------------------------------------------------------------------
+EXPORT_FUNC void pushMergedNeuronInitGroup0ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* timeStepToSpike, unsigned int numNeurons);
+EXPORT_FUNC void pushMergedNeuronInitGroup1ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, unsigned int numNeurons);
+EXPORT_FUNC void pushMergedNeuronInitGroup2ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, float* inSynInSyn1, scalar* postTraceWUPost0, scalar* preTraceWUPre0, unsigned int numNeurons);
+EXPORT_FUNC void pushMergedSynapseConnectivityInitGroup0ToDevice(unsigned int idx, uint32_t* gp, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons);
+EXPORT_FUNC void pushMergedSynapseConnectivityInitGroup1ToDevice(unsigned int idx, uint32_t* gp, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons);
+EXPORT_FUNC void pushMergedSynapseConnectivityInitGroup2ToDevice(unsigned int idx, unsigned int* rowLength, uint32_t* ind, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons);
+EXPORT_FUNC void pushMergedSynapseSparseInitGroup0ToDevice(unsigned int idx, unsigned int* rowLength, uint32_t* ind, unsigned int* colLength, unsigned int* remap, scalar* g, unsigned int rowStride, unsigned int colStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons);
+EXPORT_FUNC void pushMergedNeuronUpdateGroup0ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* timeStepToSpike, unsigned int numNeurons);
+EXPORT_FUNC void pushMergedNeuronUpdateGroup1ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, unsigned int numNeurons);
+EXPORT_FUNC void pushMergedNeuronUpdateGroup2ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, float* inSynInSyn1, scalar* postTraceWUPost0, scalar* preTraceWUPre0, unsigned int numNeurons);
+EXPORT_FUNC void pushMergedPresynapticUpdateGroup0ToDevice(unsigned int idx, float* inSyn, unsigned int* srcSpkCnt, unsigned int* srcSpk, unsigned int* srcSpkQuePtr, unsigned int* trgSpkQuePtr, uint32_t* gp, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons, scalar g);
+EXPORT_FUNC void pushMergedPresynapticUpdateGroup1ToDevice(unsigned int idx, float* inSyn, unsigned int* srcSpkCnt, unsigned int* srcSpk, unsigned int* srcSpkQuePtr, unsigned int* trgSpkQuePtr, scalar* preTrace, scalar* postTrace, unsigned int* rowLength, uint32_t* ind, scalar* g, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons);
+EXPORT_FUNC void pushMergedPostsynapticUpdateGroup0ToDevice(unsigned int idx, unsigned int* trgSpkCnt, unsigned int* trgSpk, unsigned int* srcSpkQuePtr, unsigned int* trgSpkQuePtr, scalar* preTrace, scalar* postTrace, unsigned int* rowLength, uint32_t* ind, unsigned int* colLength, unsigned int* remap, scalar* g, unsigned int rowStride, unsigned int colStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons);
+EXPORT_FUNC void pushMergedNeuronSpikeQueueUpdateGroup0ToDevice(unsigned int idx, unsigned int* spkQuePtr, unsigned int* spkCnt, unsigned int numDelaySlots);
+}  // extern "C"
@@ -0,0 +1,403 @@
+#include "definitionsInternal.h"
+struct MergedNeuronInitGroup0
+ {
+    unsigned int* spkCnt;
+    unsigned int* spk;
+    unsigned int* spkQuePtr;
+    scalar* timeStepToSpike;
+    unsigned int numNeurons;
+    
+}
+;
+struct MergedNeuronInitGroup1
+ {
+    unsigned int* spkCnt;
+    unsigned int* spk;
+    unsigned int* spkQuePtr;
+    scalar* V;
+    scalar* RefracTime;
+    float* inSynInSyn0;
+    unsigned int numNeurons;
+    
+}
+;
+struct MergedNeuronInitGroup2
+ {
+    unsigned int* spkCnt;
+    unsigned int* spk;
+    unsigned int* spkQuePtr;
+    scalar* V;
+    scalar* RefracTime;
+    float* inSynInSyn0;
+    float* inSynInSyn1;
+    scalar* postTraceWUPost0;
+    scalar* preTraceWUPre0;
+    unsigned int numNeurons;
+    
+}
+;
+struct MergedSynapseConnectivityInitGroup0
+ {
+    uint32_t* gp;
+    unsigned int rowStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    
+}
+;
+struct MergedSynapseConnectivityInitGroup1
+ {
+    uint32_t* gp;
+    unsigned int rowStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    
+}
+;
+struct MergedSynapseConnectivityInitGroup2
+ {
+    unsigned int* rowLength;
+    uint32_t* ind;
+    unsigned int rowStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    
+}
+;
+struct MergedSynapseSparseInitGroup0
+ {
+    unsigned int* rowLength;
+    uint32_t* ind;
+    unsigned int* colLength;
+    unsigned int* remap;
+    scalar* g;
+    unsigned int rowStride;
+    unsigned int colStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    
+}
+;
+static MergedNeuronInitGroup0 mergedNeuronInitGroup0[1];
+void pushMergedNeuronInitGroup0ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* timeStepToSpike, unsigned int numNeurons) {
+    mergedNeuronInitGroup0[idx].spkCnt = spkCnt;
+    mergedNeuronInitGroup0[idx].spk = spk;
+    mergedNeuronInitGroup0[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronInitGroup0[idx].timeStepToSpike = timeStepToSpike;
+    mergedNeuronInitGroup0[idx].numNeurons = numNeurons;
+}
+static MergedNeuronInitGroup1 mergedNeuronInitGroup1[1];
+void pushMergedNeuronInitGroup1ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, unsigned int numNeurons) {
+    mergedNeuronInitGroup1[idx].spkCnt = spkCnt;
+    mergedNeuronInitGroup1[idx].spk = spk;
+    mergedNeuronInitGroup1[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronInitGroup1[idx].V = V;
+    mergedNeuronInitGroup1[idx].RefracTime = RefracTime;
+    mergedNeuronInitGroup1[idx].inSynInSyn0 = inSynInSyn0;
+    mergedNeuronInitGroup1[idx].numNeurons = numNeurons;
+}
+static MergedNeuronInitGroup2 mergedNeuronInitGroup2[1];
+void pushMergedNeuronInitGroup2ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, float* inSynInSyn1, scalar* postTraceWUPost0, scalar* preTraceWUPre0, unsigned int numNeurons) {
+    mergedNeuronInitGroup2[idx].spkCnt = spkCnt;
+    mergedNeuronInitGroup2[idx].spk = spk;
+    mergedNeuronInitGroup2[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronInitGroup2[idx].V = V;
+    mergedNeuronInitGroup2[idx].RefracTime = RefracTime;
+    mergedNeuronInitGroup2[idx].inSynInSyn0 = inSynInSyn0;
+    mergedNeuronInitGroup2[idx].inSynInSyn1 = inSynInSyn1;
+    mergedNeuronInitGroup2[idx].postTraceWUPost0 = postTraceWUPost0;
+    mergedNeuronInitGroup2[idx].preTraceWUPre0 = preTraceWUPre0;
+    mergedNeuronInitGroup2[idx].numNeurons = numNeurons;
+}
+static MergedSynapseConnectivityInitGroup0 mergedSynapseConnectivityInitGroup0[4];
+void pushMergedSynapseConnectivityInitGroup0ToDevice(unsigned int idx, uint32_t* gp, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons) {
+    mergedSynapseConnectivityInitGroup0[idx].gp = gp;
+    mergedSynapseConnectivityInitGroup0[idx].rowStride = rowStride;
+    mergedSynapseConnectivityInitGroup0[idx].numSrcNeurons = numSrcNeurons;
+    mergedSynapseConnectivityInitGroup0[idx].numTrgNeurons = numTrgNeurons;
+}
+static MergedSynapseConnectivityInitGroup1 mergedSynapseConnectivityInitGroup1[1];
+void pushMergedSynapseConnectivityInitGroup1ToDevice(unsigned int idx, uint32_t* gp, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons) {
+    mergedSynapseConnectivityInitGroup1[idx].gp = gp;
+    mergedSynapseConnectivityInitGroup1[idx].rowStride = rowStride;
+    mergedSynapseConnectivityInitGroup1[idx].numSrcNeurons = numSrcNeurons;
+    mergedSynapseConnectivityInitGroup1[idx].numTrgNeurons = numTrgNeurons;
+}
+static MergedSynapseConnectivityInitGroup2 mergedSynapseConnectivityInitGroup2[1];
+void pushMergedSynapseConnectivityInitGroup2ToDevice(unsigned int idx, unsigned int* rowLength, uint32_t* ind, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons) {
+    mergedSynapseConnectivityInitGroup2[idx].rowLength = rowLength;
+    mergedSynapseConnectivityInitGroup2[idx].ind = ind;
+    mergedSynapseConnectivityInitGroup2[idx].rowStride = rowStride;
+    mergedSynapseConnectivityInitGroup2[idx].numSrcNeurons = numSrcNeurons;
+    mergedSynapseConnectivityInitGroup2[idx].numTrgNeurons = numTrgNeurons;
+}
+static MergedSynapseSparseInitGroup0 mergedSynapseSparseInitGroup0[1];
+void pushMergedSynapseSparseInitGroup0ToDevice(unsigned int idx, unsigned int* rowLength, uint32_t* ind, unsigned int* colLength, unsigned int* remap, scalar* g, unsigned int rowStride, unsigned int colStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons) {
+    mergedSynapseSparseInitGroup0[idx].rowLength = rowLength;
+    mergedSynapseSparseInitGroup0[idx].ind = ind;
+    mergedSynapseSparseInitGroup0[idx].colLength = colLength;
+    mergedSynapseSparseInitGroup0[idx].remap = remap;
+    mergedSynapseSparseInitGroup0[idx].g = g;
+    mergedSynapseSparseInitGroup0[idx].rowStride = rowStride;
+    mergedSynapseSparseInitGroup0[idx].colStride = colStride;
+    mergedSynapseSparseInitGroup0[idx].numSrcNeurons = numSrcNeurons;
+    mergedSynapseSparseInitGroup0[idx].numTrgNeurons = numTrgNeurons;
+}
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+void initialize() {
+    const auto initStart = std::chrono::high_resolution_clock::now();
+    // ------------------------------------------------------------------------
+    // Local neuron groups
+     {
+        // merged neuron init group 0
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedNeuronInitGroup0[g]; 
+            for (unsigned int d = 0; d < 16; d++) {
+                group->spkCnt[d] = 0;
+            }
+            for (unsigned i = 0; i < (group->numNeurons); i++) {
+                for (unsigned int d = 0; d < 16; d++) {
+                    group->spk[(d * group->numNeurons) + i] = 0;
+                }
+            }
+            *group->spkQuePtr = 0;
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->timeStepToSpike[i] = (0.00000000000000000e+00f);
+                }
+            }
+            // current source variables
+        }
+    }
+     {
+        // merged neuron init group 1
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedNeuronInitGroup1[g]; 
+            for (unsigned int d = 0; d < 16; d++) {
+                group->spkCnt[d] = 0;
+            }
+            for (unsigned i = 0; i < (group->numNeurons); i++) {
+                for (unsigned int d = 0; d < 16; d++) {
+                    group->spk[(d * group->numNeurons) + i] = 0;
+                }
+            }
+            *group->spkQuePtr = 0;
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->V[i] = (0.00000000000000000e+00f);
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->RefracTime[i] = (0.00000000000000000e+00f);
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->inSynInSyn0[i] = 0.000000f;
+                }
+            }
+            // current source variables
+        }
+    }
+     {
+        // merged neuron init group 2
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedNeuronInitGroup2[g]; 
+            for (unsigned int d = 0; d < 16; d++) {
+                group->spkCnt[d] = 0;
+            }
+            for (unsigned i = 0; i < (group->numNeurons); i++) {
+                for (unsigned int d = 0; d < 16; d++) {
+                    group->spk[(d * group->numNeurons) + i] = 0;
+                }
+            }
+            *group->spkQuePtr = 0;
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->V[i] = (0.00000000000000000e+00f);
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->RefracTime[i] = (0.00000000000000000e+00f);
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->inSynInSyn0[i] = 0.000000f;
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->inSynInSyn1[i] = 0.000000f;
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    group->postTraceWUPost0[i] = (0.00000000000000000e+00f);
+                }
+            }
+             {
+                for (unsigned i = 0; i < (group->numNeurons); i++) {
+                    scalar initVal;
+                    initVal = (0.00000000000000000e+00f);
+                    for (unsigned int d = 0; d < 16; d++) {
+                        group->preTraceWUPre0[(d * group->numNeurons) + i] = initVal;
+                    }
+                }
+            }
+            // current source variables
+        }
+    }
+    // ------------------------------------------------------------------------
+    // Synapse groups with dense connectivity
+    // ------------------------------------------------------------------------
+    // Synapse groups with sparse connectivity
+    // **NOTE** skipped if connectivity has been loaded from cache by loadConnectivityCache
+    if(!connectivityCacheLoaded) {
+         {
+            // merged synapse connectivity init group 0
+            for(unsigned int g = 0; g < 4; g++) {
+                const auto *group = &mergedSynapseConnectivityInitGroup0[g]; 
+                const size_t gpSize = ((((size_t)group->numSrcNeurons * (size_t)group->rowStride) + 32 - 1) / 32);
+                memset(group->gp, 0, gpSize * sizeof(uint32_t));
+                for (unsigned int i = 0; i < group->numSrcNeurons; i++) {
+                    PhiloxRNG rng(philoxSeed, 67108864u, g, i, 0);
+                    // Build sparse connectivity
+                    int prevJ = -1.00000000000000000e+00;
+                    while(true) {
+                        const scalar u = philoxUniform<float>(rng);
+                        prevJ += (1 + (int)(log(u) * (-9.49122158102990454e+00f)));
+                        if(prevJ < group->numTrgNeurons) {
+                           do {
+                            const int64_t rowStartGID = i * group->rowStride;
+                            setB(group->gp[(rowStartGID + (prevJ+0)) / 32], (rowStartGID + prevJ+0) & 31);
+                        }
+                        while(false);
+                        }
+                        else {
+                           break;
+                        }
+                        
+                    }
+                }
+            }
+        }
+         {
+            // merged synapse connectivity init group 1
+            for(unsigned int g = 0; g < 1; g++) {
+                const auto *group = &mergedSynapseConnectivityInitGroup1[g]; 
+                const size_t gpSize = ((((size_t)group->numSrcNeurons * (size_t)group->rowStride) + 32 - 1) / 32);
+                memset(group->gp, 0, gpSize * sizeof(uint32_t));
+                for (unsigned int i = 0; i < group->numSrcNeurons; i++) {
+                    PhiloxRNG rng(philoxSeed, 67108865u, g, i, 0);
+                    // Build sparse connectivity
+                    int prevJ = -1.00000000000000000e+00;
+                    while(true) {
+                        int nextJ;
+                        do {
+                           const scalar u = philoxUniform<float>(rng);
+                           nextJ = prevJ + (1 + (int)(log(u) * (-9.49122158102990454e+00f)));
+                        } while(nextJ == i);
+                        prevJ = nextJ;
+                        if(prevJ < group->numTrgNeurons) {
+                           do {
+                            const int64_t rowStartGID = i * group->rowStride;
+                            setB(group->gp[(rowStartGID + (prevJ+0)) / 32], (rowStartGID + prevJ+0) & 31);
+                        }
+                        while(false);
+                        }
+                        else {
+                           break;
+                        }
+                        
+                    }
+                }
+            }
+        }
+         {
+            // merged synapse connectivity init group 2
+            for(unsigned int g = 0; g < 1; g++) {
+                const auto *group = &mergedSynapseConnectivityInitGroup2[g]; 
+                memset(group->rowLength, 0, group->numSrcNeurons * sizeof(unsigned int));
+                for (unsigned int i = 0; i < group->numSrcNeurons; i++) {
+                    PhiloxRNG rng(philoxSeed, 67108866u, g, i, 0);
+                    // Build sparse connectivity
+                    int prevJ = -1.00000000000000000e+00;
+                    while(true) {
+                        int nextJ;
+                        do {
+                           const scalar u = philoxUniform<float>(rng);
+                           nextJ = prevJ + (1 + (int)(log(u) * (-9.49122158102990454e+00f)));
+                        } while(nextJ == i);
+                        prevJ = nextJ;
+                        if(prevJ < group->numTrgNeurons) {
+                           do {
+                            const unsigned int idx = (i * group->rowStride) + group->rowLength[i];
+                            group->ind[idx] = prevJ+0;
+                            group->rowLength[i]++;
+                        }
+                        while(false);
+                        }
+                        else {
+                           break;
+                        }
+                        
+                    }
+                }
+            }
+        }
+    }
+    initTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - initStart).count();
+}
+
+void initializeSparse() {
+    const auto initSparseStart = std::chrono::high_resolution_clock::now();
+    // ------------------------------------------------------------------------
+    // Synapse groups with sparse connectivity
+    // **NOTE** skipped if connectivity has been loaded from cache by loadConnectivityCache
+    if(!connectivityCacheLoaded) {
+         {
+            // merged sparse synapse init group 0
+            for(unsigned int g = 0; g < 1; g++) {
+                const auto *group = &mergedSynapseSparseInitGroup0[g]; 
+                // Zero column lengths
+                std::fill_n(group->colLength, group->numTrgNeurons, 0);
+                // Loop through presynaptic neurons
+                for (unsigned int i = 0; i < group->numSrcNeurons; i++)
+                 {
+                     {
+                        for (unsigned j = 0; j < group->rowLength[i]; j++) {
+                            group->g[(i * group->rowStride) + j] = (1.00000000000000006e-01f);
+                        }
+                    }
+                    // Loop through synapses in corresponding matrix row
+                    for(unsigned int j = 0; j < group->rowLength[i]; j++)
+                     {
+                        // Calculate index of this synapse in the row-major matrix
+                        const unsigned int rowMajorIndex = (i * group->rowStride) + j;
+                        // Using this, lookup postsynaptic target
+                        const unsigned int postIndex = group->ind[rowMajorIndex];
+                        // From this calculate index of this synapse in the column-major matrix
+                        const unsigned int colMajorIndex = (postIndex * group->colStride) + group->colLength[postIndex];
+                        // Increment column length corresponding to this postsynaptic neuron
+                        group->colLength[postIndex]++;
+                        // Add remapping entry
+                        group->remap[colMajorIndex] = rowMajorIndex;
+                    }
+                }
+            }
+        }
+    }
+    connectivityCacheLoaded = false;
+    initSparseTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - initSparseStart).count();
+}
@@ -0,0 +1,243 @@
+#include "definitionsInternal.h"
+#include "supportCode.h"
+
+struct MergedNeuronUpdateGroup0
+ {
+    unsigned int* spkCnt;
+    unsigned int* spk;
+    unsigned int* spkQuePtr;
+    scalar* timeStepToSpike;
+    unsigned int numNeurons;
+    
+}
+;
+struct MergedNeuronUpdateGroup1
+ {
+    unsigned int* spkCnt;
+    unsigned int* spk;
+    unsigned int* spkQuePtr;
+    scalar* V;
+    scalar* RefracTime;
+    float* inSynInSyn0;
+    unsigned int numNeurons;
+    
+}
+;
+struct MergedNeuronUpdateGroup2
+ {
+    unsigned int* spkCnt;
+    unsigned int* spk;
+    unsigned int* spkQuePtr;
+    scalar* V;
+    scalar* RefracTime;
+    float* inSynInSyn0;
+    float* inSynInSyn1;
+    scalar* postTraceWUPost0;
+    scalar* preTraceWUPre0;
+    unsigned int numNeurons;
+    
+}
+;
+struct MergedNeuronSpikeQueueUpdateGroup0
+ {
+    unsigned int* spkQuePtr;
+    unsigned int* spkCnt;
+    unsigned int numDelaySlots;
+    
+}
+;
+static MergedNeuronUpdateGroup0 mergedNeuronUpdateGroup0[1];
+void pushMergedNeuronUpdateGroup0ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* timeStepToSpike, unsigned int numNeurons) {
+    mergedNeuronUpdateGroup0[idx].spkCnt = spkCnt;
+    mergedNeuronUpdateGroup0[idx].spk = spk;
+    mergedNeuronUpdateGroup0[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronUpdateGroup0[idx].timeStepToSpike = timeStepToSpike;
+    mergedNeuronUpdateGroup0[idx].numNeurons = numNeurons;
+}
+static MergedNeuronUpdateGroup1 mergedNeuronUpdateGroup1[1];
+void pushMergedNeuronUpdateGroup1ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, unsigned int numNeurons) {
+    mergedNeuronUpdateGroup1[idx].spkCnt = spkCnt;
+    mergedNeuronUpdateGroup1[idx].spk = spk;
+    mergedNeuronUpdateGroup1[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronUpdateGroup1[idx].V = V;
+    mergedNeuronUpdateGroup1[idx].RefracTime = RefracTime;
+    mergedNeuronUpdateGroup1[idx].inSynInSyn0 = inSynInSyn0;
+    mergedNeuronUpdateGroup1[idx].numNeurons = numNeurons;
+}
+static MergedNeuronUpdateGroup2 mergedNeuronUpdateGroup2[1];
+void pushMergedNeuronUpdateGroup2ToDevice(unsigned int idx, unsigned int* spkCnt, unsigned int* spk, unsigned int* spkQuePtr, scalar* V, scalar* RefracTime, float* inSynInSyn0, float* inSynInSyn1, scalar* postTraceWUPost0, scalar* preTraceWUPre0, unsigned int numNeurons) {
+    mergedNeuronUpdateGroup2[idx].spkCnt = spkCnt;
+    mergedNeuronUpdateGroup2[idx].spk = spk;
+    mergedNeuronUpdateGroup2[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronUpdateGroup2[idx].V = V;
+    mergedNeuronUpdateGroup2[idx].RefracTime = RefracTime;
+    mergedNeuronUpdateGroup2[idx].inSynInSyn0 = inSynInSyn0;
+    mergedNeuronUpdateGroup2[idx].inSynInSyn1 = inSynInSyn1;
+    mergedNeuronUpdateGroup2[idx].postTraceWUPost0 = postTraceWUPost0;
+    mergedNeuronUpdateGroup2[idx].preTraceWUPre0 = preTraceWUPre0;
+    mergedNeuronUpdateGroup2[idx].numNeurons = numNeurons;
+}
+static MergedNeuronSpikeQueueUpdateGroup0 mergedNeuronSpikeQueueUpdateGroup0[3];
+void pushMergedNeuronSpikeQueueUpdateGroup0ToDevice(unsigned int idx, unsigned int* spkQuePtr, unsigned int* spkCnt, unsigned int numDelaySlots) {
+    mergedNeuronSpikeQueueUpdateGroup0[idx].spkQuePtr = spkQuePtr;
+    mergedNeuronSpikeQueueUpdateGroup0[idx].spkCnt = spkCnt;
+    mergedNeuronSpikeQueueUpdateGroup0[idx].numDelaySlots = numDelaySlots;
+}
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+void updateNeurons(float t) {
+    const auto neuronUpdateStart = std::chrono::high_resolution_clock::now();
+     {
+        // merged neuron spike queue update group 0
+        for(unsigned int g = 0; g < 3; g++) {
+            const auto *group = &mergedNeuronSpikeQueueUpdateGroup0[g]; 
+            group->spkCnt[*group->spkQuePtr] = 0;
+        }
+    }
+     {
+        // merged neuron update group 0
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedNeuronUpdateGroup0[g]; 
+            const unsigned int readDelayOffset = (((*group->spkQuePtr + 15) % 16) * group->numNeurons);
+            const unsigned int writeDelayOffset = (*group->spkQuePtr * group->numNeurons);
+            
+            for(unsigned int i = 0; i < group->numNeurons; i++) {
+                PhiloxRNG rng(philoxSeed, 16777216u, g, i, (uint32_t)iT);
+                scalar ltimeStepToSpike = group->timeStepToSpike[i];
+                
+                // test whether spike condition was fulfilled previously
+                // calculate membrane potential
+                if(ltimeStepToSpike <= 0.0f) {
+                    ltimeStepToSpike += (5.00000000000000000e+02f) * philoxExponential<float>(rng);
+                }
+                ltimeStepToSpike -= 1.0f;
+                
+                // test for and register a true spike
+                if (ltimeStepToSpike <= 0.0f) {
+                    group->spk[writeDelayOffset + group->spkCnt[*group->spkQuePtr]++] = i;
+                }
+                group->timeStepToSpike[i] = ltimeStepToSpike;
+            }
+        }
+    }
+     {
+        // merged neuron update group 1
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedNeuronUpdateGroup1[g]; 
+            const unsigned int readDelayOffset = (((*group->spkQuePtr + 15) % 16) * group->numNeurons);
+            const unsigned int writeDelayOffset = (*group->spkQuePtr * group->numNeurons);
+            
+            for(unsigned int i = 0; i < group->numNeurons; i++) {
+                scalar lV = group->V[i];
+                scalar lRefracTime = group->RefracTime[i];
+                
+                float Isyn = 0;
+                 {
+                    // pull inSyn values in a coalesced access
+                    float linSyn = group->inSynInSyn0[i];
+                    Isyn += linSyn; linSyn = 0;
+                    
+                    group->inSynInSyn0[i] = linSyn;
+                }
+                // test whether spike condition was fulfilled previously
+                const bool oldSpike= (lRefracTime <= 0.0f && lV >= (2.00000000000000000e+01f));
+                // calculate membrane potential
+                if (lRefracTime <= 0.0f) {
+                  lV += (DT / (2.00000000000000000e+01f))*(((0.00000000000000000e+00f) - lV) + (0.00000000000000000e+00f)) + Isyn;
+                }
+                else {
+                  lRefracTime -= DT;
+                }
+                
+                // test for and register a true spike
+                if ((lRefracTime <= 0.0f && lV >= (2.00000000000000000e+01f)) && !(oldSpike)) {
+                    group->spk[writeDelayOffset + group->spkCnt[*group->spkQuePtr]++] = i;
+                    // spike reset code
+                    lV = (0.00000000000000000e+00f);
+                    lRefracTime = (2.00000000000000000e+00f);
+                    
+                }
+                group->V[i] = lV;
+                group->RefracTime[i] = lRefracTime;
+            }
+        }
+    }
+     {
+        // merged neuron update group 2
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedNeuronUpdateGroup2[g]; 
+            const unsigned int readDelayOffset = (((*group->spkQuePtr + 15) % 16) * group->numNeurons);
+            const unsigned int writeDelayOffset = (*group->spkQuePtr * group->numNeurons);
+            
+            for(unsigned int i = 0; i < group->numNeurons; i++) {
+                scalar lV = group->V[i];
+                scalar lRefracTime = group->RefracTime[i];
+                
+                float Isyn = 0;
+                 {
+                    // pull inSyn values in a coalesced access
+                    float linSyn = group->inSynInSyn0[i];
+                    Isyn += linSyn; linSyn = 0;
+                    
+                    group->inSynInSyn0[i] = linSyn;
+                }
+                 {
+                    // pull inSyn values in a coalesced access
+                    float linSyn = group->inSynInSyn1[i];
+                    Isyn += linSyn; linSyn = 0;
+                    
+                    group->inSynInSyn1[i] = linSyn;
+                }
+                // test whether spike condition was fulfilled previously
+                const bool oldSpike= (lRefracTime <= 0.0f && lV >= (2.00000000000000000e+01f));
+                // calculate membrane potential
+                if (lRefracTime <= 0.0f) {
+                  lV += (DT / (2.00000000000000000e+01f))*(((0.00000000000000000e+00f) - lV) + (0.00000000000000000e+00f)) + Isyn;
+                }
+                else {
+                  lRefracTime -= DT;
+                }
+                
+                 {
+                    // perform WUM update required for merged0
+                    scalar lpreTrace = group->preTraceWUPre0[readDelayOffset + i];
+                    lpreTrace *= (9.95012479192682320e-01f);
+                    group->preTraceWUPre0[writeDelayOffset + i] = lpreTrace;
+                }
+                 {
+                    // perform WUM update required for merged0
+                    scalar lpostTrace = group->postTraceWUPost0[i];
+                    lpostTrace *= (9.95012479192682320e-01f);
+                    group->postTraceWUPost0[i] = lpostTrace;
+                }
+                // test for and register a true spike
+                if ((lRefracTime <= 0.0f && lV >= (2.00000000000000000e+01f)) && !(oldSpike)) {
+                     {
+                        // perform WUM update required for merged0
+                        scalar lpreTrace = group->preTraceWUPre0[readDelayOffset + i];
+                        lpreTrace += 1.0f;
+                        group->preTraceWUPre0[writeDelayOffset + i] = lpreTrace;
+                    }
+                     {
+                        // perform WUM update required for merged0
+                        scalar lpostTrace = group->postTraceWUPost0[i];
+                        lpostTrace += 1.0f;
+                        group->postTraceWUPost0[i] = lpostTrace;
+                    }
+                    group->spk[writeDelayOffset + group->spkCnt[*group->spkQuePtr]++] = i;
+                    // spike reset code
+                    lV = (0.00000000000000000e+00f);
+                    lRefracTime = (2.00000000000000000e+00f);
+                    
+                }
+                group->V[i] = lV;
+                group->RefracTime[i] = lRefracTime;
+            }
+        }
+    }
+    neuronUpdateTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - neuronUpdateStart).count();
+}
@@ -0,0 +1,416 @@
+#include "definitionsInternal.h"
+
+// Standard C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+uint64_t philoxSeed = 1234ull;
+
+extern "C" {
+// ------------------------------------------------------------------------
+// global variables
+// ------------------------------------------------------------------------
+unsigned long long iT;
+float t;
+bool connectivityCacheLoaded = false;
+
+// ------------------------------------------------------------------------
+// timers
+// ------------------------------------------------------------------------
+double initTime = 0.0;
+double initSparseTime = 0.0;
+double neuronUpdateTime = 0.0;
+double presynapticUpdateTime = 0.0;
+double postsynapticUpdateTime = 0.0;
+double synapseDynamicsTime = 0.0;
+
+// ------------------------------------------------------------------------
+// local neuron groups
+// ------------------------------------------------------------------------
+unsigned int* glbSpkCntE;
+unsigned int* glbSpkE;
+unsigned int spkQuePtrE = 0;
+scalar* VE;
+scalar* RefracTimeE;
+unsigned int* glbSpkCntI;
+unsigned int* glbSpkI;
+unsigned int spkQuePtrI = 0;
+scalar* VI;
+scalar* RefracTimeI;
+unsigned int* glbSpkCntPoisson;
+unsigned int* glbSpkPoisson;
+unsigned int spkQuePtrPoisson = 0;
+scalar* timeStepToSpikePoisson;
+
+// ------------------------------------------------------------------------
+// postsynaptic variables
+// ------------------------------------------------------------------------
+float* inSynMerged0_E;
+float* inSynEE;
+float* inSynMerged0_I;
+
+// ------------------------------------------------------------------------
+// synapse connectivity
+// ------------------------------------------------------------------------
+const unsigned int maxRowLengthEE = 2809;
+unsigned int* rowLengthEE;
+uint32_t* indEE;
+unsigned int* colLengthEE;
+unsigned int* remapEE;
+uint32_t* gpEI;
+uint32_t* gpIE;
+uint32_t* gpII;
+uint32_t* gpPoissonE;
+uint32_t* gpPoissonI;
+
+// ------------------------------------------------------------------------
+// synapse variables
+// ------------------------------------------------------------------------
+scalar* gEE;
+scalar* preTraceEE;
+scalar* postTraceEE;
+
+// ------------------------------------------------------------------------
+// merged group arrays
+// ------------------------------------------------------------------------
+}  // extern "C"
+void copyStateToDevice(bool uninitialisedOnly) {
+    pushEStateToDevice(uninitialisedOnly);
+    pushIStateToDevice(uninitialisedOnly);
+    pushPoissonStateToDevice(uninitialisedOnly);
+    pushEEStateToDevice(uninitialisedOnly);
+    pushEIStateToDevice(uninitialisedOnly);
+    pushIEStateToDevice(uninitialisedOnly);
+    pushIIStateToDevice(uninitialisedOnly);
+    pushPoissonEStateToDevice(uninitialisedOnly);
+    pushPoissonIStateToDevice(uninitialisedOnly);
+}
+
+void copyConnectivityToDevice(bool uninitialisedOnly) {
+}
+
+void copyStateFromDevice() {
+    pullEStateFromDevice();
+    pullIStateFromDevice();
+    pullPoissonStateFromDevice();
+    pullEEStateFromDevice();
+    pullEIStateFromDevice();
+    pullIEStateFromDevice();
+    pullIIStateFromDevice();
+    pullPoissonEStateFromDevice();
+    pullPoissonIStateFromDevice();
+}
+
+void copyCurrentSpikesFromDevice() {
+}
+
+void copyCurrentSpikeEventsFromDevice() {
+}
+
+void allocateMem() {
+    // ------------------------------------------------------------------------
+    // global variables
+    // ------------------------------------------------------------------------
+    
+    // ------------------------------------------------------------------------
+    // timers
+    // ------------------------------------------------------------------------
+    
+    // ------------------------------------------------------------------------
+    // local neuron groups
+    // ------------------------------------------------------------------------
+    glbSpkCntE = new unsigned int[16];
+    glbSpkE = new unsigned int[404768];
+    VE = new scalar[25298];
+    RefracTimeE = new scalar[25298];
+    glbSpkCntI = new unsigned int[16];
+    glbSpkI = new unsigned int[101184];
+    VI = new scalar[6324];
+    RefracTimeI = new scalar[6324];
+    glbSpkCntPoisson = new unsigned int[16];
+    glbSpkPoisson = new unsigned int[505952];
+    timeStepToSpikePoisson = new scalar[31622];
+    
+    // ------------------------------------------------------------------------
+    // postsynaptic variables
+    // ------------------------------------------------------------------------
+    inSynMerged0_E = new float[25298];
+    inSynEE = new float[25298];
+    inSynMerged0_I = new float[6324];
+    
+    // ------------------------------------------------------------------------
+    // synapse connectivity
+    // ------------------------------------------------------------------------
+    rowLengthEE = new unsigned int[25298];
+    indEE = new uint32_t[71062082];
+    colLengthEE = new unsigned int[25298];
+    remapEE = new unsigned int[71062082];
+    gpEI = new uint32_t[4999518];
+    gpIE = new uint32_t[4999518];
+    gpII = new uint32_t[1249781];
+    gpPoissonE = new uint32_t[24999168];
+    gpPoissonI = new uint32_t[6249298];
+    
+    // ------------------------------------------------------------------------
+    // synapse variables
+    // ------------------------------------------------------------------------
+    gEE = new scalar[71062082];
+    preTraceEE = new scalar[404768];
+    postTraceEE = new scalar[25298];
+    
+    pushMergedNeuronInitGroup0ToDevice(0, glbSpkCntPoisson, glbSpkPoisson, &spkQuePtrPoisson, timeStepToSpikePoisson, 31622);
+    pushMergedNeuronInitGroup1ToDevice(0, glbSpkCntI, glbSpkI, &spkQuePtrI, VI, RefracTimeI, inSynMerged0_I, 6324);
+    pushMergedNeuronInitGroup2ToDevice(0, glbSpkCntE, glbSpkE, &spkQuePtrE, VE, RefracTimeE, inSynMerged0_E, inSynEE, postTraceEE, preTraceEE, 25298);
+    pushMergedSynapseConnectivityInitGroup0ToDevice(0, gpPoissonI, 6324, 31622, 6324);
+    pushMergedSynapseConnectivityInitGroup0ToDevice(1, gpPoissonE, 25298, 31622, 25298);
+    pushMergedSynapseConnectivityInitGroup0ToDevice(2, gpIE, 25298, 6324, 25298);
+    pushMergedSynapseConnectivityInitGroup0ToDevice(3, gpEI, 6324, 25298, 6324);
+    pushMergedSynapseConnectivityInitGroup1ToDevice(0, gpII, 6324, 6324, 6324);
+    pushMergedSynapseConnectivityInitGroup2ToDevice(0, rowLengthEE, indEE, 2809, 25298, 25298);
+    pushMergedSynapseSparseInitGroup0ToDevice(0, rowLengthEE, indEE, colLengthEE, remapEE, gEE, 2809, 2809, 25298, 25298);
+    pushMergedNeuronUpdateGroup0ToDevice(0, glbSpkCntPoisson, glbSpkPoisson, &spkQuePtrPoisson, timeStepToSpikePoisson, 31622);
+    pushMergedNeuronUpdateGroup1ToDevice(0, glbSpkCntI, glbSpkI, &spkQuePtrI, VI, RefracTimeI, inSynMerged0_I, 6324);
+    pushMergedNeuronUpdateGroup2ToDevice(0, glbSpkCntE, glbSpkE, &spkQuePtrE, VE, RefracTimeE, inSynMerged0_E, inSynEE, postTraceEE, preTraceEE, 25298);
+    pushMergedPresynapticUpdateGroup0ToDevice(0, inSynMerged0_I, glbSpkCntPoisson, glbSpkPoisson, &spkQuePtrPoisson, &spkQuePtrI, gpPoissonI, 6324, 31622, 6324, 3.16235532224400720e-02f);
+    pushMergedPresynapticUpdateGroup0ToDevice(1, inSynMerged0_E, glbSpkCntPoisson, glbSpkPoisson, &spkQuePtrPoisson, &spkQuePtrE, gpPoissonE, 25298, 31622, 25298, 3.16235532224400720e-02f);
+    pushMergedPresynapticUpdateGroup0ToDevice(2, inSynMerged0_I, glbSpkCntI, glbSpkI, &spkQuePtrI, &spkQuePtrI, gpII, 6324, 6324, 6324, -1.58117766112200353e-01f);
+    pushMergedPresynapticUpdateGroup0ToDevice(3, inSynMerged0_E, glbSpkCntI, glbSpkI, &spkQuePtrI, &spkQuePtrE, gpIE, 25298, 6324, 25298, -1.58117766112200353e-01f);
+    pushMergedPresynapticUpdateGroup0ToDevice(4, inSynMerged0_I, glbSpkCntE, glbSpkE, &spkQuePtrE, &spkQuePtrI, gpEI, 6324, 25298, 6324, 3.16235532224400720e-02f);
+    pushMergedPresynapticUpdateGroup1ToDevice(0, inSynEE, glbSpkCntE, glbSpkE, &spkQuePtrE, &spkQuePtrE, preTraceEE, postTraceEE, rowLengthEE, indEE, gEE, 2809, 25298, 25298);
+    pushMergedPostsynapticUpdateGroup0ToDevice(0, glbSpkCntE, glbSpkE, &spkQuePtrE, &spkQuePtrE, preTraceEE, postTraceEE, rowLengthEE, indEE, colLengthEE, remapEE, gEE, 2809, 2809, 25298, 25298);
+    pushMergedNeuronSpikeQueueUpdateGroup0ToDevice(0, &spkQuePtrPoisson, glbSpkCntPoisson, 16);
+    pushMergedNeuronSpikeQueueUpdateGroup0ToDevice(1, &spkQuePtrI, glbSpkCntI, 16);
+    pushMergedNeuronSpikeQueueUpdateGroup0ToDevice(2, &spkQuePtrE, glbSpkCntE, 16);
+}
+
+void freeMem() {
+    // ------------------------------------------------------------------------
+    // global variables
+    // ------------------------------------------------------------------------
+    
+    // ------------------------------------------------------------------------
+    // timers
+    // ------------------------------------------------------------------------
+    
+    // ------------------------------------------------------------------------
+    // local neuron groups
+    // ------------------------------------------------------------------------
+    delete[] glbSpkCntE;
+    delete[] glbSpkE;
+    delete[] VE;
+    delete[] RefracTimeE;
+    delete[] glbSpkCntI;
+    delete[] glbSpkI;
+    delete[] VI;
+    delete[] RefracTimeI;
+    delete[] glbSpkCntPoisson;
+    delete[] glbSpkPoisson;
+    delete[] timeStepToSpikePoisson;
+    
+    // ------------------------------------------------------------------------
+    // postsynaptic variables
+    // ------------------------------------------------------------------------
+    delete[] inSynMerged0_E;
+    delete[] inSynEE;
+    delete[] inSynMerged0_I;
+    
+    // ------------------------------------------------------------------------
+    // synapse connectivity
+    // ------------------------------------------------------------------------
+    delete[] rowLengthEE;
+    delete[] indEE;
+    delete[] colLengthEE;
+    delete[] remapEE;
+    delete[] gpEI;
+    delete[] gpIE;
+    delete[] gpII;
+    delete[] gpPoissonE;
+    delete[] gpPoissonI;
+    
+    // ------------------------------------------------------------------------
+    // synapse variables
+    // ------------------------------------------------------------------------
+    delete[] gEE;
+    delete[] preTraceEE;
+    delete[] postTraceEE;
+    
+}
+
+size_t getFreeDeviceMemBytes() {
+    return 0;
+}
+
+void saveCheckpoint(const char *filename) {
+    std::ofstream checkpoint(filename, std::ios::binary);
+    if(!checkpoint.good()) {
+        throw std::runtime_error("Unable to open checkpoint file '" + std::string(filename) + "'");
+    }
+    const uint64_t header[3] = {1ull, 15456084181293588797ull, iT};
+    checkpoint.write("GENNCKPT", 8);
+    checkpoint.write(reinterpret_cast<const char*>(header), sizeof(header));
+    checkpoint.write(reinterpret_cast<const char*>(glbSpkCntE), 16 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(glbSpkE), 404768 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(&spkQuePtrE), sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(VE), 25298 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(RefracTimeE), 25298 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(glbSpkCntI), 16 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(glbSpkI), 101184 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(&spkQuePtrI), sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(VI), 6324 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(RefracTimeI), 6324 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(glbSpkCntPoisson), 16 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(glbSpkPoisson), 505952 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(&spkQuePtrPoisson), sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(timeStepToSpikePoisson), 31622 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(inSynMerged0_E), 25298 * sizeof(float));
+    checkpoint.write(reinterpret_cast<const char*>(inSynEE), 25298 * sizeof(float));
+    checkpoint.write(reinterpret_cast<const char*>(inSynMerged0_I), 6324 * sizeof(float));
+    checkpoint.write(reinterpret_cast<const char*>(rowLengthEE), 25298 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(indEE), 71062082 * sizeof(uint32_t));
+    checkpoint.write(reinterpret_cast<const char*>(colLengthEE), 25298 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(remapEE), 71062082 * sizeof(unsigned int));
+    checkpoint.write(reinterpret_cast<const char*>(gpEI), 4999518 * sizeof(uint32_t));
+    checkpoint.write(reinterpret_cast<const char*>(gpIE), 4999518 * sizeof(uint32_t));
+    checkpoint.write(reinterpret_cast<const char*>(gpII), 1249781 * sizeof(uint32_t));
+    checkpoint.write(reinterpret_cast<const char*>(gpPoissonE), 24999168 * sizeof(uint32_t));
+    checkpoint.write(reinterpret_cast<const char*>(gpPoissonI), 6249298 * sizeof(uint32_t));
+    checkpoint.write(reinterpret_cast<const char*>(gEE), 71062082 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(preTraceEE), 404768 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(postTraceEE), 25298 * sizeof(scalar));
+    checkpoint.write(reinterpret_cast<const char*>(&philoxSeed), sizeof(uint64_t));
+    if(!checkpoint.good()) {
+        throw std::runtime_error("Error writing checkpoint file '" + std::string(filename) + "'");
+    }
+}
+
+void loadCheckpoint(const char *filename) {
+    std::ifstream checkpoint(filename, std::ios::binary);
+    if(!checkpoint.good()) {
+        throw std::runtime_error("Unable to open checkpoint file '" + std::string(filename) + "'");
+    }
+    char magic[8];
+    uint64_t header[3];
+    checkpoint.read(magic, 8);
+    checkpoint.read(reinterpret_cast<char*>(header), sizeof(header));
+    if(!checkpoint.good() || std::string(magic, 8) != "GENNCKPT") {
+        throw std::runtime_error("'" + std::string(filename) + "' is not a checkpoint file");
+    }
+    if(header[0] != 1ull) {
+        throw std::runtime_error("Checkpoint file '" + std::string(filename) + "' has unsupported version");
+    }
+    if(header[1] != 15456084181293588797ull) {
+        throw std::runtime_error("Checkpoint file '" + std::string(filename) + "' was saved from a different model");
+    }
+    checkpoint.read(reinterpret_cast<char*>(glbSpkCntE), 16 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(glbSpkE), 404768 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(&spkQuePtrE), sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(VE), 25298 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(RefracTimeE), 25298 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(glbSpkCntI), 16 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(glbSpkI), 101184 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(&spkQuePtrI), sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(VI), 6324 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(RefracTimeI), 6324 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(glbSpkCntPoisson), 16 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(glbSpkPoisson), 505952 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(&spkQuePtrPoisson), sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(timeStepToSpikePoisson), 31622 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(inSynMerged0_E), 25298 * sizeof(float));
+    checkpoint.read(reinterpret_cast<char*>(inSynEE), 25298 * sizeof(float));
+    checkpoint.read(reinterpret_cast<char*>(inSynMerged0_I), 6324 * sizeof(float));
+    checkpoint.read(reinterpret_cast<char*>(rowLengthEE), 25298 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(indEE), 71062082 * sizeof(uint32_t));
+    checkpoint.read(reinterpret_cast<char*>(colLengthEE), 25298 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(remapEE), 71062082 * sizeof(unsigned int));
+    checkpoint.read(reinterpret_cast<char*>(gpEI), 4999518 * sizeof(uint32_t));
+    checkpoint.read(reinterpret_cast<char*>(gpIE), 4999518 * sizeof(uint32_t));
+    checkpoint.read(reinterpret_cast<char*>(gpII), 1249781 * sizeof(uint32_t));
+    checkpoint.read(reinterpret_cast<char*>(gpPoissonE), 24999168 * sizeof(uint32_t));
+    checkpoint.read(reinterpret_cast<char*>(gpPoissonI), 6249298 * sizeof(uint32_t));
+    checkpoint.read(reinterpret_cast<char*>(gEE), 71062082 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(preTraceEE), 404768 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(postTraceEE), 25298 * sizeof(scalar));
+    checkpoint.read(reinterpret_cast<char*>(&philoxSeed), sizeof(uint64_t));
+    if(!checkpoint.good()) {
+        throw std::runtime_error("Checkpoint file '" + std::string(filename) + "' is truncated");
+    }
+    iT = header[2];
+    t = iT*DT;
+}
+
+bool loadConnectivityCache(const char *directory) {
+    const std::string filename = std::string(directory) + "/brunel_f583cb2f8fd0ea29.gennconn";
+    std::ifstream cache(filename, std::ios::binary);
+    if(!cache.good()) {
+        return false;
+    }
+    char magic[8];
+    uint64_t header[2];
+    cache.read(magic, 8);
+    cache.read(reinterpret_cast<char*>(header), sizeof(header));
+    if(!cache.good() || std::string(magic, 8) != "GENNCONN" || header[0] != 1ull || header[1] != 17691207166378175017ull) {
+        throw std::runtime_error("'" + filename + "' is not a valid connectivity cache for this model");
+    }
+    cache.read(reinterpret_cast<char*>(rowLengthEE), 25298 * sizeof(unsigned int));
+    cache.read(reinterpret_cast<char*>(indEE), 71062082 * sizeof(uint32_t));
+    cache.read(reinterpret_cast<char*>(colLengthEE), 25298 * sizeof(unsigned int));
+    cache.read(reinterpret_cast<char*>(remapEE), 71062082 * sizeof(unsigned int));
+    cache.read(reinterpret_cast<char*>(gpEI), 4999518 * sizeof(uint32_t));
+    cache.read(reinterpret_cast<char*>(gpIE), 4999518 * sizeof(uint32_t));
+    cache.read(reinterpret_cast<char*>(gpII), 1249781 * sizeof(uint32_t));
+    cache.read(reinterpret_cast<char*>(gpPoissonE), 24999168 * sizeof(uint32_t));
+    cache.read(reinterpret_cast<char*>(gpPoissonI), 6249298 * sizeof(uint32_t));
+    cache.read(reinterpret_cast<char*>(gEE), 71062082 * sizeof(scalar));
+    if(!cache.good()) {
+        throw std::runtime_error("Connectivity cache '" + filename + "' is truncated");
+    }
+    connectivityCacheLoaded = true;
+    return true;
+}
+
+void saveConnectivityCache(const char *directory) {
+    const std::string filename = std::string(directory) + "/brunel_f583cb2f8fd0ea29.gennconn";
+    const std::string tempFilename = filename + ".tmp";
+    std::ofstream cache(tempFilename, std::ios::binary);
+    if(!cache.good()) {
+        throw std::runtime_error("Unable to open connectivity cache file '" + tempFilename + "'");
+    }
+    const uint64_t header[2] = {1ull, 17691207166378175017ull};
+    cache.write("GENNCONN", 8);
+    cache.write(reinterpret_cast<const char*>(header), sizeof(header));
+    cache.write(reinterpret_cast<const char*>(rowLengthEE), 25298 * sizeof(unsigned int));
+    cache.write(reinterpret_cast<const char*>(indEE), 71062082 * sizeof(uint32_t));
+    cache.write(reinterpret_cast<const char*>(colLengthEE), 25298 * sizeof(unsigned int));
+    cache.write(reinterpret_cast<const char*>(remapEE), 71062082 * sizeof(unsigned int));
+    cache.write(reinterpret_cast<const char*>(gpEI), 4999518 * sizeof(uint32_t));
+    cache.write(reinterpret_cast<const char*>(gpIE), 4999518 * sizeof(uint32_t));
+    cache.write(reinterpret_cast<const char*>(gpII), 1249781 * sizeof(uint32_t));
+    cache.write(reinterpret_cast<const char*>(gpPoissonE), 24999168 * sizeof(uint32_t));
+    cache.write(reinterpret_cast<const char*>(gpPoissonI), 6249298 * sizeof(uint32_t));
+    cache.write(reinterpret_cast<const char*>(gEE), 71062082 * sizeof(scalar));
+    cache.close();
+    if(!cache.good() || std::rename(tempFilename.c_str(), filename.c_str()) != 0) {
+        throw std::runtime_error("Error writing connectivity cache file '" + filename + "'");
+    }
+}
+
+void stepTime() {
+    updateSynapses(t);
+    spkQuePtrE = (spkQuePtrE + 1) % 16;
+    spkQuePtrI = (spkQuePtrI + 1) % 16;
+    spkQuePtrPoisson = (spkQuePtrPoisson + 1) % 16;
+    updateNeurons(t); 
+    iT++;
+    t = iT*DT;
+}
+
+void stepTimeN(unsigned long long n, void (*callback)(unsigned long long), unsigned long long interval) {
+    for(unsigned long long i = 1; i <= n; i++) {
+        stepTime();
+        if(callback != nullptr && interval != 0 && (i % interval) == 0) {
+            callback(iT);
+        }
+    }
+}
+
@@ -0,0 +1,72 @@
+#include "definitionsInternal.h"
+
+// ------------------------------------------------------------------------
+// extra global params
+// ------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------
+// copying things to device
+// ------------------------------------------------------------------------
+void pushEStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushIStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushPoissonStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushEEStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushEIStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushIEStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushIIStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushPoissonEStateToDevice(bool uninitialisedOnly) {
+}
+
+void pushPoissonIStateToDevice(bool uninitialisedOnly) {
+}
+
+
+// ------------------------------------------------------------------------
+// copying things from device
+// ------------------------------------------------------------------------
+void pullEStateFromDevice() {
+}
+
+void pullIStateFromDevice() {
+}
+
+void pullPoissonStateFromDevice() {
+}
+
+void pullEEStateFromDevice() {
+}
+
+void pullEIStateFromDevice() {
+}
+
+void pullIEStateFromDevice() {
+}
+
+void pullIIStateFromDevice() {
+}
+
+void pullPoissonEStateFromDevice() {
+}
+
+void pullPoissonIStateFromDevice() {
+}
+
+
+// ------------------------------------------------------------------------
+// helper getter functions
+// ------------------------------------------------------------------------
+
@@ -0,0 +1,185 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+// PhiloxRNG
+//----------------------------------------------------------------------------
+//! Counter-based Philox4x32-10 random number generator used by code generated by the CPU backends
+/*! Rather than sharing a single stateful generator, generated code constructs a lightweight
+    PhiloxRNG for each neuron or synapse row it processes. The stream it produces depends only on
+    the model seed and the counter it was constructed with (which identifies the merged group, group,
+    element and timestep or variable) so results do not depend on the order elements are processed
+    in or on how many threads are used. Satisfies the UniformRandomBitGenerator requirements so it
+    can also be used with the standard library distributions. */
+class PhiloxRNG
+{
+public:
+    typedef uint32_t result_type;
+
+    PhiloxRNG(uint64_t seed, uint32_t stream, uint32_t group, uint32_t id, uint32_t offset)
+    :   m_Key{(uint32_t)seed ^ stream, (uint32_t)(seed >> 32)}, m_Counter{0, id, group, offset}, m_Index(4)
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    result_type operator()()
+    {
+        // If all words of current block have been used, generate next block
+        if(m_Index == 4) {
+            generateBlock();
+            m_Counter[0]++;
+            m_Index = 0;
+        }
+
+        return m_Output[m_Index++];
+    }
+
+    //! Skip the next n 32-bit outputs
+    void discard(unsigned long long n)
+    {
+        // Use up any words remaining in the current block
+        while(n > 0 && m_Index < 4) {
+            m_Index++;
+            n--;
+        }
+
+        // Advance counter past whole blocks and then consume remaining words
+        m_Counter[0] += (uint32_t)(n / 4);
+        for(unsigned long long i = 0; i < (n % 4); i++) {
+            (*this)();
+        }
+    }
+
+    static constexpr result_type min(){ return 0; }
+    static constexpr result_type max(){ return std::numeric_limits<uint32_t>::max(); }
+
+    //! Generate a 64-bit seed from system randomness - used when the model seed is zero
+    static uint64_t generateSeed()
+    {
+        std::random_device seedSource;
+        return ((uint64_t)seedSource() << 32) | (uint64_t)seedSource();
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void generateBlock()
+    {
+        uint32_t counter[4] = {m_Counter[0], m_Counter[1], m_Counter[2], m_Counter[3]};
+        uint32_t key[2] = {m_Key[0], m_Key[1]};
+        for(unsigned int r = 0; r < 10; r++) {
+            const uint64_t prod0 = (uint64_t)0xD2511F53u * counter[0];
+            const uint64_t prod1 = (uint64_t)0xCD9E8D57u * counter[2];
+            const uint32_t out0 = (uint32_t)(prod1 >> 32) ^ counter[1] ^ key[0];
+            const uint32_t out2 = (uint32_t)(prod0 >> 32) ^ counter[3] ^ key[1];
+            counter[0] = out0;
+            counter[1] = (uint32_t)prod1;
+            counter[2] = out2;
+            counter[3] = (uint32_t)prod0;
+
+            // Bump key
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        std::copy(std::begin(counter), std::end(counter), std::begin(m_Output));
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const uint32_t m_Key[2];
+    uint32_t m_Counter[4];
+    uint32_t m_Output[4];
+    unsigned int m_Index;
+};
+
+//----------------------------------------------------------------------------
+// Distributions
+//----------------------------------------------------------------------------
+// **NOTE** unlike the standard library distributions, these are stateless so, for example,
+// the second normally-distributed number generated by Box-Muller is discarded rather than cached
+template<typename T>
+inline T philoxUniform(PhiloxRNG &rng);
+
+//! Uniformly distributed float in [0, 1)
+template<>
+inline float philoxUniform<float>(PhiloxRNG &rng)
+{
+    return (float)(rng() >> 8) * (1.0f / 16777216.0f);
+}
+
+//! Uniformly distributed double in [0, 1)
+template<>
+inline double philoxUniform<double>(PhiloxRNG &rng)
+{
+    const uint64_t a = rng() >> 5;
+    const uint64_t b = rng() >> 6;
+    return (double)((a << 26) | b) * (1.0 / 9007199254740992.0);
+}
+
+//! Normally distributed number with zero mean and unit variance
+template<typename T>
+inline T philoxNormal(PhiloxRNG &rng)
+{
+    // Use 1 - u so log's argument is in (0, 1]
+    const T u1 = T(1) - philoxUniform<T>(rng);
+    const T u2 = philoxUniform<T>(rng);
+    return std::sqrt(T(-2) * std::log(u1)) * std::cos(T(6.283185307179586) * u2);
+}
+
+//! Exponentially distributed number with unit rate
+template<typename T>
+inline T philoxExponential(PhiloxRNG &rng)
+{
+    return -std::log(T(1) - philoxUniform<T>(rng));
+}
+
+//! Log-normally distributed number
+template<typename T>
+inline T philoxLogNormal(PhiloxRNG &rng, T mean, T std)
+{
+    return std::exp(mean + (std * philoxNormal<T>(rng)));
+}
+
+//! Gamma distributed number with unit scale, generated using Marsaglia and Tsang's method
+template<typename T>
+inline T philoxGamma(PhiloxRNG &rng, T a)
+{
+    // For a < 1, boost to a + 1 and scale result
+    if(a < T(1)) {
+        const T u = philoxUniform<T>(rng);
+        return philoxGamma<T>(rng, a + T(1)) * std::pow(T(1) - u, T(1) / a);
+    }
+
+    const T d = a - (T(1) / T(3));
+    const T c = (T(1) / T(3)) / std::sqrt(d);
+    while(true) {
+        T x;
+        T v;
+        do {
+            x = philoxNormal<T>(rng);
+            v = T(1) + (c * x);
+        } while(v <= T(0));
+
+        v = v * v * v;
+        const T u = T(1) - philoxUniform<T>(rng);
+        if(u < T(1) - (T(0.0331) * x * x * x * x)) {
+            return d * v;
+        }
+        if(std::log(u) < (T(0.5) * x * x) + (d * (T(1) - v + std::log(v)))) {
+            return d * v;
+        }
+    }
+}
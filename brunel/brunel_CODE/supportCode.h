@@ -0,0 +1,12 @@
+#pragma once
+
+// support code for neuron update groups
+
+// support code for postsynaptic dynamics
+
+// support code for presynaptic update
+
+// support code for postsynaptic update groups
+
+// support code for synapse dynamics update groups
+
@@ -0,0 +1,213 @@
+#include "definitionsInternal.h"
+#include "supportCode.h"
+
+struct MergedPresynapticUpdateGroup0
+ {
+    float* inSyn;
+    unsigned int* srcSpkCnt;
+    unsigned int* srcSpk;
+    unsigned int* srcSpkQuePtr;
+    unsigned int* trgSpkQuePtr;
+    uint32_t* gp;
+    unsigned int rowStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    scalar g;
+    
+}
+;
+struct MergedPresynapticUpdateGroup1
+ {
+    float* inSyn;
+    unsigned int* srcSpkCnt;
+    unsigned int* srcSpk;
+    unsigned int* srcSpkQuePtr;
+    unsigned int* trgSpkQuePtr;
+    scalar* preTrace;
+    scalar* postTrace;
+    unsigned int* rowLength;
+    uint32_t* ind;
+    scalar* g;
+    unsigned int rowStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    
+}
+;
+struct MergedPostsynapticUpdateGroup0
+ {
+    unsigned int* trgSpkCnt;
+    unsigned int* trgSpk;
+    unsigned int* srcSpkQuePtr;
+    unsigned int* trgSpkQuePtr;
+    scalar* preTrace;
+    scalar* postTrace;
+    unsigned int* rowLength;
+    uint32_t* ind;
+    unsigned int* colLength;
+    unsigned int* remap;
+    scalar* g;
+    unsigned int rowStride;
+    unsigned int colStride;
+    unsigned int numSrcNeurons;
+    unsigned int numTrgNeurons;
+    
+}
+;
+static MergedPresynapticUpdateGroup0 mergedPresynapticUpdateGroup0[5];
+void pushMergedPresynapticUpdateGroup0ToDevice(unsigned int idx, float* inSyn, unsigned int* srcSpkCnt, unsigned int* srcSpk, unsigned int* srcSpkQuePtr, unsigned int* trgSpkQuePtr, uint32_t* gp, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons, scalar g) {
+    mergedPresynapticUpdateGroup0[idx].inSyn = inSyn;
+    mergedPresynapticUpdateGroup0[idx].srcSpkCnt = srcSpkCnt;
+    mergedPresynapticUpdateGroup0[idx].srcSpk = srcSpk;
+    mergedPresynapticUpdateGroup0[idx].srcSpkQuePtr = srcSpkQuePtr;
+    mergedPresynapticUpdateGroup0[idx].trgSpkQuePtr = trgSpkQuePtr;
+    mergedPresynapticUpdateGroup0[idx].gp = gp;
+    mergedPresynapticUpdateGroup0[idx].rowStride = rowStride;
+    mergedPresynapticUpdateGroup0[idx].numSrcNeurons = numSrcNeurons;
+    mergedPresynapticUpdateGroup0[idx].numTrgNeurons = numTrgNeurons;
+    mergedPresynapticUpdateGroup0[idx].g = g;
+}
+static MergedPresynapticUpdateGroup1 mergedPresynapticUpdateGroup1[1];
+void pushMergedPresynapticUpdateGroup1ToDevice(unsigned int idx, float* inSyn, unsigned int* srcSpkCnt, unsigned int* srcSpk, unsigned int* srcSpkQuePtr, unsigned int* trgSpkQuePtr, scalar* preTrace, scalar* postTrace, unsigned int* rowLength, uint32_t* ind, scalar* g, unsigned int rowStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons) {
+    mergedPresynapticUpdateGroup1[idx].inSyn = inSyn;
+    mergedPresynapticUpdateGroup1[idx].srcSpkCnt = srcSpkCnt;
+    mergedPresynapticUpdateGroup1[idx].srcSpk = srcSpk;
+    mergedPresynapticUpdateGroup1[idx].srcSpkQuePtr = srcSpkQuePtr;
+    mergedPresynapticUpdateGroup1[idx].trgSpkQuePtr = trgSpkQuePtr;
+    mergedPresynapticUpdateGroup1[idx].preTrace = preTrace;
+    mergedPresynapticUpdateGroup1[idx].postTrace = postTrace;
+    mergedPresynapticUpdateGroup1[idx].rowLength = rowLength;
+    mergedPresynapticUpdateGroup1[idx].ind = ind;
+    mergedPresynapticUpdateGroup1[idx].g = g;
+    mergedPresynapticUpdateGroup1[idx].rowStride = rowStride;
+    mergedPresynapticUpdateGroup1[idx].numSrcNeurons = numSrcNeurons;
+    mergedPresynapticUpdateGroup1[idx].numTrgNeurons = numTrgNeurons;
+}
+static MergedPostsynapticUpdateGroup0 mergedPostsynapticUpdateGroup0[1];
+void pushMergedPostsynapticUpdateGroup0ToDevice(unsigned int idx, unsigned int* trgSpkCnt, unsigned int* trgSpk, unsigned int* srcSpkQuePtr, unsigned int* trgSpkQuePtr, scalar* preTrace, scalar* postTrace, unsigned int* rowLength, uint32_t* ind, unsigned int* colLength, unsigned int* remap, scalar* g, unsigned int rowStride, unsigned int colStride, unsigned int numSrcNeurons, unsigned int numTrgNeurons) {
+    mergedPostsynapticUpdateGroup0[idx].trgSpkCnt = trgSpkCnt;
+    mergedPostsynapticUpdateGroup0[idx].trgSpk = trgSpk;
+    mergedPostsynapticUpdateGroup0[idx].srcSpkQuePtr = srcSpkQuePtr;
+    mergedPostsynapticUpdateGroup0[idx].trgSpkQuePtr = trgSpkQuePtr;
+    mergedPostsynapticUpdateGroup0[idx].preTrace = preTrace;
+    mergedPostsynapticUpdateGroup0[idx].postTrace = postTrace;
+    mergedPostsynapticUpdateGroup0[idx].rowLength = rowLength;
+    mergedPostsynapticUpdateGroup0[idx].ind = ind;
+    mergedPostsynapticUpdateGroup0[idx].colLength = colLength;
+    mergedPostsynapticUpdateGroup0[idx].remap = remap;
+    mergedPostsynapticUpdateGroup0[idx].g = g;
+    mergedPostsynapticUpdateGroup0[idx].rowStride = rowStride;
+    mergedPostsynapticUpdateGroup0[idx].colStride = colStride;
+    mergedPostsynapticUpdateGroup0[idx].numSrcNeurons = numSrcNeurons;
+    mergedPostsynapticUpdateGroup0[idx].numTrgNeurons = numTrgNeurons;
+}
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+// ------------------------------------------------------------------------
+// merged extra global parameter functions
+// ------------------------------------------------------------------------
+void updateSynapses(float t) {
+    const auto synapseDynamicsStart = std::chrono::high_resolution_clock::now();
+    synapseDynamicsTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - synapseDynamicsStart).count();
+    const auto presynapticUpdateStart = std::chrono::high_resolution_clock::now();
+     {
+        // merged presynaptic update group 0
+        for(unsigned int g = 0; g < 5; g++) {
+            const auto *group = &mergedPresynapticUpdateGroup0[g]; 
+            const unsigned int preReadDelaySlot = ((*group->srcSpkQuePtr + 1) % 16);
+            const unsigned int preReadDelayOffset = preReadDelaySlot * group->numSrcNeurons;
+            const unsigned int postReadDelayOffset = (*group->trgSpkQuePtr) * group->numTrgNeurons;
+            // process presynaptic events: True Spikes
+            for (unsigned int i = 0; i < group->srcSpkCnt[preReadDelaySlot]; i++) {
+                const unsigned int ipre = group->srcSpk[preReadDelayOffset + i];
+                const uint64_t rowStartBit = ipre * (uint64_t)group->numTrgNeurons;
+                for(unsigned int windowStart = 0; windowStart < group->numTrgNeurons; windowStart += 64) {
+                    const uint64_t windowStartBit = rowStartBit + windowStart;
+                    const unsigned int numWindowBits = std::min(64u, group->numTrgNeurons - windowStart);
+                    const unsigned int shift = (unsigned int)(windowStartBit % 32);
+                    const unsigned int numWindowWords = (shift + numWindowBits + 32 - 1) / 32;
+                    const uint32_t *windowWords = &group->gp[windowStartBit / 32];
+                    uint64_t connectivityWord = ((uint64_t)windowWords[0] << 32) | ((numWindowWords > 1) ? windowWords[1] : 0);
+                    if(shift != 0) {
+                        connectivityWord = (connectivityWord << shift) | ((numWindowWords > 2) ? (windowWords[2] >> (32 - shift)) : 0);
+                    }
+                    if(numWindowBits < 64) {
+                        connectivityWord &= ~(~0ull >> numWindowBits);
+                    }
+                    #ifdef __AVX512F__
+                    unsigned int batch[64];
+                    unsigned int batchSize = 0;
+                    const __m512i lane = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+                    for(int c = 3; c >= 0; c--) {
+                        const __mmask16 chunk = (__mmask16)(connectivityWord >> (16 * c));
+                        const __m512i chunkPost = _mm512_sub_epi32(_mm512_set1_epi32((int)(windowStart + 63 - (16 * c))), lane);
+                        _mm512_storeu_si512(&batch[batchSize], _mm512_maskz_compress_epi32(chunk, chunkPost));
+                        batchSize += _mm_popcnt_u32(chunk);
+                    }
+                    for(unsigned int b = 0; b < batchSize; b++) {
+                        const unsigned int ipost = batch[b];
+                        const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;
+                        group->inSyn[ipost] += group->g;
+                    }
+                    #else
+                    while(connectivityWord != 0) {
+                        const int numLZ = gennCLZ64(connectivityWord);
+                        connectivityWord &= ~(0x8000000000000000ull >> numLZ);
+                        const unsigned int ipost = windowStart + numLZ;
+                        const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;
+                        group->inSyn[ipost] += group->g;
+                    }
+                    #endif
+                }
+            }
+            
+        }
+    }
+     {
+        // merged presynaptic update group 1
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedPresynapticUpdateGroup1[g]; 
+            const unsigned int preReadDelaySlot = ((*group->srcSpkQuePtr + 1) % 16);
+            const unsigned int preReadDelayOffset = preReadDelaySlot * group->numSrcNeurons;
+            const unsigned int postReadDelayOffset = (*group->trgSpkQuePtr) * group->numTrgNeurons;
+            // process presynaptic events: True Spikes
+            for (unsigned int i = 0; i < group->srcSpkCnt[preReadDelaySlot]; i++) {
+                const unsigned int ipre = group->srcSpk[preReadDelayOffset + i];
+                const unsigned int npost = group->rowLength[ipre];
+                for (unsigned int j = 0; j < npost; j++) {
+                    const unsigned int synAddress = (ipre * group->rowStride) + j;
+                    const unsigned int ipost = group->ind[synAddress];
+                    group->inSyn[ipost] += (group->g[synAddress] * (3.16235532224400706e-01f));
+                    const scalar newWeight = group->g[synAddress] - ((2.02000000000000002e+00f) * (3.16235532224400703e-03f) * group->g[synAddress] * exp(-group->postTrace[ipost] / DT));
+                    group->g[synAddress] = fmax((0.00000000000000000e+00f), newWeight);
+                }
+            }
+            
+        }
+    }
+    presynapticUpdateTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - presynapticUpdateStart).count();
+    const auto postsynapticUpdateStart = std::chrono::high_resolution_clock::now();
+     {
+        // merged postsynaptic update group 0
+        for(unsigned int g = 0; g < 1; g++) {
+            const auto *group = &mergedPostsynapticUpdateGroup0[g]; 
+            const unsigned int preReadDelayOffset = ((*group->srcSpkQuePtr + 1) % 16) * group->numSrcNeurons;
+            const unsigned int postReadDelaySlot = (*group->trgSpkQuePtr);
+            const unsigned int postReadDelayOffset = postReadDelaySlot * group->numTrgNeurons;
+            const unsigned int numSpikes = group->trgSpkCnt[postReadDelaySlot];
+            for (unsigned int j = 0; j < numSpikes; j++) {
+                const unsigned int spike = group->trgSpk[postReadDelayOffset + j];
+                const unsigned int npre = group->colLength[spike];
+                for (unsigned int i = 0; i < npre; i++) {
+                    const unsigned int colMajorIndex = (spike * group->colStride) + i;
+                    const unsigned int rowMajorIndex = group->remap[colMajorIndex];
+                    const scalar newWeight = group->g[rowMajorIndex] + ((3.16235532224400703e-03f) * (1.0f - group->g[rowMajorIndex]) * exp(-group->preTrace[preReadDelayOffset + (rowMajorIndex / group->rowStride)] / DT));
+                    group->g[rowMajorIndex] = fmin((2.99999999999999989e-01f), newWeight);
+                }
+            }
+            
+        }
+    }
+    postsynapticUpdateTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - postsynapticUpdateStart).count();
+}
@@ -261,6 +261,14 @@ def generateNumpyApplyInArray1D( dataType, varName, sizeName ):
     '''Generates a line which applies numpy IN_ARRAY1 typemap to variable. IN_ARRAY1 is used to pass a numpy array as C array to C code'''
     return Template( '%apply ( ${data_t} IN_ARRAY1, int DIM1 ) {( ${data_t} ${varName}, int ${sizeName} )};\n').substitute( data_t=dataType, varName=varName, sizeName=sizeName )
 
+def generateNumpyApplyConstInArray1D( dataType, varName, sizeName, sizeType='int' ):
+    '''Generates a line which applies numpy IN_ARRAY1 typemap to const variable. IN_ARRAY1 is used to pass a numpy array as C array to C code'''
+    return Template( '%apply ( ${data_t} IN_ARRAY1, ${size_t} DIM1 ) {( const ${data_t} ${varName}, ${size_t} ${sizeName} )};\n').substitute( data_t=dataType, varName=varName, sizeName=sizeName, size_t=sizeType )
+
+def generateNumpyApplyInplaceArray1D( dataType, varName, sizeName, sizeType='int' ):
+    '''Generates a line which applies numpy INPLACE_ARRAY1 typemap to variable. INPLACE_ARRAY1 is used to let C code write into a preallocated numpy array'''
+    return Template( '%apply ( ${data_t} INPLACE_ARRAY1, ${size_t} DIM1 ) {( ${data_t} ${varName}, ${size_t} ${sizeName} )};\n').substitute( data_t=dataType, varName=varName, sizeName=sizeName, size_t=sizeType )
+
 def generateBuiltInGetter( models ):
     return Template('''std::vector< std::string > getBuiltInModels() {
     return std::vector<std::string>{"${MODELS}"};
@@ -277,6 +285,7 @@ def generateSharedLibraryModelInterface( swigPath ):
         with SwigAsIsScope( mg ):
             mg.write( '#define SWIG_FILE_WITH_INIT // for numpy\n' )
             mg.addCppInclude( '"sharedLibraryModelNumpy.h"' )
+            mg.addCppInclude( '"raggedMatrixNumpy.h"' )
 
         mg.addSwigInclude( '<std_string.i>' )
         mg.addSwigInclude( '"numpy.i"' )
@@ -296,9 +305,28 @@ def generateSharedLibraryModelInterface( swigPath ):
         mg.write( generateNumpyApplyInArray1D( 'double*', '_g', 'nG' ) )
         mg.write( generateNumpyApplyInArray1D( 'float*', '_g', 'nG' ) )
 
+        # Arrays passed to ragged matrix helpers
+        # **NOTE** arrays of synapses and bytes can have more elements than int can index so use size_t
+        mg.write( '%numpy_typemaps(uint8_t, NPY_UINT8, size_t)\n' )
+        mg.write( '%numpy_typemaps(unsigned int, NPY_UINT, size_t)\n' )
+        mg.write( '%numpy_typemaps(uint64_t, NPY_UINT64, size_t)\n' )
+        mg.write( generateNumpyApplyConstInArray1D( 'unsigned int*', 'rowLength', 'numRows' ) )
+        mg.write( generateNumpyApplyInplaceArray1D( 'unsigned int*', 'rowLength', 'numRows' ) )
+        mg.write( generateNumpyApplyConstInArray1D( 'unsigned int*', 'preInd', 'numSynapses', 'size_t' ) )
+        mg.write( generateNumpyApplyInplaceArray1D( 'unsigned int*', 'preInd', 'size', 'size_t' ) )
+        mg.write( generateNumpyApplyConstInArray1D( 'unsigned int*', 'postInd', 'numPostInd', 'size_t' ) )
+        mg.write( generateNumpyApplyConstInArray1D( 'uint64_t*', 'order', 'orderSize', 'size_t' ) )
+        mg.write( generateNumpyApplyInplaceArray1D( 'uint64_t*', 'order', 'orderSize', 'size_t' ) )
+        mg.write( generateNumpyApplyConstInArray1D( 'uint8_t*', 'paddedVar', 'paddedSize', 'size_t' ) )
+        mg.write( generateNumpyApplyConstInArray1D( 'uint8_t*', 'values', 'valuesSize', 'size_t' ) )
+        mg.write( generateNumpyApplyInplaceArray1D( 'uint8_t*', 'var', 'size', 'size_t' ) )
+        mg.write( generateNumpyApplyInplaceArray1D( 'uint8_t*', 'raggedVar', 'raggedSize', 'size_t' ) )
+
         mg.addSwigEnableUnderCaseConvert()
         mg.addSwigInclude( '"../../../userproject/include/sharedLibraryModel.h"' )
         mg.addSwigInclude( '"sharedLibraryModelNumpy.h"' )
+        mg.addSwigIgnore( 'RaggedMatrixNumpy::Detail::countRows', '// internal helper' )
+        mg.addSwigInclude( '"raggedMatrixNumpy.h"' )
         for dtShort, dataType in zip( [ "".join([dt_[0] for dt_ in dt.split()]) for dt in npDTypes],
                 npDTypes ):
             mg.addSwigTemplate( 'SharedLibraryModelNumpy::assignExternalPointerArray<{}>'.format( dataType ),
@@ -387,7 +415,10 @@ def generateCustomModelDeclImpls(swigPath):
 
 def generateBackend(swigPath, folder, namespace):
     # **YUCK** is this backend derived from BackendSIMT? 
-    simt_backend = (namespace != "SingleThreadedCPU")
+    simt_backend = (namespace not in ("SingleThreadedCPU", "MultiThreadedCPU"))
+
+    # **YUCK** is this backend derived from the single-threaded CPU backend?
+    cpu_derived_backend = (namespace == "MultiThreadedCPU")
 
     # Create SWIG module
     with SwigModuleGenerator(namespace + "Backend", os.path.join(swigPath, namespace + "Backend.i")) as mg:
@@ -422,6 +453,8 @@ def generateBackend(swigPath, folder, namespace):
 
         # Parse backend, ignore Backend itself to get PreferencesBase definition
         mg.addSwigIgnore("Backend")
+        if cpu_derived_backend:
+            mg.addSwigInclude('"../single_threaded_cpu/backend.h"')
         mg.addSwigInclude('"backend.h"')
 
         # Import stl containers so as to support std::string
@@ -0,0 +1,100 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+#include <vector>
+
+// GeNN includes
+#include "backendExport.h"
+
+// Single-threaded CPU backend includes
+#include "../single_threaded_cpu/backend.h"
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Preferences
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+struct Preferences : public SingleThreadedCPU::Preferences
+{
+    //! How many threads should generated code use? If zero, the number of hardware threads is used
+    unsigned int numThreads = 0;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+//! Backend which partitions neuron and synapse updates across a persistent pool of CPU threads
+/*! Neuron updates are split into 32-neuron aligned ranges. Synaptic updates of groups with dense, bitmask or
+    postsynaptically tiled sparse connectivity are partitioned so each thread owns a range of postsynaptic neurons
+    meaning that input accumulation requires no atomics and results are bitwise identical to the single-threaded
+    CPU backend, regardless of the number of threads used. The rows of other sparse and procedural groups are
+    instead split between threads which accumulate input into their own buffers before these are summed in thread
+    order. Results are then deterministic for a given number of threads but, because floating point additions
+    are reordered, may differ slightly from the single-threaded CPU backend. Setting a postsynaptic tile size
+    restores postsynaptic partitioning if exact results are required. */
+class BACKEND_EXPORT Backend : public SingleThreadedCPU::Backend
+{
+public:
+    Backend(const std::string &scalarType, const Preferences &preferences, unsigned int numThreads)
+    :   SingleThreadedCPU::Backend(scalarType, preferences), m_NumThreads(numThreads)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces &memorySpaces,
+                                 HostHandler preambleHandler, NeuronGroupSimHandler simHandler, NeuronUpdateGroupMergedHandler wuVarUpdateHandler,
+                                 HostHandler pushEGPHandler) const override;
+
+    virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces &memorySpaces,
+                                  HostHandler preambleHandler, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
+                                  PresynapticUpdateGroupMergedHandler wumEventHandler, PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler,
+                                  PostsynapticUpdateGroupMergedHandler postLearnHandler, SynapseDynamicsGroupMergedHandler synapseDynamicsHandler,
+                                  HostHandler pushEGPHandler) const override;
+
+    virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces &memorySpaces,
+                         HostHandler preambleHandler, NeuronInitGroupMergedHandler localNGHandler, SynapseDenseInitGroupMergedHandler sgDenseInitHandler,
+                         SynapseConnectivityInitMergedGroupHandler sgSparseRowConnectHandler, SynapseConnectivityInitMergedGroupHandler sgSparseColConnectHandler, 
+                         SynapseConnectivityInitMergedGroupHandler sgKernelInitHandler, SynapseSparseInitGroupMergedHandler sgSparseInitHandler,
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const override;
+
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+
+    virtual void genMakefilePreamble(std::ostream &os) const override;
+
+    virtual std::vector<filesystem::path> getFilesToCopy(const ModelSpecMerged &modelMerged) const override;
+
+    virtual void genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                                 const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMergedBase &sg,
+                                           const Substitutions &kernelSubs, Handler handler) const override;
+
+    //! Each thread times the groups it updates in its own slot
+    virtual unsigned int getNumGroupTimingSlots() const override{ return getNumThreads(); }
+
+    //--------------------------------------------------------------------------
+    // Public API
+    //--------------------------------------------------------------------------
+    unsigned int getNumThreads() const{ return m_NumThreads; }
+
+protected:
+    //--------------------------------------------------------------------------
+    // SingleThreadedCPU::Backend virtuals
+    //--------------------------------------------------------------------------
+    virtual void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const override;
+    virtual std::string getGroupTimingSlot() const override{ return "thread"; }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    const unsigned int m_NumThreads;
+};
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
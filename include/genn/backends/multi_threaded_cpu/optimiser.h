@@ -0,0 +1,33 @@
+#pragma once
+
+// PLOG includes
+#include <plog/Severity.h>
+
+// GeNN includes
+#include "backendExport.h"
+
+// Multi-threaded CPU backend includes
+#include "backend.h"
+
+// Forward declarations
+class ModelSpecInternal;
+namespace plog
+{
+class IAppender;
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Optimiser
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+namespace Optimiser
+{
+BACKEND_EXPORT Backend createBackend(const ModelSpecInternal &model, const filesystem::path &sharePath,
+                                     const filesystem::path &outputPath, plog::Severity backendLevel,
+                                     plog::IAppender *backendAppender, const Preferences &preferences);
+}
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
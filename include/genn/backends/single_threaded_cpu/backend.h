@@ -10,6 +10,7 @@
 
 // GeNN code generator includes
 #include "code_generator/backendBase.h"
+#include "code_generator/substitutions.h"
 
 // Forward declarations
 namespace filesystem
@@ -26,6 +27,13 @@ namespace SingleThreadedCPU
 {
 struct Preferences : public PreferencesBase
 {
+    //! Generate neuron update code the compiler can vectorise. Neurons are updated in blocks of 32 with
+    //! spikes only flagged in a bitmask word which is then scanned to emit spikes in a separate pass
+    bool enableVectorisedNeuronUpdate = false;
+
+    //! If non-zero, whenever at least this many presynaptic spikes are processed by a DENSE or BITMASK synapse group
+    //! in a timestep, they are processed in blocks of postsynaptic neurons rather than one spike's row at a time
+    unsigned int blockedPresynapticUpdateThreshold = 0;
 };
 
 //--------------------------------------------------------------------------
@@ -126,11 +134,18 @@ public:
     virtual void genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const override;
     virtual void genMSBuildImportTarget(std::ostream &os) const override;
 
+    virtual std::vector<filesystem::path> getFilesToCopy(const ModelSpecMerged &modelMerged) const override;
+
     virtual std::string getDeviceVarPrefix() const override{ return ""; }
 
     //! Should 'scalar' variables be implemented on device or can host variables be used directly?
     virtual bool isDeviceScalarRequired() const override { return false; }
 
+    //! Can arrays located on the 'device' be accessed directly by host code e.g. to save them in checkpoints?
+    virtual bool isDeviceMemoryHostAccessible() const override { return true; }
+
+    virtual std::vector<std::pair<std::string, std::string>> getCheckpointHostScalars(const ModelSpecMerged &modelMerged) const override;
+
     virtual bool isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const override;
     virtual bool isGlobalDeviceRNGRequired(const ModelSpecMerged &modelMerged) const override;
     virtual bool isPopulationRNGRequired() const override { return false; }
@@ -140,6 +155,13 @@ public:
 
     virtual bool isSynRemapRequired() const override{ return false; }
     virtual bool isPostsynapticRemapRequired() const override{ return true; }
+    virtual bool isPostsynapticTilingSupported() const override{ return true; }
+    virtual bool isCompactSparseSupported() const override{ return true; }
+    virtual bool isDeltaSparseIndSupported() const override{ return true; }
+    virtual bool isRemapPreIndSupported() const override{ return true; }
+    virtual bool isReducedPrecisionStorageSupported() const override{ return true; }
+    virtual bool isBatchingSupported() const override{ return true; }
+    virtual unsigned int getNumGroupTimingSlots() const override{ return 1; }
 
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const override{ return 0; }
@@ -151,14 +173,117 @@ public:
 
     virtual bool supportsNamespace() const override { return true; };
 
-private:
+protected:
     //--------------------------------------------------------------------------
-    // Private methods
+    // Protected API
     //--------------------------------------------------------------------------
+    //! Get function templates which implement GeNN's random number functions using a PhiloxRNG called $(rng)
+    static const std::vector<Substitutions::FunctionTemplate> &getFunctionTemplates(const std::string &precision);
+
+    //! Are any counter-based Philox RNG streams required to simulate or initialise model?
+    bool isPhiloxRNGRequired(const ModelSpecMerged &modelMerged) const;
+
+    //! If neurons in merged group require an RNG, generate the stream for neuron id this timestep and add it to popSubs
+    void genNeuronSimRNG(CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &popSubs) const;
+
+    //! Generate loop to update neurons in range [begin, end) of a merged neuron update group
+    /*! If vectorised neuron updates are enabled, begin must be a multiple of 32 */
+    void genNeuronUpdateLoop(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &funcSubs,
+                             const std::string &begin, const std::string &end,
+                             NeuronGroupSimHandler simHandler, NeuronUpdateGroupMergedHandler wuVarUpdateHandler) const;
+
+    //! Generate loops to initialise all merged neuron init groups
+    void genInitNeuronGroups(CodeStream &os, const ModelSpecMerged &modelMerged, const Substitutions &funcSubs,
+                             NeuronInitGroupMergedHandler localNGHandler) const;
+
+    //! Generate loops to initialise all merged synapse dense init groups
+    void genInitSynapseDenseGroups(CodeStream &os, const ModelSpecMerged &modelMerged, const Substitutions &funcSubs,
+                                   SynapseDenseInitGroupMergedHandler sgDenseInitHandler) const;
+
+    //! Generate code to zero the row lengths or bitmask of a group before its connectivity is built
+    void genInitConnectivityZero(CodeStream &os, const SynapseConnectivityInitGroupMerged &s) const;
+
+    //! Generate loop to build connectivity of rows [begin, end) (or columns, if snippet has column build code) of a group
+    /*! If countOnly is set, synapses are only counted in the row lengths, as is required to lay out compact sparse connectivity */
+    void genInitConnectivityLoop(CodeStream &os, const SynapseConnectivityInitGroupMerged &s, const Substitutions &funcSubs,
+                                 const std::string &begin, const std::string &end,
+                                 SynapseConnectivityInitMergedGroupHandler sgSparseRowConnectHandler, SynapseConnectivityInitMergedGroupHandler sgSparseColConnectHandler,
+                                 SynapseConnectivityInitMergedGroupHandler sgKernelInitHandler, bool countOnly) const;
+
+    //! Generate code to calculate the start of each row of compact sparse connectivity from the counted row lengths and re-zero them
+    void genInitCompactSparseRowPtr(CodeStream &os, const SynapseConnectivityInitGroupMerged &s) const;
+
+    //! Get expression for the index of the first synapse in row idPre of a sparse group
+    std::string getSparseRowStart(const SynapseGroupInternal &sg, const std::string &idPre) const;
+
+    //! Generate code to initialise the variables of synapses in row i of a sparse group
+    void genInitSparseRowVars(CodeStream &os, const SynapseSparseInitGroupMerged &s, const Substitutions &funcSubs,
+                              SynapseSparseInitGroupMergedHandler sgSparseInitHandler) const;
+
+    //! Generate code to find where each postsynaptic tile starts within row i of a sparse group
+    void genInitSparseRowTiles(CodeStream &os, const SynapseSparseInitGroupMerged &s) const;
+
+    //! Generate code to encode row i of a sparse group as deltas between successive postsynaptic indices
+    void genInitSparseRowDeltas(CodeStream &os, const SynapseSparseInitGroupMerged &s) const;
+
+    //! Generate loop to initialise elements [begin, end) of a neuron variable
+    void genVariableInitLoop(CodeStream &os, const std::string &begin, const std::string &end, const std::string &indexVarName,
+                             const Substitutions &kernelSubs, Handler handler) const;
+
+    //! Generate loop to initialise synapses [begin, end) of a row of synapse variables
+    void genSynapseVariableRowInitLoop(CodeStream &os, const SynapseGroupMergedBase &sg, const std::string &begin, const std::string &end,
+                                       const Substitutions &kernelSubs, Handler handler) const;
+
+    //! Get index of group timing slot which code generated by this backend updates
+    /*! Single-threaded code always uses the first slot, multi-threaded code uses one per thread */
+    virtual std::string getGroupTimingSlot() const{ return "0"; }
+
+    //! If group timing is enabled, generate code to start timing the current group
+    void genGroupTimerStart(CodeStream &os) const;
+
+    //! If group timing is enabled, generate code to add time elapsed since genGroupTimerStart to slot of the current group's timer
+    void genGroupTimerStop(CodeStream &os, const std::string &slot) const;
+
+    //! Generate loops which reset spike counts and update previous spike times of all neuron groups
+    void genNeuronSpikeQueueUpdate(CodeStream &os, const ModelSpecMerged &modelMerged) const;
+
+    //! Generate presynaptic update code for one type of presynaptic event.
+    /*! If popSubs provides id_post_begin and id_post_end substitutions, only
+        synapses targetting postsynaptic neurons within this range are processed. If
+        sparse connectivity is split into postsynaptic tiles, this range must start on a tile boundary.
+        Rows of procedural connectivity are always regenerated in full so the synapses
+        they contain do not depend on how the postsynaptic neurons are partitioned */
     void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
-                              bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler) const;
+                              bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
+                              PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler) const;
+
+    virtual void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const;
 
-    void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const;
+    //! Get number of neurons whose events are merged in the scratch arrays used by batched synapse updates (zero if model isn't batched)
+    size_t getBatchSpkScratchSize(const ModelSpecMerged &modelMerged) const;
+
+    //! Generate code to merge the events of every instance of a batched model's group into a single list
+    /*! Event i (which must be an expression using group and i) of each instance is merged into the numBatchSpk
+        neurons listed in batchSpk, alongside a bitmask of the instances they occurred in, in batchSpkInstances */
+    void genBatchSpkMerge(CodeStream &os, unsigned int batchSize, const std::string &spkCnt, const std::string &spk) const;
+
+    //! Generate code to list, in batchInstances, the instances in which merged event spkIndex occurred
+    void genBatchSpkInstances(CodeStream &os, unsigned int batchSize, const std::string &spkIndex) const;
+
+    //! Generate code to get pointer to the group processed by iteration g of a loop through a merged synapse group
+    /*! In batched models, each iteration processes every instance of a group so connectivity is read once for all of them.
+        batchGroup points at the first instance's entry and group is that entry, until it is pointed at another instance's */
+    template<typename T>
+    void genBatchGroupPointers(CodeStream &os, const T &g, unsigned int batchSize) const
+    {
+        if(batchSize > 1) {
+            os << "const auto *batchGroup = &merged" << T::name << "Group" << g.getIndex() << "[g * " << batchSize << "];" << std::endl;
+            os << "const auto *group = batchGroup;" << std::endl;
+        }
+        else {
+            os << "const auto *group = &merged" << T::name << "Group" << g.getIndex() << "[g]; " << std::endl;
+        }
+    }
 
     template<typename T>
     void genMergedStructArrayPush(CodeStream &os, const std::vector<T> &groups) const
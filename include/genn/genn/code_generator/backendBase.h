@@ -64,6 +64,10 @@ struct PreferencesBase
     //! Should GeNN generate pull functions for extra global parameters? These are very rarely used
     bool generateExtraGlobalParamPull = true;
 
+    //! If backend supports it, time each neuron and synapse group individually and count
+    //! the presynaptic events and synapses processed by each synapse group's presynaptic update
+    bool enableGroupTiming = false;
+
     //! C++ compiler options to be used for building all host side code (used for unix based platforms)
     std::string userCxxFlagsGNU = "";
 
@@ -360,6 +364,12 @@ public:
     //! Should 'scalar' variables be implemented on device or can host variables be used directly?
     virtual bool isDeviceScalarRequired() const = 0;
 
+    //! Can arrays located on the 'device' be accessed directly by host code e.g. to save them in checkpoints?
+    virtual bool isDeviceMemoryHostAccessible() const = 0;
+
+    //! Get types and names of any additional host scalars, such as RNG seeds, which must be saved in checkpoints
+    virtual std::vector<std::pair<std::string, std::string>> getCheckpointHostScalars(const ModelSpecMerged &modelMerged) const = 0;
+
     //! Different backends use different RNGs for different things. Does this one require a global host RNG for the specified model?
     virtual bool isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const = 0;
 
@@ -378,6 +388,34 @@ public:
     //! Different backends may implement synaptic plasticity differently. Does this one require a postsynaptic remapping data structure?
     virtual bool isPostsynapticRemapRequired() const = 0;
 
+    //! Different backends may process sparse connectivity differently. Does this one split it into postsynaptic tiles?
+    /*! If so, synapse groups with a non-zero SynapseGroup::getPostsynapticTileSize require a tile row start data structure */
+    virtual bool isPostsynapticTilingSupported() const = 0;
+
+    //! Different backends may lay out sparse connectivity differently. Does this one support storing it compactly?
+    /*! If so, synapse groups with SynapseGroup::isCompactSparseEnabled store their rows contiguously,
+        located using a row start offset data structure, rather than padded to the maximum row length */
+    virtual bool isCompactSparseSupported() const = 0;
+
+    //! Different backends may read sparse connectivity differently. Can this one decode delta-encoded indices?
+    /*! If so, synapse groups with SynapseGroup::isDeltaSparseIndEnabled require an additional array of index deltas */
+    virtual bool isDeltaSparseIndSupported() const = 0;
+
+    //! Different backends may run postsynaptic learning differently. Can this one read presynaptic indices stored alongside the remapping?
+    /*! If so, synapse groups with SynapseGroup::isRemapPreIndEnabled require an additional array of presynaptic indices */
+    virtual bool isRemapPreIndSupported() const = 0;
+
+    //! Can this backend store weight update model variables using the reduced precision half and bfloat16 types?
+    virtual bool isReducedPrecisionStorageSupported() const = 0;
+
+    //! Can this backend simulate several instances of a model in a single batch?
+    /*! If so, merged groups containing per-instance state have one entry per instance, offset into batched arrays */
+    virtual bool isBatchingSupported() const = 0;
+
+    //! How many separate timers and counters should each group have if per-group timing is enabled (zero if it isn't supported)
+    /*! For example, the multi-threaded CPU backend gives each thread its own so they can be updated without synchronisation */
+    virtual unsigned int getNumGroupTimingSlots() const = 0;
+
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const = 0;
 
@@ -420,12 +458,30 @@ public:
     //! Get the size of the type
     size_t getSize(const std::string &type) const;
 
+    //! Is sparse connectivity of synapse group stored compactly by this backend?
+    bool isCompactSparse(const SynapseGroupInternal &sg) const;
+
+    //! Are indices of sparse connectivity of synapse group additionally delta-encoded by this backend?
+    bool isDeltaSparseInd(const SynapseGroupInternal &sg) const;
+
+    //! Are presynaptic indices of synapse group stored alongside column-major remapping by this backend?
+    bool isRemapPreInd(const SynapseGroupInternal &sg) const;
+
+    //! Get the type used to address individual synapses of synapse group with sparse connectivity
+    std::string getSparseAddressType(const SynapseGroupInternal &sg) const;
+
     //! Get the prefix for accessing the address of 'scalar' variables
     std::string getScalarAddressPrefix() const
     {
         return isDeviceScalarRequired() ? getDeviceVarPrefix() : ("&" + getDeviceVarPrefix());
     }
 
+    //! Is per-group timing enabled and supported by this backend?
+    bool isGroupTimingEnabled() const
+    {
+        return (getPreferences().enableGroupTiming && getNumGroupTimingSlots() > 0);
+    }
+
     const PreferencesBase &getPreferences() const { return m_Preferences; }
 
     template<typename T>
@@ -127,12 +127,24 @@ public:
     //! Should 'scalar' variables be implemented on device or can host variables be used directly?
     virtual bool isDeviceScalarRequired() const final { return true; }
 
+    //! Can arrays located on the 'device' be accessed directly by host code e.g. to save them in checkpoints?
+    virtual bool isDeviceMemoryHostAccessible() const final { return false; }
+
+    virtual std::vector<std::pair<std::string, std::string>> getCheckpointHostScalars(const ModelSpecMerged&) const final{ return {}; }
+
     virtual bool isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const final;
     virtual bool isGlobalDeviceRNGRequired(const ModelSpecMerged &modelMerged) const final;
     virtual bool isPopulationRNGRequired() const final { return true; }
 
     virtual bool isSynRemapRequired() const final { return true; }
     virtual bool isPostsynapticRemapRequired() const final { return true; }
+    virtual bool isPostsynapticTilingSupported() const final { return false; }
+    virtual bool isCompactSparseSupported() const final { return false; }
+    virtual bool isDeltaSparseIndSupported() const final { return false; }
+    virtual bool isRemapPreIndSupported() const final { return false; }
+    virtual bool isReducedPrecisionStorageSupported() const final { return false; }
+    virtual bool isBatchingSupported() const final { return false; }
+    virtual unsigned int getNumGroupTimingSlots() const final { return 0; }
 
     //------------------------------------------------------------------------
     // Public API
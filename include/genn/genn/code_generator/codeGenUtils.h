@@ -31,12 +31,14 @@ namespace CodeGenerator
 GENN_EXPORT void substitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable  names in the neuron code strings or other templates
+/*! Only identifiers which exactly match trg are replaced, returns true if any replacements were made */
 //--------------------------------------------------------------------------
 GENN_EXPORT bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
+/*! Only identifiers which exactly match trg and are followed by a bracket are replaced, returns true if any replacements were made */
 //--------------------------------------------------------------------------
 GENN_EXPORT bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
@@ -54,6 +56,21 @@ GENN_EXPORT bool regexFuncSubstitute(std::string &s, const std::string &trg, con
 GENN_EXPORT void functionSubstitute(std::string &code, const std::string &funcName,
                                     unsigned int numParams, const std::string &replaceFuncTemplate);
 
+//--------------------------------------------------------------------------
+/*! \brief Parses the parameters of a function call in the form:
+ *
+ *  $(functionName, parameter1, param2Function(0.12, "string"))
+ *
+ * starting at begin (the character after the first comma) into params and returns the position of the closing bracket
+ */
+//--------------------------------------------------------------------------
+GENN_EXPORT size_t parseFunctionParameters(const std::string &code, size_t begin, std::vector<std::string> &params);
+
+//--------------------------------------------------------------------------
+//! \brief Substitutes parameters into a replacement template in the form actualFunction(CONSTANT, $(0), $(1))
+//--------------------------------------------------------------------------
+GENN_EXPORT std::string expandFunctionTemplate(const std::string &replaceFuncTemplate, const std::vector<std::string> &params);
+
 //! Divide two integers, rounding up i.e. effectively taking ceil
 inline size_t ceilDivide(size_t numerator, size_t denominator)
 {
@@ -68,6 +85,19 @@ inline size_t padSize(size_t size, size_t blockSize)
 
 GENN_EXPORT void genTypeRange(CodeStream &os, const std::string &precision, const std::string &prefix);
 
+//--------------------------------------------------------------------------
+/*! \brief Generates the reduced precision storage types (see Utils::isTypeReducedPrecision) as structs wrapping
+           their bit patterns alongside inline functions to convert them to and from float, rounding to nearest even
+ */
+//--------------------------------------------------------------------------
+GENN_EXPORT void genReducedPrecisionTypes(CodeStream &os);
+
+//! Get expression to convert value stored using reduced precision type to float
+GENN_EXPORT std::string getReducedPrecisionLoad(const std::string &type, const std::string &value);
+
+//! Get expression to convert float value to reduced precision type for storage
+GENN_EXPORT std::string getReducedPrecisionStore(const std::string &type, const std::string &value);
+
 //--------------------------------------------------------------------------
 /*! \brief This function implements a parser that converts any floating point constant in a code snippet to a floating point constant with an explicit precision (by appending "f" or removing it).
  */
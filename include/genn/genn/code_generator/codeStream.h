@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard C++ includes
+#include <atomic>
 #include <ostream>
 #include <stdexcept>
 #include <streambuf>
@@ -119,7 +120,8 @@ public:
         //------------------------------------------------------------------------
         // Static members
         //------------------------------------------------------------------------
-        GENN_EXPORT static unsigned int s_NextLevel;
+        //! Atomic as modules are generated concurrently
+        GENN_EXPORT static std::atomic<unsigned int> s_NextLevel;
 
         //------------------------------------------------------------------------
         // Members
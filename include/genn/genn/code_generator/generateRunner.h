@@ -15,6 +15,6 @@ class ModelSpecMerged;
 //--------------------------------------------------------------------------
 namespace CodeGenerator
 {
-MemAlloc generateRunner(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner,
+MemAlloc generateRunner(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &runnerPushPull,
                         const ModelSpecMerged &modelMerged, const BackendBase &backend);
 }
@@ -3,6 +3,7 @@
 // Standard includes
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <type_traits>
 #include <vector>
 
@@ -50,6 +51,9 @@ public:
     typedef std::function<std::string(const G &, size_t)> GetFieldValueFunc;
     typedef std::tuple<std::string, std::string, GetFieldValueFunc, FieldType> Field;
 
+    //! Number of elements each instance of a batched model requires in arrays holding per-instance state, indexed by array name
+    typedef std::map<std::string, size_t> BatchStrides;
+
 
     GroupMerged(size_t index, const std::string &precision, const std::vector<std::reference_wrapper<const GroupInternal>> groups)
     :   m_Index(index), m_LiteralSuffix((precision == "float") ? "f" : ""), m_Groups(std::move(groups))
@@ -191,6 +195,52 @@ protected:
         }
     }
 
+    //! Helper to get parameter values used by entry i of merged group
+    /*! **NOTE** in batched models, each group has one consecutive entry per instance so,
+        if a group has per-instance values, the instance is the entry index modulo their number */
+    static const std::vector<double> &getInstanceParamValues(const std::vector<double> &values, const std::vector<std::vector<double>> &batchValues, size_t i)
+    {
+        return batchValues.empty() ? values : batchValues.at(i % batchValues.size());
+    }
+
+    //! Helper to test whether parameter values, which may be set per-instance in batched models, are heterogeneous within merged group
+    /*! **NOTE** values are compared with those returned by getParamValuesFn for the archetype as these are used if they aren't heterogeneous */
+    template<typename P, typename B>
+    bool isParamValueHeterogeneous(size_t index, P getParamValuesFn, B getBatchParamValuesFn) const
+    {
+        // Get value of parameter in archetype group
+        const double archetypeValue = getParamValuesFn(getArchetype()).at(index);
+
+        // Return true if value of parameter used by any entry differs from the archetype value
+        for(size_t i = 0; i < getGroups().size(); i++) {
+            const GroupInternal &g = getGroups()[i];
+            if(getInstanceParamValues(getParamValuesFn(g), getBatchParamValuesFn(g), i).at(index) != archetypeValue) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Helper to test whether parameter values, which may be set per-instance in batched models, are heterogeneous within merged group
+    template<typename P, typename B>
+    bool isParamValueHeterogeneous(const std::vector<std::string> &codeStrings, const std::string &paramName,
+                                   size_t index, P getParamValuesFn, B getBatchParamValuesFn) const
+    {
+        // If none of the code strings reference the parameter, return false
+        if(std::none_of(codeStrings.begin(), codeStrings.end(),
+                        [&paramName](const std::string &c)
+                        {
+                            return (c.find("$(" + paramName + ")") != std::string::npos);
+                        }))
+        {
+            return false;
+        }
+        // Otherwise check if values are heterogeneous
+        else {
+            return isParamValueHeterogeneous<P, B>(index, getParamValuesFn, getBatchParamValuesFn);
+        }
+    }
+
     void addField(const std::string &type, const std::string &name, GetFieldValueFunc getFieldValue, FieldType fieldType = FieldType::Standard)
     {
         // Add field to data structure
@@ -271,6 +321,42 @@ protected:
         }
     }
 
+    template<typename T, typename P, typename B, typename H>
+    void addHeterogeneousParams(const Snippet::Base::StringVec &paramNames, const std::string &suffix,
+                                P getParamValues, B getBatchParamValues, H isHeterogeneous)
+    {
+        // Loop through params
+        for(size_t p = 0; p < paramNames.size(); p++) {
+            // If parameters is heterogeneous
+            if((static_cast<const T*>(this)->*isHeterogeneous)(p)) {
+                // Add field with value used by each entry
+                addScalarField(paramNames[p] + suffix,
+                               [p, getParamValues, getBatchParamValues](const G &g, size_t i)
+                               {
+                                   return Utils::writePreciseString(getInstanceParamValues(getParamValues(g), getBatchParamValues(g), i).at(p));
+                               });
+            }
+        }
+    }
+
+    template<typename T, typename D, typename B, typename H>
+    void addHeterogeneousDerivedParams(const Snippet::Base::DerivedParamVec &derivedParams, const std::string &suffix,
+                                       D getDerivedParamValues, B getBatchDerivedParamValues, H isHeterogeneous)
+    {
+        // Loop through derived params
+        for(size_t p = 0; p < derivedParams.size(); p++) {
+            // If parameters isn't homogeneous
+            if((static_cast<const T*>(this)->*isHeterogeneous)(p)) {
+                // Add field with value used by each entry
+                addScalarField(derivedParams[p].name + suffix,
+                               [p, getDerivedParamValues, getBatchDerivedParamValues](const G &g, size_t i)
+                               {
+                                   return Utils::writePreciseString(getInstanceParamValues(getDerivedParamValues(g), getBatchDerivedParamValues(g), i).at(p));
+                               });
+            }
+        }
+    }
+
     template<typename T, typename V, typename H>
     void addHeterogeneousVarInitParams(const Models::Base::VarVec &vars, V getVarInitialisers, H isHeterogeneous)
     {
@@ -316,7 +402,8 @@ protected:
     void generateRunnerBase(const BackendBase &backend, CodeStream &definitionsInternal,
                             CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
                             CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
-                            const std::string &name, bool host = false) const
+                            const std::string &name, bool host = false, unsigned int batchSize = 1,
+                            const BatchStrides &batchStrides = {}) const
     {
         // Make a copy of fields and sort so largest come first. This should mean that due
         // to structure packing rules, significant memory is saved and estimate is more precise
@@ -359,13 +446,13 @@ protected:
             // If this is a merged group used on the host, directly set array entry
             if(host) {
                 runnerMergedStructAlloc << "merged" << name << "Group" << getIndex() << "[" << groupIndex << "] = {";
-                generateStructFieldArguments(runnerMergedStructAlloc, groupIndex, sortedFields);
+                generateStructFieldArguments(runnerMergedStructAlloc, groupIndex, sortedFields, batchSize, batchStrides);
                 runnerMergedStructAlloc << "};" << std::endl;
             }
             // Otherwise, call function to push to device
             else {
                 runnerMergedStructAlloc << "pushMerged" << name << "Group" << getIndex() << "ToDevice(" << groupIndex << ", ";
-                generateStructFieldArguments(runnerMergedStructAlloc, groupIndex, sortedFields);
+                generateStructFieldArguments(runnerMergedStructAlloc, groupIndex, sortedFields, batchSize, batchStrides);
                 runnerMergedStructAlloc << ");" << std::endl;
             }
         }
@@ -375,17 +462,30 @@ private:
     //------------------------------------------------------------------------
     // Private methods
     //------------------------------------------------------------------------
-    void generateStructFieldArguments(CodeStream &os, size_t groupIndex, 
-                                      const std::vector<Field> &sortedFields) const
+    void generateStructFieldArguments(CodeStream &os, size_t groupIndex, const std::vector<Field> &sortedFields,
+                                      unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         // Get group by index
         const auto &g = getGroups()[groupIndex];
 
+        // In batched models, each group has one consecutive entry per instance
+        const size_t batch = groupIndex % batchSize;
+
         // Loop through fields
         for(size_t fieldIndex = 0; fieldIndex < sortedFields.size(); fieldIndex++) {
             const auto &f = sortedFields[fieldIndex];
             const std::string fieldInitVal = std::get<2>(f)(g, groupIndex);
             os << fieldInitVal;
+
+            // If field is a standard pointer field, it points directly to an array allocated by the runner
+            // (scalar fields, EGPs and host fields are shared between instances) so, if this array holds
+            // per-instance state, offset it to this entry's instance using the stride of the named array
+            if(batch != 0 && std::get<3>(f) == FieldType::Standard && Utils::isTypePointer(std::get<0>(f))) {
+                const auto batchStride = batchStrides.find(fieldInitVal);
+                if(batchStride != batchStrides.cend()) {
+                    os << " + " << (batch * batchStride->second);
+                }
+            }
             if(fieldIndex != (sortedFields.size() - 1)) {
                 os << ", ";
             }
@@ -415,10 +515,11 @@ public:
     //------------------------------------------------------------------------
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                   CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                  CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                  CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                  unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     void genMergedGroupSpikeCountReset(CodeStream &os) const;
@@ -558,6 +659,34 @@ protected:
         return false;
     }
 
+    template<typename T, typename G, typename B>
+    bool isChildParamValueHeterogeneous(const std::vector<std::string> &codeStrings,
+                                        const std::string &paramName, size_t childIndex, size_t paramIndex,
+                                        const std::vector<std::vector<T>> &sortedGroupChildren,
+                                        G getParamValuesFn, B getBatchParamValuesFn) const
+    {
+        // If any of the code strings reference the parameter
+        if(std::any_of(codeStrings.begin(), codeStrings.end(),
+                        [&paramName](const std::string &c)
+                        {
+                            return (c.find("$(" + paramName + ")") != std::string::npos);
+                        }))
+        {
+            // Get value of archetype parameter
+            const double firstValue = getParamValuesFn(sortedGroupChildren[0][childIndex]).at(paramIndex);
+
+            // Loop through groups within merged group and return true if value used by any instance differs
+            for(size_t i = 0; i < sortedGroupChildren.size(); i++) {
+                const auto group = sortedGroupChildren[i][childIndex];
+                if(getInstanceParamValues(getParamValuesFn(group), getBatchParamValuesFn(group), i).at(paramIndex) != firstValue) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
     template<typename T = NeuronGroupMergedBase, typename H, typename V>
     void addHeterogeneousChildParams(const Snippet::Base::StringVec &paramNames, size_t childIndex,
                                      const std::string &prefix, 
@@ -693,10 +822,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
     
     //----------------------------------------------------------------------------
@@ -746,10 +876,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     //----------------------------------------------------------------------------
@@ -950,10 +1081,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     //----------------------------------------------------------------------------
@@ -976,10 +1108,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     //----------------------------------------------------------------------------
@@ -1002,10 +1135,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     //----------------------------------------------------------------------------
@@ -1027,10 +1161,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     //----------------------------------------------------------------------------
@@ -1052,10 +1187,11 @@ public:
 
     void generateRunner(const BackendBase &backend, CodeStream &definitionsInternal,
                         CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
-                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc) const
+                        CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
+                        unsigned int batchSize, const BatchStrides &batchStrides) const
     {
         generateRunnerBase(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                           runnerVarDecl, runnerMergedStructAlloc, name);
+                           runnerVarDecl, runnerMergedStructAlloc, name, false, batchSize, batchStrides);
     }
 
     //----------------------------------------------------------------------------
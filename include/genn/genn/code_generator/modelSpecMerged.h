@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard C++ includes
+#include <unordered_map>
 #include <vector>
 
 // GeNN includes
@@ -231,27 +232,31 @@ private:
         }
     }
 
-    template<typename Group, typename MergedGroup, typename M>
+    template<typename Group, typename MergedGroup, typename D, typename M>
     void createMergedGroups(const ModelSpecInternal &model, const BackendBase &backend,
                             std::vector<std::reference_wrapper<const Group>> &unmergedGroups,
-                            std::vector<MergedGroup> &mergedGroups, M canMerge)
+                            std::vector<MergedGroup> &mergedGroups, D getHashDigest, M canMerge, bool batched = false)
     {
         // Loop through un-merged  groups
+        // **NOTE** groups which can be merged have the same hash digest so only the proto-merged
+        // groups with the same digest need comparing and full comparison just protects against collisions
         std::vector<std::vector<std::reference_wrapper<const Group>>> protoMergedGroups;
+        std::unordered_map<uint64_t, std::vector<size_t>> protoMergedGroupDigests;
         while(!unmergedGroups.empty()) {
             // Remove last group from vector
             const Group &group = unmergedGroups.back().get();
             unmergedGroups.pop_back();
 
-            // Loop through existing proto-merged groups
+            // Loop through existing proto-merged groups with same digest
+            auto &digestProtoMergedGroups = protoMergedGroupDigests[getHashDigest(group)];
             bool existingMergedGroupFound = false;
-            for(auto &p : protoMergedGroups) {
-                assert(!p.empty());
+            for(size_t p : digestProtoMergedGroups) {
+                assert(!protoMergedGroups[p].empty());
 
                 // If our group can be merged with this proto-merged group
-                if(canMerge(p.front().get(), group)) {
+                if(canMerge(protoMergedGroups[p].front().get(), group)) {
                     // Add group to vector
-                    p.emplace_back(group);
+                    protoMergedGroups[p].emplace_back(group);
 
                     // Set flag and stop searching
                     existingMergedGroupFound = true;
@@ -262,11 +267,27 @@ private:
             // If no existing merged groups were found, 
             // create a new proto-merged group containing just this group
             if(!existingMergedGroupFound) {
+                digestProtoMergedGroups.push_back(protoMergedGroups.size());
                 protoMergedGroups.emplace_back();
                 protoMergedGroups.back().emplace_back(group);
             }
         }
 
+        // If these merged groups access per-instance state, give each group one entry per instance of a batched model
+        // **NOTE** a group's entries are consecutive so synapse update code can read each row of connectivity once and apply
+        // it to every instance's entry and the instance is the entry index modulo the batch size
+        const unsigned int batchSize = model.getBatchSize();
+        if(batched && batchSize > 1) {
+            for(auto &p : protoMergedGroups) {
+                std::vector<std::reference_wrapper<const Group>> batchGroups;
+                batchGroups.reserve(p.size() * batchSize);
+                for(const auto &g : p) {
+                    batchGroups.insert(batchGroups.end(), batchSize, g);
+                }
+                p = std::move(batchGroups);
+            }
+        }
+
         // Reserve final merged groups vector
         mergedGroups.reserve(protoMergedGroups.size());
 
@@ -295,10 +316,10 @@ private:
         }
     }
     
-    template<typename Group, typename MergedGroup, typename F, typename M>
+    template<typename Group, typename MergedGroup, typename F, typename D, typename M>
     void createMergedGroups(const ModelSpecInternal &model, const BackendBase &backend,
                             const std::map<std::string, Group> &groups, std::vector<MergedGroup> &mergedGroups,
-                            F filter, M canMerge)
+                            F filter, D getHashDigest, M canMerge, bool batched = false)
     {
         // Build temporary vector of references to groups that pass filter
         std::vector<std::reference_wrapper<const Group>> unmergedGroups;
@@ -309,7 +330,7 @@ private:
         }
 
         // Merge filtered vector
-        createMergedGroups(model, backend, unmergedGroups, mergedGroups, canMerge);
+        createMergedGroups(model, backend, unmergedGroups, mergedGroups, getHashDigest, canMerge, batched);
     }
 
     //--------------------------------------------------------------------------
@@ -1,9 +1,10 @@
 #pragma once
 
 // Standard C++ includes
-#include <map>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // Standard C includes
 #include <cassert>
@@ -148,14 +149,20 @@ private:
     //--------------------------------------------------------------------------
     // Private API
     //--------------------------------------------------------------------------
-    void applyFuncs(std::string &code) const;
-    void applyVars(std::string &code) const;
+    //! Scan code once, appending it to output with any substitutions found in this or parent Substitutions applied
+    void applyTo(const std::string &code, std::string &output) const;
+
+    //! Find variable substitution in this or parent Substitutions, returning nullptr if none is found
+    const std::string *findVarSubstitution(const std::string &source, const Substitutions *&owner) const;
+
+    //! Find function substitution in this or parent Substitutions, returning nullptr if none is found
+    const std::pair<unsigned int, std::string> *findFuncSubstitution(const std::string &source) const;
 
     //--------------------------------------------------------------------------
     // Members
     //--------------------------------------------------------------------------
-    std::map<std::string, std::string> m_VarSubstitutions;
-    std::map<std::string, std::pair<unsigned int, std::string>> m_FuncSubstitutions;
+    std::unordered_map<std::string, std::string> m_VarSubstitutions;
+    std::unordered_map<std::string, std::pair<unsigned int, std::string>> m_FuncSubstitutions;
     const Substitutions *m_Parent;
 };
 }   // namespace CodeGenerator
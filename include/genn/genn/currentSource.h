@@ -90,6 +90,14 @@ protected:
     /*! NOTE: this can only be called after model is finalized */
     bool canInitBeMerged(const CurrentSource &other) const;
 
+    //! Get hash digest which is equal for current sources that canBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getHashDigest() const;
+
+    //! Get hash digest which is equal for current sources whose initialisation canInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getInitHashDigest() const;
+
 private:
     //------------------------------------------------------------------------
     // Members
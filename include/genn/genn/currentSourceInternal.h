@@ -22,4 +22,6 @@ public:
     using CurrentSource::isInitRNGRequired;
     using CurrentSource::canBeMerged;
     using CurrentSource::canInitBeMerged;
+    using CurrentSource::getHashDigest;
+    using CurrentSource::getInitHashDigest;
 };
@@ -37,6 +37,9 @@ public:
     //----------------------------------------------------------------------------
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Get hash digest which is equal for current source models that canBeMerged
+    uint64_t getHashDigest() const;
 };
 
 //----------------------------------------------------------------------------
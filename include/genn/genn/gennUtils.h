@@ -5,8 +5,12 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
 // GeNN includes
 #include "gennExport.h"
 
@@ -46,6 +50,12 @@ GENN_EXPORT bool isTypePointerToPointer(const std::string &type);
 //--------------------------------------------------------------------------
 GENN_EXPORT std::string getUnderlyingType(const std::string &type);
 
+//--------------------------------------------------------------------------
+//! \brief Function to determine whether a string containing a type is a 16-bit floating point
+//! storage type i.e. half or bfloat16, which generated code converts to and from scalar to use
+//--------------------------------------------------------------------------
+GENN_EXPORT bool isTypeReducedPrecision(const std::string &type);
+
 //--------------------------------------------------------------------------
 //! \brief This function writes a floating point value to a stream -setting the precision so no digits are lost
 //--------------------------------------------------------------------------
@@ -84,4 +94,65 @@ std::string writePreciseString(T value)
     return s.str();
 }
 
+//--------------------------------------------------------------------------
+//! \brief Initial value for the 64-bit FNV-1a hashes updated by Utils::updateHash
+//--------------------------------------------------------------------------
+const uint64_t hashOffsetBasis = 14695981039346656037ull;
+
+//--------------------------------------------------------------------------
+//! \brief Hash bytes into 64-bit FNV-1a hash
+/*! Unlike std::hash, the resultant digest is the same across runs and standard libraries */
+//--------------------------------------------------------------------------
+inline void updateHash(const void *data, size_t size, uint64_t &hash)
+{
+    const unsigned char *bytes = static_cast<const unsigned char*>(data);
+    for(size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief Hash arithmetic or enumeration value
+//--------------------------------------------------------------------------
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type * = nullptr>
+void updateHash(const T &value, uint64_t &hash)
+{
+    updateHash(&value, sizeof(T), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Hash string
+//--------------------------------------------------------------------------
+inline void updateHash(const std::string &string, uint64_t &hash)
+{
+    // **NOTE** include size so concatenations of different strings hash differently
+    updateHash(string.size(), hash);
+    updateHash(string.data(), string.size(), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Hash vector of bools
+//--------------------------------------------------------------------------
+inline void updateHash(const std::vector<bool> &vector, uint64_t &hash)
+{
+    updateHash(vector.size(), hash);
+    for(bool v : vector) {
+        updateHash(v, hash);
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief Hash vector of any other hashable type
+/*! Types other than those supported above should provide an updateHash overload in their own namespace */
+//--------------------------------------------------------------------------
+template<typename T>
+void updateHash(const std::vector<T> &vector, uint64_t &hash)
+{
+    updateHash(vector.size(), hash);
+    for(const auto &v : vector) {
+        updateHash(v, hash);
+    }
+}
+
 }   // namespace Utils
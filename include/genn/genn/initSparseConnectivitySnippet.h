@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
 #include <functional>
 #include <vector>
 
@@ -25,6 +26,7 @@
 
 #define SET_CALC_MAX_ROW_LENGTH_FUNC(FUNC) virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const override{ return FUNC; }
 #define SET_CALC_MAX_COL_LENGTH_FUNC(FUNC) virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const override{ return FUNC; }
+#define SET_CALC_MAX_TOTAL_LENGTH_FUNC(FUNC) virtual CalcMaxTotalLengthFunc getCalcMaxTotalLengthFunc() const override{ return FUNC; }
 #define SET_CALC_KERNEL_SIZE_FUNC(...) virtual CalcKernelSizeFunc getCalcKernelSizeFunc() const override{ return __VA_ARGS__; }
 
 #define SET_MAX_ROW_LENGTH(MAX_ROW_LENGTH) virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const override{ return [](unsigned int, unsigned int, const std::vector<double> &){ return MAX_ROW_LENGTH; }; }
@@ -43,6 +45,7 @@ public:
     // Typedefines
     //----------------------------------------------------------------------------
     typedef std::function<unsigned int(unsigned int, unsigned int, const std::vector<double> &)> CalcMaxLengthFunc;
+    typedef std::function<size_t(unsigned int, unsigned int, const std::vector<double> &)> CalcMaxTotalLengthFunc;
     typedef std::function<std::vector<unsigned int>(const std::vector<double> &)> CalcKernelSizeFunc;
 
     //----------------------------------------------------------------------------
@@ -62,6 +65,11 @@ public:
     //! Get function to calculate the maximum column length of this connector based on the parameters and the size of the pre and postsynaptic population
     virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const{ return CalcMaxLengthFunc(); }
 
+    //! Get function to calculate the maximum total number of synapses this connector creates based on the parameters and the size of the pre and postsynaptic population
+    /*! This is only used to size compact sparse connectivity (see SynapseGroup::setCompactSparseEnabled) and,
+        if it is not provided, the number of presynaptic neurons multiplied by the maximum row length is used */
+    virtual CalcMaxTotalLengthFunc getCalcMaxTotalLengthFunc() const{ return CalcMaxTotalLengthFunc(); }
+
     //! Get function to calculate kernel size required for this conenctor based on its parameters
     virtual CalcKernelSizeFunc getCalcKernelSizeFunc() const{ return CalcKernelSizeFunc(); }
 
@@ -70,6 +78,9 @@ public:
     //------------------------------------------------------------------------
     //! Can this sparse connectivity init snippet be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Get hash digest which is equal for sparse connectivity init snippets that canBeMerged
+    uint64_t getHashDigest() const;
 };
 
 //----------------------------------------------------------------------------
@@ -142,6 +153,17 @@ public:
 
             return binomialInverseCDF(quantile, numPre, pars[0]);
         });
+    SET_CALC_MAX_TOTAL_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            // The total number of synapses is distributed binomially with n=numPre*numPost and p=prob. As n is typically far
+            // too large to invert the CDF directly, use the normal approximation with a 6 sigma margin and a little extra
+            // headroom for the small-n case where this approximation is poor - rows are built with this as their capacity
+            const double n = (double)numPre * (double)numPost;
+            const double mean = n * pars[0];
+            const double sd = sqrt(mean * (1.0 - pars[0]));
+            return (size_t)std::min(n, ceil(mean + (6.0 * sd)) + 16.0);
+        });
 };
 
 //----------------------------------------------------------------------------
@@ -349,6 +371,12 @@ public:
             // probability of being selected and the number of synapses in the sub-row is binomially distributed
             return binomialInverseCDF(quantile, (unsigned int)pars[0], (double)numPre / ((double)numPre * (double)numPost));
         });
+
+    SET_CALC_MAX_TOTAL_LENGTH_FUNC(
+        [](unsigned int, unsigned int, const std::vector<double> &pars)
+        {
+            return (size_t)pars[0];
+        });
 };
 
 //----------------------------------------------------------------------------
@@ -389,6 +417,12 @@ public:
         {
             return (unsigned int)pars[0];
         });
+
+    SET_CALC_MAX_TOTAL_LENGTH_FUNC(
+        [](unsigned int, unsigned int numPost, const std::vector<double> &pars)
+        {
+            return (size_t)numPost * (size_t)pars[0];
+        });
 };
 
 //----------------------------------------------------------------------------
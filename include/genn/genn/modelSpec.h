@@ -142,6 +142,12 @@ public:
     //! Set whether timers and timing commands are to be included
     void setTiming(bool timingEnabled){ m_TimingEnabled = timingEnabled; }
 
+    //! Set whether saveCheckpoint and loadCheckpoint functions should be generated
+    /*! Checkpoints save all model state except the contents of pointer extra global parameters,
+        whose sizes are only known to user code so they must be re-allocated and pushed after loading.
+        Code generation fails if the backend does not support checkpoints. */
+    void setCheckpointingEnabled(bool enabled){ m_CheckpointingEnabled = enabled; }
+
     //! Set the random seed (disables automatic seeding if argument not 0).
     void setSeed(unsigned int rngSeed){ m_Seed = rngSeed; }
 
@@ -164,6 +170,12 @@ public:
     /*! This can significantly reduce the cost of updating neuron population but means that per-synapse group inSyn arrays can not be retrieved */
     void setMergePostsynapticModels(bool merge){ m_ShouldMergePostsynapticModels = merge; }
 
+    //! Set how many instances of the model should be simulated in a single batch
+    /*! Each instance has its own copy of all neuron, current source, postsynaptic model and non-READ_ONLY
+        weight update model state but sparse connectivity and READ_ONLY weight update model variables are shared.
+        Instance b of a variable with n elements per instance is stored at offset b * n of the variable's array. */
+    void setBatchSize(unsigned int batchSize);
+
     //! Gets the name of the neuronal network model
     const std::string &getName() const{ return m_Name; }
 
@@ -182,6 +194,12 @@ public:
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return m_TimingEnabled; }
 
+    //! Should saveCheckpoint and loadCheckpoint functions be generated
+    bool isCheckpointingEnabled() const{ return m_CheckpointingEnabled; }
+
+    //! Gets how many instances of the model are simulated in a single batch
+    unsigned int getBatchSize() const{ return m_BatchSize; }
+
     // PUBLIC NEURON FUNCTIONS
     //========================
     //! How many neurons make up the entire model
@@ -507,6 +525,9 @@ protected:
     //! Is recording enabled on any population in this model?
     bool isRecordingInUse() const;
 
+    //! Are any variables in any populations in this model stored using reduced precision types?
+    bool isReducedPrecisionInUse() const;
+
     //! Get std::map containing local named NeuronGroup objects in model
     const std::map<std::string, NeuronGroupInternal> &getNeuronGroups() const{ return m_LocalNeuronGroups; }
 
@@ -554,6 +575,9 @@ private:
     //! Whether timing code should be inserted into model
     bool m_TimingEnabled;
 
+    //! Whether checkpoint functions should be generated
+    bool m_CheckpointingEnabled;
+
     //! RNG seed
     unsigned int m_Seed;
 
@@ -572,6 +596,9 @@ private:
     //! Should compatible postsynaptic models and dendritic delay buffers be merged?
     /*! This can significantly reduce the cost of updating neuron population but means that per-synapse group inSyn arrays can not be retrieved */
     bool m_ShouldMergePostsynapticModels; 
+
+    //! How many instances of the model are simulated in a single batch
+    unsigned int m_BatchSize;
 };
 
 // Typedefine NNmodel for backward compatibility
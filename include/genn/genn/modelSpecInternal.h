@@ -23,4 +23,5 @@ public:
 
     using ModelSpec::zeroCopyInUse;
     using ModelSpec::isRecordingInUse;
+    using ModelSpec::isReducedPrecisionInUse;
 };
@@ -160,6 +160,13 @@ public:
             return ((name == other.name) && (type == other.type) && (access == other.access));
         }
 
+        friend void updateHash(const Var &v, uint64_t &hash)
+        {
+            Utils::updateHash(v.name, hash);
+            Utils::updateHash(v.type, hash);
+            Utils::updateHash(v.access, hash);
+        }
+
         std::string name;
         std::string type;
         VarAccess access;
@@ -195,5 +202,12 @@ protected:
         return (Snippet::Base::canBeMerged(other)
                 && (getVars() == other->getVars()));
     }
+
+    //! Update hash with everything canBeMerged compares
+    void updateHash(uint64_t &hash) const
+    {
+        Snippet::Base::updateHash(hash);
+        Utils::updateHash(getVars(), hash);
+    }
 };
 } // Models
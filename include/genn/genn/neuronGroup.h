@@ -117,6 +117,10 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set value of neuron model parameter in each instance of a batched model
+    /*! values must contain one value for each instance of the model */
+    void setBatchParamValues(const std::string &paramName, const std::vector<double> &values);
+
     //! Enables and disable spike recording for this population
     void setSpikeRecordingEnabled(bool enabled) { m_SpikeRecordingEnabled = enabled; }
     
@@ -224,7 +228,7 @@ protected:
     void addInSyn(SynapseGroupInternal *synapseGroup){ m_InSyn.push_back(synapseGroup); }
     void addOutSyn(SynapseGroupInternal *synapseGroup){ m_OutSyn.push_back(synapseGroup); }
 
-    void initDerivedParams(double dt);
+    void initDerivedParams(double dt, unsigned int batchSize);
 
     //! Merge incoming postsynaptic models
     void mergeIncomingPSM(bool merge);
@@ -247,6 +251,12 @@ protected:
 
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
 
+    //! Gets parameters of each instance of a batched model (empty if all instances use getParams())
+    const std::vector<std::vector<double>> &getBatchParams() const{ return m_BatchParams; }
+
+    //! Gets derived parameters of each instance of a batched model (empty if all instances use getDerivedParams())
+    const std::vector<std::vector<double>> &getBatchDerivedParams() const{ return m_BatchDerivedParams; }
+
     const std::set<SpikeEventThreshold> &getSpikeEventCondition() const{ return m_SpikeEventCondition; }
 
     //! Helper to get vector of incoming synapse groups which have postsynaptic update code
@@ -272,6 +282,14 @@ protected:
     /*! NOTE: this can only be called after model is finalized */
     bool canInitBeMerged(const NeuronGroup &other) const;
 
+    //! Get hash digest which is equal for neuron groups that canBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getHashDigest() const;
+
+    //! Get hash digest which is equal for neuron groups whose initialisation canInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getInitHashDigest() const;
+
 private:
     //------------------------------------------------------------------------
     // Private methods
@@ -289,6 +307,13 @@ private:
     const NeuronModels::Base *m_NeuronModel;
     const std::vector<double> m_Params;
     std::vector<double> m_DerivedParams;
+
+    //! Per-instance values of parameters, indexed by parameter
+    std::map<size_t, std::vector<double>> m_BatchParamValues;
+
+    //! Parameters and derived parameters of each instance of a batched model with per-instance parameter values
+    std::vector<std::vector<double>> m_BatchParams;
+    std::vector<std::vector<double>> m_BatchDerivedParams;
     std::vector<Models::VarInit> m_VarInitialisers;
     std::vector<SynapseGroupInternal*> m_InSyn;
     std::vector<SynapseGroupInternal*> m_OutSyn;
@@ -31,6 +31,8 @@ public:
     using NeuronGroup::getOutSyn;
     using NeuronGroup::getCurrentSources;
     using NeuronGroup::getDerivedParams;
+    using NeuronGroup::getBatchParams;
+    using NeuronGroup::getBatchDerivedParams;
     using NeuronGroup::getSpikeEventCondition;
     using NeuronGroup::getInSynWithPostCode;
     using NeuronGroup::getOutSynWithPreCode;
@@ -39,4 +41,6 @@ public:
     using NeuronGroup::isVarQueueRequired;
     using NeuronGroup::canBeMerged;
     using NeuronGroup::canInitBeMerged;
+    using NeuronGroup::getHashDigest;
+    using NeuronGroup::getInitHashDigest;
 };
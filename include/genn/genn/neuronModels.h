@@ -65,6 +65,9 @@ public:
     //----------------------------------------------------------------------------
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Get hash digest which is equal for neuron models that canBeMerged
+    uint64_t getHashDigest() const;
 };
 
 //----------------------------------------------------------------------------
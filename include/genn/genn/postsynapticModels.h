@@ -35,6 +35,9 @@ public:
     //----------------------------------------------------------------------------
     //! Can this postsynaptic model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Get hash digest which is equal for postsynaptic models that canBeMerged
+    uint64_t getHashDigest() const;
 };
 
 //----------------------------------------------------------------------------
@@ -129,6 +129,12 @@ public:
             return ((name == other.name) && (type == other.type));
         }
 
+        friend void updateHash(const EGP &e, uint64_t &hash)
+        {
+            Utils::updateHash(e.name, hash);
+            Utils::updateHash(e.type, hash);
+        }
+
         std::string name;
         std::string type;
     };
@@ -148,6 +154,13 @@ public:
             return ((name == other.name) && (type == other.type) && (value == other.value));
         }
 
+        friend void updateHash(const ParamVal &p, uint64_t &hash)
+        {
+            Utils::updateHash(p.name, hash);
+            Utils::updateHash(p.type, hash);
+            Utils::updateHash(p.value, hash);
+        }
+
         std::string name;
         std::string type;
         std::string value;
@@ -161,6 +174,12 @@ public:
             return (name == other.name);
         }
 
+        //! **NOTE** like operator ==, only hashes name
+        friend void updateHash(const DerivedParam &d, uint64_t &hash)
+        {
+            Utils::updateHash(d.name, hash);
+        }
+
         std::string name;
         std::function<double(const std::vector<double> &, double)> func;
     };
@@ -209,6 +228,14 @@ protected:
                 && (getExtraGlobalParams() == other->getExtraGlobalParams()));
     }
 
+    //! Update hash with everything canBeMerged compares
+    void updateHash(uint64_t &hash) const
+    {
+        Utils::updateHash(getParamNames(), hash);
+        Utils::updateHash(getDerivedParams(), hash);
+        Utils::updateHash(getExtraGlobalParams(), hash);
+    }
+
     //------------------------------------------------------------------------
     // Protected static helpers
     //------------------------------------------------------------------------
@@ -264,6 +291,17 @@ public:
         return getSnippet()->canBeMerged(other.getSnippet());
     }
 
+    //! Get hash digest which is equal for initialisers that canBeMerged
+    uint64_t getHashDigest() const
+    {
+        return getSnippet()->getHashDigest();
+    }
+
+    friend void updateHash(const Init<SnippetBase> &init, uint64_t &hash)
+    {
+        Utils::updateHash(init.getHashDigest(), hash);
+    }
+
 private:
     //----------------------------------------------------------------------------
     // Members
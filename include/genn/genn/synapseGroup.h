@@ -56,6 +56,11 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setWUExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set value of weight update model parameter in each instance of a batched model
+    /*! values must contain one value for each instance of the model. Parameters referenced
+        in event threshold conditions are used to merge them so can't be set per-instance */
+    void setWUBatchParamValues(const std::string &paramName, const std::vector<double> &values);
+
     //! Set location of postsynaptic model state variable
     /*! This is ignored for simulations on hardware with a single memory space */
     void setPSVarLocation(const std::string &varName, VarLocation loc);
@@ -100,12 +105,35 @@ public:
     // **TODO** this shouldn't be in SynapseGroup - it's backend-specific
     void setNumThreadsPerSpike(unsigned int numThreadsPerSpike);
 
+    //! Set how many postsynaptic neurons each tile processed by CPU implementation contains
+    /*! Sparse connectivity is then processed one tile at a time so that the block of postsynaptic input
+        being accumulated stays in cache. Zero (default) disables tiling. Rows of sparse connectivity
+        must be sorted by postsynaptic index - as they are when built by connectivity initialisation snippets. */
+    void setPostsynapticTileSize(unsigned int postsynapticTileSize);
+
     //! Sets the number of delay steps used to delay postsynaptic spikes travelling back along dendrites to synapses
     void setBackPropDelaySteps(unsigned int timesteps);
 
     //! Enables or disables using narrow i.e. less than 32-bit types for sparse matrix indices
     void setNarrowSparseIndEnabled(bool enabled);
 
+    //! Enables or disables storing sparse connectivity compactly, without padding each row to the maximum row length
+    /*! Rows are instead stored contiguously and located using an additional array of row start offsets which is built,
+        alongside the connectivity, by counting and then filling each row. This is only supported by the CPU backends
+        and requires connectivity to be initialised using a sparse connectivity initialisation snippet. */
+    void setCompactSparseEnabled(bool enabled);
+
+    //! Enables or disables additionally storing sparse matrix indices as deltas between successive postsynaptic indices
+    /*! The CPU backends then read these narrow deltas rather than the full indices when propagating presynaptic
+        events, reading the full index only when a delta is too large to represent. Rows of sparse connectivity
+        must be sorted by postsynaptic index - as they are when built by connectivity initialisation snippets. */
+    void setDeltaSparseIndEnabled(bool enabled);
+
+    //! Enables or disables storing the presynaptic index of each synapse alongside the column-major remapping used for postsynaptic learning
+    /*! The CPU backends then read presynaptic indices from this array when running postsynaptic learning code rather than
+        calculating them from each synapse's row-major index, at the cost of an additional index per synapse. */
+    void setRemapPreIndEnabled(bool enabled);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -113,10 +141,15 @@ public:
 
     SpanType getSpanType() const{ return m_SpanType; }
     unsigned int getNumThreadsPerSpike() const{ return m_NumThreadsPerSpike; }
+    unsigned int getPostsynapticTileSize() const;
+    bool isCompactSparseEnabled() const;
+    bool isDeltaSparseIndEnabled() const;
+    bool isRemapPreIndEnabled() const;
     unsigned int getDelaySteps() const{ return m_DelaySteps; }
     unsigned int getBackPropDelaySteps() const{ return m_BackPropDelaySteps; }
     unsigned int getMaxConnections() const;
     unsigned int getMaxSourceConnections() const;
+    size_t getMaxTotalConnections() const;
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps; }
     SynapseMatrixType getMatrixType() const{ return m_MatrixType; }
     const std::vector<unsigned int> &getKernelSize() const { return m_KernelSize; }
@@ -254,7 +287,7 @@ protected:
         m_PSModelTargetName = targetName;
     }
     
-    void initDerivedParams(double dt);
+    void initDerivedParams(double dt, unsigned int batchSize);
 
     //------------------------------------------------------------------------
     // Protected const methods
@@ -265,6 +298,12 @@ protected:
     const std::vector<double> &getWUDerivedParams() const{ return m_WUDerivedParams; }
     const std::vector<double> &getPSDerivedParams() const{ return m_PSDerivedParams; }
 
+    //! Gets weight update model parameters of each instance of a batched model (empty if all instances use getWUParams())
+    const std::vector<std::vector<double>> &getWUBatchParams() const{ return m_WUBatchParams; }
+
+    //! Gets weight update model derived parameters of each instance of a batched model (empty if all instances use getWUDerivedParams())
+    const std::vector<std::vector<double>> &getWUBatchDerivedParams() const{ return m_WUBatchDerivedParams; }
+
     const SynapseGroupInternal *getWeightSharingMaster() const { return m_WeightSharingMaster; }
 
     //!< Does the event threshold needs to be retested in the synapse kernel?
@@ -277,6 +316,15 @@ protected:
     //! Get the type to use for sparse connectivity indices for synapse group
     std::string getSparseIndType() const;
 
+    //! Get the type to use for row start offsets of compact sparse connectivity for synapse group
+    std::string getSparseRowPtrType() const;
+
+    //! Get the type to use for deltas between successive sparse connectivity indices for synapse group
+    std::string getSparseIndDeltaType() const;
+
+    //! Get the type to use for presynaptic indices stored alongside column-major remapping for synapse group
+    std::string getRemapPreIndType() const;
+
     //! Can weight update component of this synapse group be merged with other? i.e. can they be simulated using same generated code
     /*! NOTE: this can only be called after model is finalized */
     bool canWUBeMerged(const SynapseGroup &other) const;
@@ -321,6 +369,46 @@ protected:
     /*! NOTE: this can only be called after model is finalized */
     bool canConnectivityHostInitBeMerged(const SynapseGroup &other) const;
 
+    //! Get hash digest which is equal for synapse groups whose weight update components canWUBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getWUHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose presynaptic updates canWUPreBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getWUPreHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose postsynaptic updates canWUPostBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getWUPostHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose postsynaptic models canPSBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getPSHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose initialisation canWUInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getWUInitHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose presynaptic variable initialisation canWUPreInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getWUPreInitHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose postsynaptic variable initialisation canWUPostInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getWUPostInitHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose postsynaptic initialisation canPSInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getPSInitHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose connectivity initialisation canConnectivityInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getConnectivityInitHashDigest() const;
+
+    //! Get hash digest which is equal for synapse groups whose connectivity host initialisation canConnectivityHostInitBeMerged
+    /*! NOTE: this can only be called after model is finalized */
+    uint64_t getConnectivityHostInitHashDigest() const;
+
 private:
     //------------------------------------------------------------------------
     // Members
@@ -334,6 +422,9 @@ private:
     //! How many threads CUDA implementation uses to process each spike when span type is PRESYNAPTIC
     unsigned int m_NumThreadsPerSpike;
 
+    //! Number of postsynaptic neurons in each tile processed by CPU implementation (0 if tiling is disabled)
+    unsigned int m_PostsynapticTileSize;
+
     //! Global synaptic conductance delay for the group (in time steps)
     unsigned int m_DelaySteps;
 
@@ -371,6 +462,15 @@ private:
     //! Should narrow i.e. less than 32-bit types be used for sparse matrix indices
     bool m_NarrowSparseIndEnabled;
 
+    //! Should sparse connectivity be stored compactly rather than padded to the maximum row length
+    bool m_CompactSparseEnabled;
+
+    //! Should sparse matrix indices additionally be stored as deltas between successive postsynaptic indices
+    bool m_DeltaSparseIndEnabled;
+
+    //! Should presynaptic indices be stored alongside column-major remapping used for postsynaptic learning
+    bool m_RemapPreIndEnabled;
+
     //! Variable mode used for variables used to combine input from this synapse group
     VarLocation m_InSynLocation;
 
@@ -386,6 +486,13 @@ private:
     //! Derived parameters for weight update model
     std::vector<double> m_WUDerivedParams;
 
+    //! Per-instance values of weight update model parameters, indexed by parameter
+    std::map<size_t, std::vector<double>> m_WUBatchParamValues;
+
+    //! Weight update model parameters and derived parameters of each instance of a batched model with per-instance parameter values
+    std::vector<std::vector<double>> m_WUBatchParams;
+    std::vector<std::vector<double>> m_WUBatchDerivedParams;
+
     //! Initialisers for weight update model per-synapse variables
     std::vector<Models::VarInit> m_WUVarInitialisers;
 
@@ -31,6 +31,8 @@ public:
     using SynapseGroup::getWeightSharingMaster;
     using SynapseGroup::getWUDerivedParams;
     using SynapseGroup::getPSDerivedParams;
+    using SynapseGroup::getWUBatchParams;
+    using SynapseGroup::getWUBatchDerivedParams;
     using SynapseGroup::setEventThresholdReTestRequired;
     using SynapseGroup::setPSModelMergeTarget;
     using SynapseGroup::initDerivedParams;
@@ -38,6 +40,9 @@ public:
     using SynapseGroup::getPSModelTargetName;
     using SynapseGroup::isPSModelMerged;
     using SynapseGroup::getSparseIndType;
+    using SynapseGroup::getSparseRowPtrType;
+    using SynapseGroup::getSparseIndDeltaType;
+    using SynapseGroup::getRemapPreIndType;
     using SynapseGroup::canWUBeMerged;
     using SynapseGroup::canWUPreBeMerged;
     using SynapseGroup::canWUPostBeMerged;
@@ -49,4 +54,14 @@ public:
     using SynapseGroup::canPSInitBeMerged;
     using SynapseGroup::canConnectivityInitBeMerged;
     using SynapseGroup::canConnectivityHostInitBeMerged;
+    using SynapseGroup::getWUHashDigest;
+    using SynapseGroup::getWUPreHashDigest;
+    using SynapseGroup::getWUPostHashDigest;
+    using SynapseGroup::getPSHashDigest;
+    using SynapseGroup::getWUInitHashDigest;
+    using SynapseGroup::getWUPreInitHashDigest;
+    using SynapseGroup::getWUPostInitHashDigest;
+    using SynapseGroup::getPSInitHashDigest;
+    using SynapseGroup::getConnectivityInitHashDigest;
+    using SynapseGroup::getConnectivityHostInitHashDigest;
 };
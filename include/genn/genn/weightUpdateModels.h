@@ -151,6 +151,9 @@ public:
 
     //! Can this weight update model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Get hash digest which is equal for weight update models that canBeMerged
+    uint64_t getHashDigest() const;
 };
 
 //----------------------------------------------------------------------------
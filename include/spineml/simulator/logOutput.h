@@ -2,6 +2,7 @@
 
 // Standard C++ includes
 #include <fstream>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -11,6 +12,11 @@
 #include "networkClient.h"
 
 // Forward declarations
+namespace BinaryRecording
+{
+    class Writer;
+}
+
 namespace pugi
 {
     class xml_node;
@@ -49,6 +55,7 @@ protected:
         return (timestep >= m_StartTimeStep && timestep < m_EndTimeStep);
     }
 
+    unsigned long long getStartTimestep() const{ return m_StartTimeStep; }
     unsigned long long getEndTimestep() const{ return m_EndTimeStep; }
 
 private:
@@ -122,6 +129,34 @@ private:
     std::vector<scalar> m_OutputBuffer;
 };
 
+//----------------------------------------------------------------------------
+// SpineMLSimulator::LogOutput::AnalogueBinaryFile
+//----------------------------------------------------------------------------
+//! Analogue log written to a memory-mappable binary recording file rather than a raw binary file and XML report
+class AnalogueBinaryFile : public AnalogueBase
+{
+public:
+    AnalogueBinaryFile(const pugi::xml_node &node, double dt, unsigned int popSize,
+                       const filesystem::path &logPath,
+                       const ModelProperty::Base *modelProperty);
+    virtual ~AnalogueBinaryFile();
+
+    //----------------------------------------------------------------------------
+    // Base virtuals
+    //----------------------------------------------------------------------------
+    // Record any data required during this timestep
+    virtual void record(double dt, unsigned long long timestep) override;
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::unique_ptr<BinaryRecording::Writer> m_Writer;
+
+    // Buffer used, if indices are in use, to store contiguous output data
+    std::vector<scalar> m_OutputBuffer;
+};
+
 //----------------------------------------------------------------------------
 // SpineMLSimulator::LogOutput::AnalogueNetwork
 //----------------------------------------------------------------------------
@@ -219,5 +254,44 @@ private:
 
     std::set<unsigned int> m_Indices;
 };
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::LogOutput::EventBinaryFile
+//----------------------------------------------------------------------------
+//! Event log written to a memory-mappable binary recording file rather than a CSV file and XML report
+class EventBinaryFile : public Base
+{
+public:
+    EventBinaryFile(const pugi::xml_node &node, double dt, unsigned int popSize,
+                    const filesystem::path &logPath, unsigned int *spikeQueuePtr,
+                    unsigned int *hostSpikeCount, unsigned int *hostSpikes,
+                    void (*pullCurrentSpikesFunc)(void));
+    virtual ~EventBinaryFile();
+
+    //----------------------------------------------------------------------------
+    // Base virtuals
+    //----------------------------------------------------------------------------
+    // Record any data required during this timestep
+    virtual void record(double dt, unsigned long long timestep) override;
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::unique_ptr<BinaryRecording::Writer> m_Writer;
+
+    const unsigned int m_PopSize;
+
+    unsigned int *m_SpikeQueuePtr;
+    unsigned int *m_HostSpikeCount;
+    unsigned int *m_HostSpikes;
+
+    void (*m_PullCurrentSpikesFunc)(void);
+
+    std::set<unsigned int> m_Indices;
+
+    // Buffer used, if indices are in use, to store spikes from indexed neurons
+    std::vector<unsigned int> m_OutputBuffer;
+};
 }   // namespace LogOutput
 }   // namespace SpineMLSimulator
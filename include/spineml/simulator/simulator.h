@@ -25,14 +25,17 @@ class Simulator
 {
 public:
     Simulator(plog::Severity logLevel = plog::warning);
-    Simulator(const std::string &experimentXML, const std::string &overrideOutputPath = "", plog::Severity logLevel = plog::warning);
+    Simulator(const std::string &experimentXML, const std::string &overrideOutputPath = "", plog::Severity logLevel = plog::warning,
+              bool binaryLogs = false);
     ~Simulator();
 
     //------------------------------------------------------------------------
     // Public API
     //------------------------------------------------------------------------
     //! Load model from XML file
-    void load(const std::string &experimentXML, const std::string &overrideOutputPath = "");
+    /*! If binaryLogs is set, logs written to file use the memory-mappable format
+        defined in binaryRecording.h rather than SpineML's binary/CSV files and XML reports */
+    void load(const std::string &experimentXML, const std::string &overrideOutputPath = "", bool binaryLogs = false);
 
     //! Advance simulation by one timestep
     void stepTime();
@@ -156,6 +159,9 @@ private:
     //! Duration of simulation in ms
     double m_DurationMs;
 
+    //! Should logs be written using memory-mappable binary recording format
+    bool m_BinaryLogs;
+
     //! Timing of various parts of simulation
     double m_InputMs;
     double m_SimulateMs;
@@ -0,0 +1,142 @@
+## @namespace pygenn.binary_recording
+"""
+This module provides functions for loading recordings written in GeNN's
+memory-mappable binary recording format (see userproject/include/binaryRecording.h)
+by the userproject recorders and the SpineML simulator
+"""
+from collections import namedtuple
+import numpy as np
+
+## Encodings used for data section
+SPIKE_BITMASK = 0
+SPIKE_LIST = 1
+ANALOGUE_FLOAT = 2
+ANALOGUE_DOUBLE = 3
+
+## Numpy type matching BinaryRecording::Header
+HEADER_DTYPE = np.dtype([("magic", "S8"), ("version", np.uint32),
+                         ("encoding", np.uint32), ("pop_size", np.uint32),
+                         ("num_columns", np.uint32), ("dt", np.float64),
+                         ("start_timestep", np.uint64),
+                         ("num_timesteps", np.uint64),
+                         ("data_offset", np.uint64),
+                         ("index_offset", np.uint64),
+                         ("columns_offset", np.uint64),
+                         ("name_length", np.uint32),
+                         ("padding", np.uint32)])
+
+VERSION = 1
+
+Recording = namedtuple("Recording", ["name", "encoding", "pop_size", "dt",
+                                     "start_timestep", "num_timesteps",
+                                     "columns", "data", "index"])
+Recording.__doc__ = """Contents of a binary recording
+
+    name            --  name of population recorded
+    encoding        --  one of SPIKE_BITMASK, SPIKE_LIST,
+                        ANALOGUE_FLOAT or ANALOGUE_DOUBLE
+    pop_size        --  number of neurons in population
+    dt              --  simulation timestep in ms
+    start_timestep  --  index of first timestep recorded
+    num_timesteps   --  number of timesteps recorded
+    columns         --  for analogue recordings, neuron index of each column
+    data            --  memory-mapped data: a (num_timesteps, words) array
+                        of uint32 for SPIKE_BITMASK recordings, a flat array
+                        of uint32 neuron ids for SPIKE_LIST recordings and
+                        a (num_timesteps, num_columns) array of values
+                        for analogue recordings
+    index           --  for SPIKE_LIST recordings, memory-mapped array of
+                        num_timesteps + 1 offsets into data of the
+                        start of each timestep's spikes"""
+
+def load_recording(filename):
+    """Memory-map a binary recording file
+
+    Args:
+    filename    --  path of recording file
+
+    Returns:
+    Recording whose data and index arrays are read-only views of the file
+    """
+    header = np.fromfile(filename, dtype=HEADER_DTYPE, count=1)
+    if header.shape[0] != 1 or header["magic"][0] != b"GENNREC":
+        raise Exception("'{0}' is not a binary recording file".format(filename))
+    header = header[0]
+    if header["version"] != VERSION:
+        raise Exception("'{0}' uses unsupported binary recording "
+                        "version {1}".format(filename, header["version"]))
+
+    # Read name which follows header
+    name_length = int(header["name_length"])
+    name = np.fromfile(filename, dtype=np.uint8, count=name_length,
+                       offset=HEADER_DTYPE.itemsize).tobytes().decode("utf-8")
+
+    encoding = int(header["encoding"])
+    pop_size = int(header["pop_size"])
+    num_columns = int(header["num_columns"])
+    num_timesteps = int(header["num_timesteps"])
+    data_offset = int(header["data_offset"])
+
+    # Map data section (numpy can't map zero-length arrays)
+    def memmap(dtype, offset, shape):
+        if np.prod(shape) == 0:
+            return np.zeros(shape, dtype=dtype)
+        else:
+            return np.memmap(filename, dtype=dtype, mode="r",
+                             offset=offset, shape=shape)
+
+    index = None
+    columns = None
+    if encoding == SPIKE_BITMASK:
+        data = memmap(np.uint32, data_offset, (num_timesteps, num_columns))
+    elif encoding == SPIKE_LIST:
+        index = memmap(np.uint64, int(header["index_offset"]),
+                       (num_timesteps + 1,))
+        data = memmap(np.uint32, data_offset, (int(index[-1]),))
+    elif encoding == ANALOGUE_FLOAT or encoding == ANALOGUE_DOUBLE:
+        dtype = np.float32 if encoding == ANALOGUE_FLOAT else np.float64
+        data = memmap(dtype, data_offset, (num_timesteps, num_columns))
+
+        # Read column table or calculate default column neuron indices
+        columns_offset = int(header["columns_offset"])
+        if columns_offset == 0:
+            columns = np.arange(num_columns, dtype=np.uint32) % pop_size
+        else:
+            columns = np.fromfile(filename, dtype=np.uint32,
+                                  count=num_columns, offset=columns_offset)
+    else:
+        raise Exception("'{0}' uses unknown encoding "
+                        "{1}".format(filename, encoding))
+
+    return Recording(name, encoding, pop_size, float(header["dt"]),
+                     int(header["start_timestep"]), num_timesteps,
+                     columns, data, index)
+
+def load_spikes(filename):
+    """Load spikes from a binary recording file
+
+    Args:
+    filename    --  path of spike recording file
+
+    Returns:
+    tuple containing arrays of spike times (in ms) and neuron ids
+    """
+    recording = load_recording(filename)
+
+    if recording.encoding == SPIKE_LIST:
+        # Repeat each timestep once for each of its spikes
+        timesteps = np.repeat(np.arange(recording.num_timesteps),
+                              np.diff(recording.index.astype(np.int64)))
+        ids = np.asarray(recording.data)
+    elif recording.encoding == SPIKE_BITMASK:
+        # Unpack bitmask words into one byte per bit
+        data_bytes = recording.data.view(dtype=np.uint8)
+        data_unpack = np.unpackbits(data_bytes, axis=1,
+                                    count=recording.pop_size,
+                                    bitorder="little")
+        timesteps, ids = np.where(data_unpack == 1)
+    else:
+        raise Exception("'{0}' is not a spike recording".format(filename))
+
+    spike_times = (recording.start_timestep + timesteps) * recording.dt
+    return spike_times, ids
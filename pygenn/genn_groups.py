@@ -2,18 +2,15 @@
 This module provides classes which automate model checks and parameter
 conversions for GeNN Groups
 """
-try:
-    xrange
-except NameError:  # Python 3
-    xrange = range
-
 from weakref import proxy
 from deprecated import deprecated
 from six import iteritems
 import numpy as np
 from . import genn_wrapper
 from . import model_preprocessor
+from .genn_wrapper import SharedLibraryModelNumpy as slm
 from .model_preprocessor import ExtraGlobalVariable, Variable
+from .genn_wrapper.StlContainers import DoubleVector
 from .genn_wrapper import (SynapseMatrixConnectivity_SPARSE,
                            SynapseMatrixConnectivity_BITMASK,
                            SynapseMatrixConnectivity_DENSE,
@@ -137,6 +134,26 @@ class Group(object):
         return self._model.genn_types[var_type].assign_ext_ptr_array(
             internal_var_name, var_size)
 
+    def _assign_ext_ptr_array_batched(self, var_name, var_size, var_type):
+        """Assign a variable with a copy per instance of
+        a batched model to an external numpy array
+
+        Args:
+        var_name    --  string a fully qualified name of the variable to assign
+        var_size    --  int the size of each instance of the variable
+        var_type    --  string type of the variable
+
+        Returns numpy array of type var_type with a row
+        per instance if the model is batched
+        """
+        batch_size = self._model.batch_size
+        array = self._assign_ext_ptr_array(var_name, var_size * batch_size,
+                                           var_type)
+        if batch_size > 1:
+            return np.reshape(array, (batch_size, var_size))
+        else:
+            return array
+
     def _assign_ext_ptr_single(self, var_name, var_type):
         """Assign a variable to an external scalar value containing one element
 
@@ -180,10 +197,11 @@ class Group(object):
             var_loc = get_location_fn(var_name) 
             if (var_loc & VarLocation_HOST) != 0:
                 # Get view
-                var_data.view = self._assign_ext_ptr_array(var_name, size,
-                                                           var_data.type)
+                var_data.view = self._assign_ext_ptr_array_batched(
+                    var_name, size, var_data.type)
 
                 # If manual initialisation is required, copy over variables
+                # **NOTE** values are broadcast to every instance of a batched model
                 if var_data.init_required:
                     var_data.view[:] = var_data.values
             else:
@@ -266,15 +284,29 @@ class NeuronGroup(Group):
 
     @property
     def current_spikes(self):
-        """Current spikes from GeNN"""
+        """Current spikes from GeNN, a list with
+        an array per instance if the model is batched"""
         offset = self.spike_que_ptr[0] * self.size
-        return self.spikes[
-            offset:offset + self.spike_count[self.spike_que_ptr[0]]]
+        if self._model.batch_size > 1:
+            return [s[offset:offset + c[self.spike_que_ptr[0]]]
+                    for s, c in zip(self.spikes, self.spike_count)]
+        else:
+            return self.spikes[
+                offset:offset + self.spike_count[self.spike_que_ptr[0]]]
 
     @property
     def spike_recording_data(self):
+        """Times and indices of recorded spikes, a list with
+        a tuple per instance if the model is batched"""
+        if self._model.batch_size > 1:
+            return [self._get_spike_recording_data(d)
+                    for d in self._spike_recording_data]
+        else:
+            return self._get_spike_recording_data(self._spike_recording_data)
+
+    def _get_spike_recording_data(self, data):
         # Get byte view of data
-        data_bytes = self._spike_recording_data.view(dtype=np.uint8)
+        data_bytes = data.view(dtype=np.uint8)
         
         # Reshape view so there's a row per timestep and a column per byte
         data_bytes = np.reshape(data_bytes, (-1, self._spike_recording_words * 4))
@@ -363,6 +395,18 @@ class NeuronGroup(Group):
         """
         self._set_extra_global_param(param_name, param_values, self.neuron)
 
+    def set_batch_param_values(self, param_name, values):
+        """Set a different value of a parameter for
+        each instance of a batched model
+
+        Args:
+        param_name  --  string with the name of the parameter
+        values      --  iterable with a value for each instance
+        """
+        if self._model._built:
+            raise Exception("GeNN model already built")
+        self.pop.set_batch_param_values(param_name, DoubleVector(values))
+
     def pull_spikes_from_device(self):
         """Wrapper around GeNNModel.pull_spikes_from_device"""
         self._model.pull_spikes_from_device(self.name)
@@ -383,12 +427,10 @@ class NeuronGroup(Group):
         """Loads neuron group"""
         # If spike data is present on the host
         if (self.pop.get_spike_location() & VarLocation_HOST) != 0:
-            self.spikes = self._assign_ext_ptr_array("glbSpk", 
-                                                    self.size * self.delay_slots,
-                                                    "unsigned int")
-            self.spike_count = self._assign_ext_ptr_array("glbSpkCnt", 
-                                                        self.delay_slots, 
-                                                        "unsigned int")
+            self.spikes = self._assign_ext_ptr_array_batched(
+                "glbSpk", self.size * self.delay_slots, "unsigned int")
+            self.spike_count = self._assign_ext_ptr_array_batched(
+                "glbSpkCnt", self.delay_slots, "unsigned int")
 
         # If spike recording is enabled
         if self.spike_recording_enabled:
@@ -396,9 +438,8 @@ class NeuronGroup(Group):
             recording_words = self._spike_recording_words * num_recording_timesteps
 
             # Assign pointer to recording data
-            self._spike_recording_data = self._assign_ext_ptr_array("recordSpk",
-                                                                    recording_words,
-                                                                    "uint32_t")
+            self._spike_recording_data = self._assign_ext_ptr_array_batched(
+                "recordSpk", recording_words, "uint32_t")
         if self.delay_slots > 1:
             self.spike_que_ptr = self._model._slm.assign_external_pointer_single_ui(
                 "spkQuePtr" + self.name)
@@ -538,7 +579,20 @@ class SynapseGroup(Group):
 
         self.psm_vars.update(var_dict)
 
-    def get_var_values(self, var_name):
+    def get_var_values(self, var_name, num_threads=1):
+        """Get values of weight update model variable
+
+        Args:
+        var_name    --  string with the name of the variable
+
+        Keyword args:
+        num_threads --  number of threads to use when compacting
+                        ragged format variables
+
+        Returns:
+        ndarray of variable values in the same order as
+        get_sparse_pre_inds and get_sparse_post_inds
+        """
         if self.weight_sharing_master is not None:
             raise Exception("when weight sharing is used, get_var_values"
                             "can only be used on the 'master' population")
@@ -546,22 +600,25 @@ class SynapseGroup(Group):
             var_view = self.vars[var_name].view
 
             if self.is_dense:
-                return np.copy(var_view)
+                values = np.copy(var_view)
             elif self.is_ragged:
-                max_rl = self.max_row_length
                 row_ls = self.row_lengths if self.connectivity_initialiser is None else self._row_lengths
 
-                # Create range containing the index where each row starts in ind
-                row_start_idx = xrange(0, self.weight_update_var_size, max_rl)
-
-                # Build list of subviews representing each row
-                rows = [var_view[i:i + r] for i, r in zip(row_start_idx, row_ls)]
-
-                # Stack all rows together into single array
-                return np.hstack(rows)
+                # Copy rows from padded variable into compact array,
+                # stacking the instances of a batched model into rows
+                if self._model.batch_size > 1:
+                    values = np.stack([self._compact_ragged(v, row_ls, num_threads)
+                                       for v in var_view])
+                else:
+                    values = self._compact_ragged(var_view, row_ls, num_threads)
             else:
                 raise Exception("Matrix format not supported")
 
+            # **NOTE** bfloat16 variables are viewed as raw bit patterns
+            if self.vars[var_name].type == "bfloat16":
+                values = model_preprocessor.bfloat16_to_float(values)
+            return values
+
     @property
     def is_connectivity_init_required(self):
         return (self.weight_sharing_master is None 
@@ -621,47 +678,126 @@ class SynapseGroup(Group):
         individual postsynaptic model variables"""
         return (self.matrix_type & SynapseMatrixWeight_INDIVIDUAL_PSM) != 0
 
-    def set_sparse_connections(self, pre_indices, post_indices):
+    def set_sparse_connections(self, pre_indices, post_indices,
+                               num_threads=1):
         """Set ragged format connections between two groups of neurons
 
+        Connections are sorted into rows by presynaptic index and, within
+        each row, by postsynaptic index. Any weight update model variable
+        values are reordered in the same way when the model is loaded
+
         Args:
         pre_indices     --  ndarray of presynaptic indices
         post_indices    --  ndarray of postsynaptic indices
+
+        Keyword args:
+        num_threads     --  number of threads to use when sorting
         """
         if self.weight_sharing_master is not None:
             raise Exception("when weight sharing is used, set_sparse_connections"
                             "can only be used on the 'master' population")
         elif self.is_ragged:
-            # Lexically sort indices
-            self.synapse_order = np.lexsort((post_indices, pre_indices))
-
-            # Count synapses
-            self._num_synapses = len(post_indices)
+            # Check indices before casting them so negative
+            # or very large indices can't wrap into range
+            pre_indices = np.asarray(pre_indices)
+            post_indices = np.asarray(post_indices)
+            if len(pre_indices) != len(post_indices):
+                raise Exception("pre_indices and post_indices must "
+                                "be the same length")
+            if not self._is_index_in_range(pre_indices, self.src.size):
+                raise Exception("presynaptic index out of range")
+            if not self._is_index_in_range(post_indices, self.trg.size):
+                raise Exception("postsynaptic index out of range")
+            pre_indices = np.ascontiguousarray(pre_indices, dtype=np.uint32)
+            post_indices = np.ascontiguousarray(post_indices, dtype=np.uint32)
 
             # Count the number of synapses in each row
-            row_lengths = np.bincount(pre_indices, minlength=self.src.size)
-            row_lengths = row_lengths.astype(np.uint32)
-
-            # Use maximum for max connections
-            max_row_length = int(np.amax(row_lengths))
-            self.pop.set_max_connections(max_row_length)
+            row_lengths = np.empty(self.src.size, dtype=np.uint32)
+            slm.count_row_lengths(pre_indices, row_lengths, num_threads)
+
+            # Find order synapses should be stored in so values
+            # can be sorted into rows when model is loaded
+            self._sort_order = np.empty(len(pre_indices), dtype=np.uint64)
+            slm.sort_synapses(pre_indices, post_indices, self._sort_order,
+                              self.src.size, num_threads)
+            self._set_sparse_rows(row_lengths, post_indices, num_threads)
+        else:
+            raise Exception("set_sparse_connections only supports"
+                            "ragged format sparse connectivity")
 
-            # Set ind to sorted postsynaptic indices
-            self.ind = post_indices[self.synapse_order]
+    def set_sparse_connections_csr(self, row_ptr, post_indices,
+                                   num_threads=1):
+        """Set ragged format connections between two groups of neurons
+        from connections which are already in CSR order. Rows are used
+        as specified so, if postsynaptic tiling or delta encoding is
+        enabled, they must already be sorted by postsynaptic index. Any
+        weight update model variable values should be specified in the
+        same order
 
-            # Cache the row lengths
-            self.row_lengths = row_lengths
+        Args:
+        row_ptr         --  ndarray containing the index of the first
+                            synapse in each row followed by the total
+                            number of synapses
+        post_indices    --  ndarray of postsynaptic indices
 
-            assert len(self.row_lengths) == self.src.size
+        Keyword args:
+        num_threads     --  number of threads to use when copying
+        """
+        if self.weight_sharing_master is not None:
+            raise Exception("when weight sharing is used, set_sparse_connections_csr"
+                            "can only be used on the 'master' population")
+        elif self.is_ragged:
+            row_ptr = np.asarray(row_ptr)
+            post_indices = np.asarray(post_indices)
+            if (len(row_ptr) != (self.src.size + 1) or row_ptr[0] != 0
+                    or row_ptr[-1] != len(post_indices)):
+                raise Exception("row_ptr does not match presynaptic "
+                                "population size and post_indices")
+
+            # Row lengths are the differences between row start indices
+            row_lengths = np.diff(row_ptr)
+            if not np.all(row_lengths >= 0):
+                raise Exception("row_ptr must be monotonically increasing")
+            if not self._is_index_in_range(post_indices, self.trg.size):
+                raise Exception("postsynaptic index out of range")
+
+            # No sorting is required so don't keep synapse order
+            self._sort_order = None
+            self._set_sparse_rows(
+                row_lengths.astype(np.uint32),
+                np.ascontiguousarray(post_indices, dtype=np.uint32),
+                num_threads)
         else:
-            raise Exception("set_sparse_connections only supports"
+            raise Exception("set_sparse_connections_csr only supports"
                             "ragged format sparse connectivity")
 
+    @staticmethod
+    def _is_index_in_range(indices, size):
+        """Tests whether all indices are valid for a population of size"""
+        return (len(indices) == 0
+                or (np.amin(indices) >= 0 and np.amax(indices) < size))
+
+    def _set_sparse_rows(self, row_lengths, post_indices, num_threads):
+        # Count synapses
+        self._num_synapses = len(post_indices)
+
+        # Use maximum for max connections
+        max_row_length = int(np.amax(row_lengths)) if len(row_lengths) > 0 else 0
+        self.pop.set_max_connections(max_row_length)
+
+        # Cache the row lengths and unsorted postsynaptic indices
+        self.row_lengths = row_lengths
+        self._post_indices = post_indices
+        self._import_num_threads = num_threads
+
         self.connections_set = True
 
-    def get_sparse_pre_inds(self):
+    def get_sparse_pre_inds(self, num_threads=1):
         """Get presynaptic indices of synapse group connections
 
+        Keyword args:
+        num_threads --  number of threads to use
+
         Returns:
         ndarray of presynaptic indices
         """
@@ -678,15 +814,22 @@ class SynapseGroup(Group):
 
             # Expand row lengths into full array
             # of presynaptic indices and return
-            return np.hstack([np.repeat(i, l) for i, l in enumerate(rl)])
+            rl = np.ascontiguousarray(rl, dtype=np.uint32)
+            pre_inds = np.empty(np.sum(rl, dtype=np.uint64), dtype=np.uint32)
+            slm.get_sparse_pre_inds(rl, pre_inds, num_threads)
+            return pre_inds
 
         else:
             raise Exception("get_sparse_pre_inds only supports"
                             "ragged format sparse connectivity")
 
-    def get_sparse_post_inds(self):
+    def get_sparse_post_inds(self, num_threads=1):
         """Get postsynaptic indices of synapse group connections
 
+        Keyword args:
+        num_threads --  number of threads to use when compacting
+                        connectivity initialised on device
+
         Returns:
         ndarrays of postsynaptic indices
         """
@@ -696,10 +839,16 @@ class SynapseGroup(Group):
         elif self.is_ragged:
             if self.connectivity_initialiser is None:
 
-                if self.ind is None or self.row_lengths is None:
+                if not self.connections_set:
                     raise Exception("problem accessing manually initialised connectivity ")
-                # Return cached indices
-                return self.ind
+
+                # If connections were specified in CSR order, return them directly
+                if self._sort_order is None:
+                    return self._post_indices
+                # Otherwise, sort them into rows
+                else:
+                    return self._sort_ragged(self._post_indices, 0,
+                                             num_threads)
 
             else:
                 if self._ind is None or self._row_lengths is None:
@@ -707,9 +856,8 @@ class SynapseGroup(Group):
 
                 # the _ind array view still has some non-valid data so we remove them
                 # with the row_lengths
-                return np.hstack([
-                    self._ind[i * self.max_row_length: (i * self.max_row_length) + r]
-                        for i, r in enumerate(self._row_lengths)])
+                return self._compact_ragged(self._ind, self._row_lengths,
+                                            num_threads)
 
         else:
             raise Exception("get_sparse_post_inds only supports"
@@ -791,6 +939,18 @@ class SynapseGroup(Group):
         """
         self._set_extra_global_param(param_name, param_values, self.w_update)
 
+    def set_wu_batch_param_values(self, param_name, values):
+        """Set a different value of a weight update model
+        parameter for each instance of a batched model
+
+        Args:
+        param_name  --  string with the name of the parameter
+        values      --  iterable with a value for each instance
+        """
+        if self._model._built:
+            raise Exception("GeNN model already built")
+        self.pop.set_wubatch_param_values(param_name, DoubleVector(values))
+
     def set_psm_extra_global_param(self, param_name, param_values):
         """Set extra global parameter to postsynaptic model
 
@@ -814,6 +974,55 @@ class SynapseGroup(Group):
                                      self.connectivity_initialiser.get_snippet(),
                                      self.connectivity_extra_global_params)
 
+    def _compact_ragged(self, padded, row_lengths, num_threads):
+        """Copy valid elements of each row of padded ragged
+        array into new compact array in a single pass"""
+        row_lengths = np.ascontiguousarray(row_lengths, dtype=np.uint32)
+        if (len(row_lengths) != self.src.size
+                or len(padded) != self.src.size * self.max_row_length
+                or np.any(row_lengths > self.max_row_length)):
+            raise Exception("Ragged array does not match connectivity")
+
+        # Operate on bytes so any variable type can be compacted
+        compact = np.empty(np.sum(row_lengths, dtype=np.uint64),
+                           dtype=padded.dtype)
+        slm.compact_ragged_var(row_lengths, padded.view(np.uint8),
+                               compact.view(np.uint8), self.max_row_length,
+                               padded.dtype.itemsize, num_threads)
+        return compact
+
+    def _sort_ragged(self, values, row_stride, num_threads, ragged=None):
+        """Sort values specified in the same order as set_sparse_connections
+        into rows in the order found by set_sparse_connections. If row_stride
+        is zero, rows are packed into a new compact array, otherwise
+        row i starts at element i * row_stride of ragged"""
+        if ragged is None:
+            ragged = np.empty(len(values), dtype=values.dtype)
+
+        # Operate on bytes so any variable type can be sorted
+        slm.sort_ragged_var(self.row_lengths, self._sort_order,
+                            values.view(np.uint8), ragged.view(np.uint8),
+                            row_stride, values.dtype.itemsize, num_threads)
+        return ragged
+
+    def _import_ragged(self, values, padded):
+        """Copy values specified in the same order as the
+        connections into the rows of padded ragged array"""
+        if len(values) != self._num_synapses:
+            raise Exception("Number of values does not match "
+                            "number of synapses")
+
+        # If connections were specified in CSR order, copy each row into place
+        if self._sort_order is None:
+            slm.expand_ragged_var(self.row_lengths, values.view(np.uint8),
+                                  padded.view(np.uint8), self.max_row_length,
+                                  values.dtype.itemsize,
+                                  self._import_num_threads)
+        # Otherwise, sort into place
+        else:
+            self._sort_ragged(values, self.max_row_length,
+                              self._import_num_threads, padded)
+
     def pull_connectivity_from_device(self):
         """Wrapper around GeNNModel.pull_connectivity_from_device"""
         self._model.pull_connectivity_from_device(self.name)
@@ -846,16 +1055,8 @@ class SynapseGroup(Group):
                         # Copy in row length
                         row_length[:] = self.row_lengths
 
-                        # Create (x)range containing the index where each row starts in ind
-                        row_start_idx = xrange(0, self.weight_update_var_size,
-                                               self.max_row_length)
-
-                        # Loop through ragged matrix rows
-                        syn = 0
-                        for i, r in zip(row_start_idx, self.row_lengths):
-                            # Copy row from non-padded indices into correct location
-                            ind[i:i + r] = self.ind[syn:syn + r]
-                            syn += r
+                        # Sort postsynaptic indices straight into padded rows
+                        self._import_ragged(self._post_indices, ind)
                     elif self.connectivity_initialiser is None:
                         raise Exception("For sparse projections, the connections"
                                         "must be set before loading a model")
@@ -876,7 +1077,7 @@ class SynapseGroup(Group):
                 var_loc = self.pop.get_wuvar_location(var_name) 
                 if (var_loc & VarLocation_HOST) != 0:
                     # Get view
-                    var_data.view = self._assign_ext_ptr_array(
+                    var_data.view = self._assign_ext_ptr_array_batched(
                         var_name, self.weight_update_var_size, var_data.type)
 
                     # Initialise variable if necessary
@@ -950,20 +1151,17 @@ class SynapseGroup(Group):
             if self.is_dense:
                 var_data.view[:] = var_data.values
             elif self.is_ragged:
-                # Sort variable to match GeNN order
-                sorted_var = var_data.values[self.synapse_order]
-
-                # Create (x)range containing the index
-                # where each row starts in ind
-                row_start_idx = xrange(0, self.weight_update_var_size,
-                                       self.max_row_length)
-
-                # Loop through ragged matrix rows
-                syn = 0
-                for i, r in zip(row_start_idx, self.row_lengths):
-                    # Copy row from non-padded indices into correct location
-                    var_data.view[i:i + r] = sorted_var[syn:syn + r]
-                    syn += r
+                values = np.ascontiguousarray(var_data.values,
+                                              dtype=var_data.view.dtype)
+
+                # Sort values straight into padded rows to match GeNN order,
+                # using either the same or separate values for each instance
+                if self._model.batch_size > 1:
+                    for b, view in enumerate(var_data.view):
+                        self._import_ragged(values[b] if values.ndim > 1 else values,
+                                            view)
+                else:
+                    self._import_ragged(values, var_data.view)
             else:
                 raise Exception("Matrix format not supported")
 
@@ -6,7 +6,8 @@ helper functions to derive custom model classes.
 GeNNModel should be used to configure a model, build, load and
 finally run it. Recording is done manually by pulling from the population of
 interest and then copying the values from Variable.view attribute. Each
-simulation step must be triggered manually by calling step_time function.
+simulation step must be triggered manually by calling step_time function
+or several steps can be run at once by calling the run function.
 
 Example:
 The following example shows in a (very) simplified manner how to build and
@@ -67,7 +68,7 @@ from .model_preprocessor import prepare_snippet
 
 # Loop through backends in preferential order
 backend_modules = OrderedDict()
-for b in ["CUDA", "SingleThreadedCPU", "OpenCL"]:
+for b in ["CUDA", "SingleThreadedCPU", "MultiThreadedCPU", "OpenCL"]:
     # Try and import
     try:
         m = import_module(".genn_wrapper." + b + "Backend", "pygenn")
@@ -93,7 +94,7 @@ class GeNNModel(object):
                  genn_log_level=genn_wrapper.warning,
                  code_gen_log_level=genn_wrapper.warning,
                  backend_log_level=genn_wrapper.warning,
-                 **preference_kwargs):
+                 batch_size=1, **preference_kwargs):
         """Init GeNNModel
         Keyword args:
         precision           -- string precision as string ("float", "double"
@@ -106,6 +107,8 @@ class GeNNModel(object):
         genn_log_level      -- Log level for GeNN
         code_gen_log_level  -- Log level for GeNN code-generator
         backend_log_level   -- Log level for backend
+        batch_size          -- number of instances of the model to simulate
+                               together. Defaults to 1.
         preference_kwargs   -- Additional keyword arguments to set in backend preferences structure
         """
         # Based on time precision, create correct type 
@@ -151,6 +154,7 @@ class GeNNModel(object):
         self.synapse_populations = {}
         self.current_sources = {}
         self.dT = 0.1
+        self.batch_size = batch_size
         
         # Build dictionary containing conversions between GeNN C++ types and numpy types
         self.genn_types = {
@@ -169,7 +173,9 @@ class GeNNModel(object):
             "uint16_t":         GeNNType(np.uint16, self._slm.assign_external_pointer_array_us, self._slm.assign_external_pointer_single_us),
             "int16_t":          GeNNType(np.int16, self._slm.assign_external_pointer_array_s, self._slm.assign_external_pointer_single_s),
             "uint8_t":          GeNNType(np.uint8, self._slm.assign_external_pointer_array_uc, self._slm.assign_external_pointer_single_uc),
-            "int8_t":           GeNNType(np.int8, self._slm.assign_external_pointer_array_sc, self._slm.assign_external_pointer_single_sc)}
+            "int8_t":           GeNNType(np.int8, self._slm.assign_external_pointer_array_sc, self._slm.assign_external_pointer_single_sc),
+            "half":             GeNNType(np.float16, lambda n, s: self._slm.assign_external_pointer_array_us(n, s).view(np.float16), None),
+            "bfloat16":         GeNNType(np.uint16, self._slm.assign_external_pointer_array_us, None)}
         
         # Add "scalar" type to genn_types - pointing at float or double as appropriate
         if precision == "float":
@@ -282,6 +288,17 @@ class GeNNModel(object):
             raise Exception("GeNN model already built")
         self._model.set_dt(dt)
 
+    @property
+    def batch_size(self):
+        """Number of instances of the model simulated together"""
+        return self._model.get_batch_size()
+
+    @batch_size.setter
+    def batch_size(self, batch_size):
+        if self._built:
+            raise Exception("GeNN model already built")
+        self._model.set_batch_size(batch_size)
+
     @property
     def neuron_update_time(self):
         return self._slm.get_neuron_update_time()
@@ -614,6 +631,27 @@ class GeNNModel(object):
         """Make one simulation step"""
         self._slm.step_time()
 
+    def run(self, n, callback=None, interval=0):
+        """Make n simulation steps without returning to Python every step
+
+        Keyword args:
+        callback    --  optional function called with the current timestep
+                        every interval steps
+        interval    --  number of steps between calls to callback
+        """
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before stepping")
+
+        # If there's no callback, run all steps inside the model library
+        if callback is None or interval == 0:
+            self._slm.run(n)
+        # Otherwise, run blocks of interval steps and call callback between them
+        else:
+            for i in range(n // interval):
+                self._slm.run(interval)
+                callback(self.timestep)
+            self._slm.run(n % interval)
+
     def pull_state_from_device(self, pop_name):
         """Pull state from the device for a given population"""
         if not self._loaded:
@@ -0,0 +1,274 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// RaggedMatrixNumpy
+//----------------------------------------------------------------------------
+// Helpers for converting between the padded ragged matrices used by GeNN and
+// the compact arrays used by pygenn in a single pass rather than via lists of
+// per-row numpy slices. When used with numpy, the wrapper automatically
+// provides array sizes. Array sizes are assumed to have been checked in python.
+namespace RaggedMatrixNumpy
+{
+namespace Detail
+{
+// Split rows into numThreads blocks and call fn(startRow, endRow, startSynapse)
+// for each block on its own thread where startSynapse is the index of the
+// block's first synapse in the compact arrays
+template<typename F>
+void parallelForRows(const unsigned int *rowLength, int numRows, unsigned int numThreads, F fn)
+{
+    // Use at most one thread per row
+    numThreads = std::max(1u, std::min(numThreads, (unsigned int)std::max(numRows, 1)));
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    int startRow = 0;
+    size_t startSynapse = 0;
+    for(unsigned int t = 0; t < numThreads; t++) {
+        const int endRow = (int)(((size_t)numRows * (t + 1)) / numThreads);
+
+        // Process last block on calling thread and others on new threads
+        if(t == (numThreads - 1)) {
+            fn(startRow, endRow, startSynapse);
+        }
+        else {
+            threads.emplace_back(fn, startRow, endRow, startSynapse);
+        }
+
+        // Advance past block's synapses
+        for(int i = startRow; i < endRow; i++) {
+            startSynapse += rowLength[i];
+        }
+        startRow = endRow;
+    }
+
+    // Wait for other blocks to complete
+    for(auto &t : threads) {
+        t.join();
+    }
+}
+
+// Split synapses into numThreads blocks and call fn(thread, startSynapse, endSynapse)
+// for each block on its own thread
+template<typename F>
+void parallelForSynapses(size_t numSynapses, unsigned int numThreads, F fn)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for(unsigned int t = 0; t < numThreads; t++) {
+        const size_t startSynapse = (numSynapses * t) / numThreads;
+        const size_t endSynapse = (numSynapses * (t + 1)) / numThreads;
+
+        // Process last block on calling thread and others on new threads
+        if(t == (numThreads - 1)) {
+            fn(t, startSynapse, endSynapse);
+        }
+        else {
+            threads.emplace_back(fn, t, startSynapse, endSynapse);
+        }
+    }
+
+    // Wait for other blocks to complete
+    for(auto &t : threads) {
+        t.join();
+    }
+}
+
+// Count the synapses in each row within each thread's block of synapses
+inline std::vector<std::vector<size_t>> countRows(const unsigned int *preInd, size_t numSynapses,
+                                                  unsigned int numRows, unsigned int numThreads)
+{
+    std::vector<std::vector<size_t>> counts(numThreads);
+    parallelForSynapses(numSynapses, numThreads,
+                        [preInd, numRows, &counts](unsigned int t, size_t startSynapse, size_t endSynapse)
+                        {
+                            auto &threadCounts = counts[t];
+                            threadCounts.assign(numRows, 0);
+                            for(size_t i = startSynapse; i < endSynapse; i++) {
+                                threadCounts[preInd[i]]++;
+                            }
+                        });
+    return counts;
+}
+
+// Gather the values of each row's synapses, in the order they are listed in the
+// order array, into the rows of a compact (rowStride zero) or padded array
+template<typename T>
+void gatherRows(const unsigned int *rowLength, int numRows, const uint64_t *order, const T *values,
+                T *raggedVar, unsigned int rowStride, unsigned int numThreads)
+{
+    parallelForRows(rowLength, numRows, numThreads,
+                    [=](int startRow, int endRow, size_t startSynapse)
+                    {
+                        const uint64_t *in = order + startSynapse;
+                        T *out = raggedVar + startSynapse;
+                        for(int i = startRow; i < endRow; i++) {
+                            if(rowStride != 0) {
+                                out = raggedVar + ((size_t)i * rowStride);
+                            }
+                            for(unsigned int s = 0; s < rowLength[i]; s++) {
+                                *out++ = values[*in++];
+                            }
+                        }
+                    });
+}
+}   // namespace Detail
+
+//! Copy the first rowLength[i] elements of each padded row i into a compact array
+/*! Arrays are passed as bytes so one function can handle variables of any type */
+inline void compactRaggedVar(const unsigned int *rowLength, int numRows,
+                             const uint8_t *paddedVar, size_t paddedSize,
+                             uint8_t *var, size_t size,
+                             unsigned int maxRowLength, unsigned int elementSize, unsigned int numThreads = 1)
+{
+    Detail::parallelForRows(rowLength, numRows, numThreads,
+                            [=](int startRow, int endRow, size_t startSynapse)
+                            {
+                                const size_t rowStride = (size_t)maxRowLength * elementSize;
+                                uint8_t *out = var + (startSynapse * elementSize);
+                                for(int i = startRow; i < endRow; i++) {
+                                    const size_t rowBytes = (size_t)rowLength[i] * elementSize;
+                                    std::memcpy(out, paddedVar + (i * rowStride), rowBytes);
+                                    out += rowBytes;
+                                }
+                            });
+}
+
+//! Copy consecutive rowLength[i] elements of a compact array into the start of each padded row i
+/*! This is the inverse of compactRaggedVar and is used to import data which is already in CSR order */
+inline void expandRaggedVar(const unsigned int *rowLength, int numRows,
+                            const uint8_t *values, size_t valuesSize,
+                            uint8_t *raggedVar, size_t raggedSize,
+                            unsigned int maxRowLength, unsigned int elementSize, unsigned int numThreads = 1)
+{
+    Detail::parallelForRows(rowLength, numRows, numThreads,
+                            [=](int startRow, int endRow, size_t startSynapse)
+                            {
+                                const size_t rowStride = (size_t)maxRowLength * elementSize;
+                                const uint8_t *in = values + (startSynapse * elementSize);
+                                for(int i = startRow; i < endRow; i++) {
+                                    const size_t rowBytes = (size_t)rowLength[i] * elementSize;
+                                    std::memcpy(raggedVar + (i * rowStride), in, rowBytes);
+                                    in += rowBytes;
+                                }
+                            });
+}
+
+//! Write the presynaptic index of each synapse into compact COO array
+inline void getSparsePreInds(const unsigned int *rowLength, int numRows,
+                             unsigned int *preInd, size_t size, unsigned int numThreads = 1)
+{
+    Detail::parallelForRows(rowLength, numRows, numThreads,
+                            [=](int startRow, int endRow, size_t startSynapse)
+                            {
+                                unsigned int *out = preInd + startSynapse;
+                                for(int i = startRow; i < endRow; i++) {
+                                    out = std::fill_n(out, rowLength[i], (unsigned int)i);
+                                }
+                            });
+}
+
+//! Count the number of synapses with each presynaptic index
+inline void countRowLengths(const unsigned int *preInd, size_t numSynapses,
+                            unsigned int *rowLength, int numRows, unsigned int numThreads = 1)
+{
+    numThreads = std::max(1u, numThreads);
+    const auto counts = Detail::countRows(preInd, numSynapses, (unsigned int)numRows, numThreads);
+
+    // Sum each thread's counts
+    std::fill_n(rowLength, numRows, 0);
+    for(const auto &threadCounts : counts) {
+        for(int i = 0; i < numRows; i++) {
+            rowLength[i] += (unsigned int)threadCounts[i];
+        }
+    }
+}
+
+//! Find the order in which synapses specified in COO format should be stored in rows
+/*! Synapses are first sorted into rows with a stable counting sort by presynaptic index and then each row
+    is sorted by postsynaptic index so the rows of imported connectivity are always sorted, as required by
+    postsynaptic tiling and delta encoding. order is filled with the index of each synapse in CSR order */
+inline void sortSynapses(const unsigned int *preInd, size_t numSynapses,
+                         const unsigned int *postInd, size_t numPostInd,
+                         uint64_t *order, size_t orderSize,
+                         unsigned int numRows, unsigned int numThreads = 1)
+{
+    numThreads = std::max(1u, numThreads);
+
+    // Count synapses in each row within each thread's block
+    auto cursors = Detail::countRows(preInd, numSynapses, numRows, numThreads);
+
+    // Convert counts into the position each thread should write its first synapse in each row to
+    std::vector<unsigned int> rowLength(numRows);
+    size_t rowStart = 0;
+    for(unsigned int i = 0; i < numRows; i++) {
+        size_t rowCursor = rowStart;
+        for(auto &threadCursors : cursors) {
+            const size_t count = threadCursors[i];
+            threadCursors[i] = rowCursor;
+            rowCursor += count;
+        }
+        rowLength[i] = (unsigned int)(rowCursor - rowStart);
+        rowStart = rowCursor;
+    }
+
+    // Scatter synapse indices into rows
+    Detail::parallelForSynapses(numSynapses, numThreads,
+                                [preInd, order, &cursors](unsigned int t, size_t startSynapse, size_t endSynapse)
+                                {
+                                    auto &threadCursors = cursors[t];
+                                    for(size_t i = startSynapse; i < endSynapse; i++) {
+                                        order[threadCursors[preInd[i]]++] = i;
+                                    }
+                                });
+
+    // Sort each row by postsynaptic index, keeping synapses with the same index in the order they were specified
+    Detail::parallelForRows(rowLength.data(), (int)numRows, numThreads,
+                            [postInd, order, &rowLength](int startRow, int endRow, size_t startSynapse)
+                            {
+                                uint64_t *row = order + startSynapse;
+                                for(int i = startRow; i < endRow; i++) {
+                                    std::stable_sort(row, row + rowLength[i],
+                                                     [postInd](uint64_t a, uint64_t b){ return postInd[a] < postInd[b]; });
+                                    row += rowLength[i];
+                                }
+                            });
+}
+
+//! Copy values of synapses specified in COO format into rows in the order found by sortSynapses
+/*! If rowStride is zero, rows are packed into a compact CSR array, otherwise row i starts at element i * rowStride
+    so values can be written straight into padded ragged variables. Arrays are passed as bytes so one function
+    can handle variables of any type (with 1, 2, 4 or 8 byte elements) */
+inline void sortRaggedVar(const unsigned int *rowLength, int numRows,
+                          const uint64_t *order, size_t orderSize,
+                          const uint8_t *values, size_t valuesSize,
+                          uint8_t *raggedVar, size_t raggedSize,
+                          unsigned int rowStride, unsigned int elementSize, unsigned int numThreads = 1)
+{
+    // Gather values using suitably sized type
+    if(elementSize == 1) {
+        Detail::gatherRows(rowLength, numRows, order, values, raggedVar, rowStride, numThreads);
+    }
+    else if(elementSize == 2) {
+        Detail::gatherRows(rowLength, numRows, order, reinterpret_cast<const uint16_t*>(values),
+                           reinterpret_cast<uint16_t*>(raggedVar), rowStride, numThreads);
+    }
+    else if(elementSize == 4) {
+        Detail::gatherRows(rowLength, numRows, order, reinterpret_cast<const uint32_t*>(values),
+                           reinterpret_cast<uint32_t*>(raggedVar), rowStride, numThreads);
+    }
+    else if(elementSize == 8) {
+        Detail::gatherRows(rowLength, numRows, order, reinterpret_cast<const uint64_t*>(values),
+                           reinterpret_cast<uint64_t*>(raggedVar), rowStride, numThreads);
+    }
+}
+}   // namespace RaggedMatrixNumpy
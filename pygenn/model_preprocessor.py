@@ -198,6 +198,31 @@ def post_var_space_to_vals(model, var_space):
         VarInitVector([var_space[vnt.name].init_val
                        for vnt in model.get_post_vars()]))
 
+def float_to_bfloat16(values):
+    """Convert values to bfloat16, rounding to nearest even
+
+    Args:
+    values  -- iterable or single value
+
+    Returns:
+    numpy array of uint16 containing the bfloat16 bit patterns
+    """
+    bits = np.asarray(values, dtype=np.float32).view(np.uint32)
+    rounded = (bits + np.uint32(0x7FFF) + ((bits >> 16) & 1)) >> 16
+    nan = (bits & 0x7FFFFFFF) > 0x7F800000
+    return np.where(nan, (bits >> 16) | 0x40, rounded).astype(np.uint16)
+
+def bfloat16_to_float(bits):
+    """Convert bfloat16 bit patterns to float32
+
+    Args:
+    bits    -- numpy array of uint16 containing bfloat16 bit patterns
+
+    Returns:
+    numpy array of float32
+    """
+    return (np.asarray(bits, dtype=np.uint16).astype(np.uint32) << 16).view(np.float32)
+
 
 class Variable(object):
 
@@ -256,8 +281,13 @@ class Variable(object):
             try:
                 iter(values)
                 self.init_val = genn_wrapper.uninitialised_var()
-                self.values = np.asarray(
-                    values, dtype=self.group._model.genn_types[self.type].np_dtype)
+
+                # **NOTE** numpy has no bfloat16 type so values are stored as raw bit patterns
+                if self.type == "bfloat16":
+                    self.values = float_to_bfloat16(values)
+                else:
+                    self.values = np.asarray(
+                        values, dtype=self.group._model.genn_types[self.type].np_dtype)
                 self.init_required = True
             # Otherwise - they can be initialised on device as a scalar
             except TypeError:
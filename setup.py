@@ -68,13 +68,20 @@ genn_extension_kwargs["include_dirs"].extend([genn_include, genn_third_party_inc
 genn_extension_kwargs["swig_opts"].extend(["-I" + genn_include, "-I" + genn_third_party_include])
 genn_extension_kwargs["define_macros"] = [("LINKING_GENN_DLL", "1"), ("LINKING_BACKEND_DLL", "1")]
 
+# Copy dictionary and add pthreads to SharedLibraryModelNumpy module which uses std::thread in ragged matrix helpers
+shared_library_model_extension_kwargs = deepcopy(extension_kwargs)
+if not windows:
+    shared_library_model_extension_kwargs["extra_compile_args"].append("-pthread")
+    shared_library_model_extension_kwargs["extra_link_args"].append("-pthread")
+
 # On Linux, we want to add extension directory i.e. $ORIGIN to runtime
 # directories so libGeNN and backends can be found wherever package is installed
 if linux:
     genn_extension_kwargs["runtime_library_dirs"] = ["$ORIGIN"]
 
-# By default build single-threaded CPU backend
-backends = [("single_threaded_cpu", "SingleThreadedCPU", {})]
+# By default build single and multi-threaded CPU backends
+backends = [("single_threaded_cpu", "SingleThreadedCPU", {}),
+            ("multi_threaded_cpu", "MultiThreadedCPU", {})]
 
 # If CUDA was found, add backend configuration
 if cuda_installed:
@@ -128,7 +135,7 @@ for root, _, filenames in os.walk(pygenn_share):
 
 # Create list of extension modules required to wrap utilities and various libGeNN namespaces
 ext_modules = [Extension('_StlContainers', ["pygenn/genn_wrapper/generated/StlContainers.i"], **extension_kwargs),
-               Extension('_SharedLibraryModelNumpy', ["pygenn/genn_wrapper/generated/SharedLibraryModelNumpy.i"], **extension_kwargs),
+               Extension('_SharedLibraryModelNumpy', ["pygenn/genn_wrapper/generated/SharedLibraryModelNumpy.i"], **shared_library_model_extension_kwargs),
                Extension('_genn_wrapper', ["pygenn/genn_wrapper/generated/genn_wrapper.i"], **genn_extension_kwargs),
                Extension('_Snippet', ["pygenn/genn_wrapper/swig/Snippet.i"], **genn_extension_kwargs),
                Extension('_Models', ["pygenn/genn_wrapper/swig/Models.i"], **genn_extension_kwargs),
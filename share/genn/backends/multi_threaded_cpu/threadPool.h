@@ -0,0 +1,180 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+//! Persistent pool of worker threads used by code generated by the multi-threaded CPU backend
+/*! Each call to run() executes the same task on every thread (the calling thread acts as
+    thread 0) and only returns once all threads have finished. Workers spin briefly before
+    blocking so the handful of parallel regions launched every timestep are cheap to start. */
+class ThreadPool
+{
+public:
+    typedef std::function<void(unsigned int)> Task;
+
+    explicit ThreadPool(unsigned int numThreads)
+    :   m_NumThreads(std::max(1u, numThreads)), m_Task(nullptr), m_Generation(0), m_NumRemaining(0), m_Stop(false),
+        m_BarrierCount(0), m_BarrierGeneration(0)
+    {
+        // Start workers - the calling thread acts as thread zero
+        for(unsigned int t = 1; t < m_NumThreads; t++) {
+            m_Workers.emplace_back(&ThreadPool::workerLoop, this, t);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        // Signal workers to stop and wake them up
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+            m_Generation++;
+        }
+        m_WakeCondition.notify_all();
+
+        // Wait for them to exit
+        for(auto &w : m_Workers) {
+            w.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool &operator = (const ThreadPool&) = delete;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Run task on all threads and wait for them to complete
+    void run(const Task &task)
+    {
+        // If there are no workers, simply run task on this thread
+        if(m_NumThreads == 1) {
+            task(0);
+            return;
+        }
+
+        // Publish task and wake workers
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Task = &task;
+            m_NumRemaining.store(m_NumThreads - 1);
+            m_Generation++;
+        }
+        m_WakeCondition.notify_all();
+
+        // Do our share of the work
+        task(0);
+
+        // Spin briefly and then block until all workers have finished
+        for(unsigned int i = 0; i < SpinCount && m_NumRemaining.load() != 0; i++) {
+            std::this_thread::yield();
+        }
+        if(m_NumRemaining.load() != 0) {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_DoneCondition.wait(lock, [this](){ return (m_NumRemaining.load() == 0); });
+        }
+        m_Task = nullptr;
+    }
+
+    //! Wait until every thread running the current task has reached the barrier
+    /*! This must be called the same number of times by every thread within a task */
+    void barrier()
+    {
+        if(m_NumThreads == 1) {
+            return;
+        }
+
+        // If this is the last thread to arrive, reset count and release other threads
+        const unsigned int generation = m_BarrierGeneration.load();
+        if(m_BarrierCount.fetch_add(1) == (m_NumThreads - 1)) {
+            m_BarrierCount.store(0);
+            m_BarrierGeneration.fetch_add(1);
+        }
+        // Otherwise, spin until last thread arrives
+        else {
+            while(m_BarrierGeneration.load() == generation) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    unsigned int getNumThreads() const{ return m_NumThreads; }
+
+    //! Get the range [begin, end) of count items which should be processed by thread
+    /*! Range boundaries are multiples of alignment so, for example, threads
+        processing 32-aligned ranges never write to the same bitfield word */
+    void getRange(unsigned int count, unsigned int thread, unsigned int alignment,
+                  unsigned int &begin, unsigned int &end) const
+    {
+        const uint64_t numChunks = (count + alignment - 1) / alignment;
+        begin = (unsigned int)std::min<uint64_t>(count, alignment * ((numChunks * thread) / m_NumThreads));
+        end = (unsigned int)std::min<uint64_t>(count, alignment * ((numChunks * (thread + 1)) / m_NumThreads));
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Constants
+    //------------------------------------------------------------------------
+    static const unsigned int SpinCount = 4096;
+
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void workerLoop(unsigned int thread)
+    {
+        unsigned int seenGeneration = 0;
+        while(true) {
+            // Spin briefly and then block until a new task is published
+            for(unsigned int i = 0; i < SpinCount && m_Generation.load() == seenGeneration; i++) {
+                std::this_thread::yield();
+            }
+            if(m_Generation.load() == seenGeneration) {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_WakeCondition.wait(lock, [this, seenGeneration](){ return (m_Generation.load() != seenGeneration); });
+            }
+            seenGeneration = m_Generation.load();
+
+            // Exit if pool is being destroyed
+            if(m_Stop.load()) {
+                return;
+            }
+
+            // Run task
+            (*m_Task)(thread);
+
+            // If this was the last thread to finish, wake calling thread
+            if(m_NumRemaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_DoneCondition.notify_one();
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const unsigned int m_NumThreads;
+    const Task *m_Task;
+    std::atomic<unsigned int> m_Generation;
+    std::atomic<unsigned int> m_NumRemaining;
+    std::atomic<bool> m_Stop;
+    std::atomic<unsigned int> m_BarrierCount;
+    std::atomic<unsigned int> m_BarrierGeneration;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_WakeCondition;
+    std::condition_variable m_DoneCondition;
+    std::vector<std::thread> m_Workers;
+};
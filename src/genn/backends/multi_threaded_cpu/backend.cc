@@ -0,0 +1,1155 @@
+#include "backend.h"
+
+// GeNN includes
+#include "gennUtils.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/codeStream.h"
+#include "code_generator/modelSpecMerged.h"
+#include "code_generator/substitutions.h"
+
+using namespace CodeGenerator;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//--------------------------------------------------------------------------
+// Timer
+//--------------------------------------------------------------------------
+class Timer
+{
+public:
+    Timer(CodeStream &codeStream, const std::string &name, bool timingEnabled)
+    :   m_CodeStream(codeStream), m_Name(name), m_TimingEnabled(timingEnabled)
+    {
+        // Record start event
+        if(m_TimingEnabled) {
+            m_CodeStream << "const auto " << m_Name << "Start = std::chrono::high_resolution_clock::now();" << std::endl;
+        }
+    }
+
+    ~Timer()
+    {
+        // Record stop event
+        if(m_TimingEnabled) {
+            m_CodeStream << m_Name << "Time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - " << m_Name << "Start).count();" << std::endl;
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    CodeStream &m_CodeStream;
+    const std::string m_Name;
+    const bool m_TimingEnabled;
+};
+
+//-----------------------------------------------------------------------
+template<typename G>
+void genPresynapticDelayOffsets(CodeStream &os, const G &sg, bool readDelaySlotRequired)
+{
+    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+    if(sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+        if(readDelaySlotRequired) {
+            os << "const unsigned int preReadDelaySlot = " << sg.getPresynapticAxonalDelaySlot() << ";" << std::endl;
+            os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group->numSrcNeurons;" << std::endl;
+        }
+        else {
+            os << "const unsigned int preReadDelayOffset = " << sg.getPresynapticAxonalDelaySlot() << " * group->numSrcNeurons;" << std::endl;
+        }
+
+        if(sg.getArchetype().getWUModel()->isPrevPreSpikeTimeRequired() || sg.getArchetype().getWUModel()->isPrevPreSpikeEventTimeRequired()) {
+            os << "const unsigned int prevPreSpikeTimeReadDelayOffset = " << sg.getPrevPresynapticSpikeTimeAxonalDelaySlot() << " * group->numSrcNeurons;" << std::endl;
+        }
+    }
+}
+//-----------------------------------------------------------------------
+template<typename G>
+void genPostsynapticDelayOffsets(CodeStream &os, const G &sg, bool readDelaySlotRequired)
+{
+    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+    if(sg.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+        if(readDelaySlotRequired) {
+            os << "const unsigned int postReadDelaySlot = " << sg.getPostsynapticBackPropDelaySlot() << ";" << std::endl;
+            os << "const unsigned int postReadDelayOffset = postReadDelaySlot * group->numTrgNeurons;" << std::endl;
+        }
+        else {
+            os << "const unsigned int postReadDelayOffset = " << sg.getPostsynapticBackPropDelaySlot() << " * group->numTrgNeurons;" << std::endl;
+        }
+
+        if(sg.getArchetype().getWUModel()->isPrevPostSpikeTimeRequired()) {
+            os << "const unsigned int prevPostSpikeTimeReadDelayOffset = " << sg.getPrevPostsynapticSpikeTimeBackPropDelaySlot() << " * group->numTrgNeurons;" << std::endl;
+        }
+    }
+}
+//-----------------------------------------------------------------------
+void genPostsynapticRange(CodeStream &os, unsigned int alignment = 32)
+{
+    // Get range of postsynaptic neurons owned by this thread
+    // **NOTE** by default, ranges are word-aligned so bitmask connectivity can be processed a word at a time
+    os << "unsigned int postBegin;" << std::endl;
+    os << "unsigned int postEnd;" << std::endl;
+    os << "threadPool.getRange(group->numTrgNeurons, thread, " << alignment << ", postBegin, postEnd);" << std::endl;
+}
+//-----------------------------------------------------------------------
+bool isPresynapticRowSplit(const SynapseGroupInternal &sg)
+{
+    // Rows of untiled sparse and procedural connectivity are split between threads as, if threads owned ranges of
+    // postsynaptic neurons, every thread would read (or generate) every row and discard most of its synapses
+    // **NOTE** dendritic delay buffers aren't duplicated per-thread so groups which use them are not split
+    const bool untiledSparse = ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && sg.getPostsynapticTileSize() == 0);
+    return ((untiledSparse || (sg.getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL)) && !sg.isDendriticDelayRequired());
+}
+//-----------------------------------------------------------------------
+bool isSynapseDynamicsRowSplit(const SynapseGroupInternal &sg)
+{
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && !sg.isDendriticDelayRequired());
+}
+//-----------------------------------------------------------------------
+bool isSynapseDynamicsThreadInSynRequired(const SynapseGroupInternal &sg)
+{
+    return (isSynapseDynamicsRowSplit(sg) && sg.getWUModel()->getSynapseDynamicsCode().find("$(addToInSyn") != std::string::npos);
+}
+//-----------------------------------------------------------------------
+template<typename G>
+size_t getMaxTrgNeurons(const G &mergedGroup)
+{
+    size_t maxTrgNeurons = 0;
+    for(const auto &sg : mergedGroup.getGroups()) {
+        maxTrgNeurons = std::max(maxTrgNeurons, (size_t)sg.get().getTrgNeuronGroup()->getNumNeurons());
+    }
+    return maxTrgNeurons;
+}
+//-----------------------------------------------------------------------
+void genThreadInSynReduce(CodeStream &os, const std::string &precision, unsigned int numThreads, size_t threadInSynStride, unsigned int batchSize)
+{
+    CodeStream::Scope b(os);
+
+    // Wait for all threads to finish accumulating input into their own buffers
+    os << "threadPool.barrier();" << std::endl;
+
+    // Add input from each thread which used its buffer to the postsynaptic neurons owned by this thread, in
+    // thread order so results are deterministic, and re-zero the buffer so it's ready to be used again
+    // **NOTE** in batched models, each thread has a buffer for each instance
+    genPostsynapticRange(os);
+    os << "for(unsigned int t = 0; t < " << numThreads << "; t++)";
+    {
+        CodeStream::Scope b(os);
+        os << "if(threadInSynUsed[t])";
+        {
+            CodeStream::Scope b(os);
+            if(batchSize > 1) {
+                os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+                os << CodeStream::OB(1);
+                os << "const auto *group = &batchGroup[instance];" << std::endl;
+                os << precision << " *tInSyn = &threadInSyn[((t * " << batchSize << ") + instance) * " << threadInSynStride << "];" << std::endl;
+            }
+            else {
+                os << precision << " *tInSyn = &threadInSyn[t * " << threadInSynStride << "];" << std::endl;
+            }
+            os << "for(unsigned int j = postBegin; j < postEnd; j++)";
+            {
+                CodeStream::Scope b(os);
+                os << "group->inSyn[j] += tInSyn[j];" << std::endl;
+                os << "tInSyn[j] = 0;" << std::endl;
+            }
+            if(batchSize > 1) {
+                os << CodeStream::CB(1);
+            }
+        }
+    }
+
+    // Wait for all threads to finish reducing before buffers are reused
+    os << "threadPool.barrier();" << std::endl;
+}
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces&,
+                              HostHandler preambleHandler, NeuronGroupSimHandler simHandler, NeuronUpdateGroupMergedHandler wuVarUpdateHandler,
+                              HostHandler pushEGPHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    // Generate struct definitions
+    modelMerged.genMergedNeuronUpdateGroupStructs(os, *this);
+    modelMerged.genMergedNeuronSpikeQueueUpdateStructs(os, *this);
+
+    // Generate arrays of merged structs and functions to set them
+    genMergedStructArrayPush(os, modelMerged.getMergedNeuronUpdateGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedNeuronSpikeQueueUpdateGroups());
+
+    // Generate arrays to hold number of spikes emitted by each thread
+    for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+        os << "static unsigned int mergedNeuronUpdateGroup" << n.getIndex() << "ThreadSpkCnt[" << n.getGroups().size() << "][" << getNumThreads() << "];" << std::endl;
+        if(n.getArchetype().isSpikeEventRequired()) {
+            os << "static unsigned int mergedNeuronUpdateGroup" << n.getIndex() << "ThreadSpkCntEvnt[" << n.getGroups().size() << "][" << getNumThreads() << "];" << std::endl;
+        }
+    }
+    os << std::endl;
+
+    // Generate preamble
+    preambleHandler(os);
+
+    os << "void updateNeurons(" << model.getTimePrecision() << " t";
+    if(model.isRecordingInUse()) {
+        os << ", unsigned int recordingTimestep";
+    }
+    os << ")";
+    {
+        CodeStream::Scope b(os);
+
+        Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
+        funcSubs.addVarSubstitution("t", "t");
+
+        // Push any required EGPs
+        pushEGPHandler(os);
+
+        Timer t(os, "neuronUpdate", model.isTimingEnabled());
+
+        // Update spike queues
+        genNeuronSpikeQueueUpdate(os, modelMerged);
+
+        // Update neurons in parallel
+        os << "threadPool.run([&](unsigned int thread)";
+        {
+            CodeStream::Scope b(os);
+
+            // Loop through merged neuron update groups
+            for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+                CodeStream::Scope b(os);
+                os << "// merged neuron update group " << n.getIndex() << std::endl;
+                os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Get reference to group
+                    os << "const auto *group = &mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+
+                    // Get range of neurons to update on this thread
+                    os << "unsigned int begin;" << std::endl;
+                    os << "unsigned int end;" << std::endl;
+                    os << "threadPool.getRange(group->numNeurons, thread, 32, begin, end);" << std::endl;
+                    genGroupTimerStart(os);
+
+                    // If spike or spike-like event recording is in use
+                    if(n.getArchetype().isSpikeRecordingEnabled() || n.getArchetype().isSpikeEventRecordingEnabled()) {
+                        // Calculate number of words which will be used to record this population's spikes
+                        os << "const unsigned int numRecordingWords = (group->numNeurons + 31) / 32;" << std::endl;
+
+                        // Zero the words of the spike recording buffer this thread is responsible for
+                        if(n.getArchetype().isSpikeRecordingEnabled()) {
+                            os << "std::fill_n(&group->recordSpk[(recordingTimestep * numRecordingWords) + (begin / 32)], (end - begin + 31) / 32, 0);" << std::endl;
+                        }
+
+                        // Zero the words of the spike-like-event recording buffer this thread is responsible for
+                        if(n.getArchetype().isSpikeEventRecordingEnabled()) {
+                            os << "std::fill_n(&group->recordSpkEvent[(recordingTimestep * numRecordingWords) + (begin / 32)], (end - begin + 31) / 32, 0);" << std::endl;
+                        }
+                    }
+
+                    // If axonal delays are required
+                    if(n.getArchetype().isDelayRequired()) {
+                        // We should READ from delay slot before spkQuePtr
+                        os << "const unsigned int readDelayOffset = " << n.getPrevQueueOffset() << ";" << std::endl;
+
+                        // And we should WRITE to delay slot pointed to be spkQuePtr
+                        os << "const unsigned int writeDelayOffset = " << n.getCurrentQueueOffset() << ";" << std::endl;
+                    }
+
+                    // Zero this thread's spike counts
+                    os << "unsigned int threadSpkCnt = 0;" << std::endl;
+                    if(n.getArchetype().isSpikeEventRequired()) {
+                        os << "unsigned int threadSpkCntEvnt = 0;" << std::endl;
+                    }
+                    os << std::endl;
+
+                    // Update neurons
+                    genNeuronUpdateLoop(os, n, funcSubs, "begin", "end", simHandler, wuVarUpdateHandler);
+
+                    // Store this thread's spike counts
+                    os << "mergedNeuronUpdateGroup" << n.getIndex() << "ThreadSpkCnt[g][thread] = threadSpkCnt;" << std::endl;
+                    if(n.getArchetype().isSpikeEventRequired()) {
+                        os << "mergedNeuronUpdateGroup" << n.getIndex() << "ThreadSpkCntEvnt[g][thread] = threadSpkCntEvnt;" << std::endl;
+                    }
+                    genGroupTimerStop(os, "thread");
+                }
+            }
+        }
+        os << ");" << std::endl;
+
+        // Loop through merged neuron update groups
+        for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged neuron update group " << n.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto *group = &mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+                if(n.getArchetype().isDelayRequired()) {
+                    os << "const unsigned int writeDelayOffset = " << n.getCurrentQueueOffset() << ";" << std::endl;
+                }
+                genGroupTimerStart(os);
+
+                // Each thread wrote its spikes at the start of its range of neurons so, in thread
+                // order, move them down to form one contiguous and deterministically-ordered list
+                for(bool trueSpike : {true, false}) {
+                    if(!trueSpike && !n.getArchetype().isSpikeEventRequired()) {
+                        continue;
+                    }
+
+                    const bool spikeDelayRequired = trueSpike ? (n.getArchetype().isDelayRequired() && n.getArchetype().isTrueSpikeRequired()) : n.getArchetype().isDelayRequired();
+                    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
+                    const std::string suffix = trueSpike ? "" : "Evnt";
+
+                    CodeStream::Scope b(os);
+                    os << "unsigned int spkCnt = 0;" << std::endl;
+                    os << "for(unsigned int thread = 0; thread < " << getNumThreads() << "; thread++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "unsigned int begin;" << std::endl;
+                        os << "unsigned int end;" << std::endl;
+                        os << "threadPool.getRange(group->numNeurons, thread, 32, begin, end);" << std::endl;
+                        os << "const unsigned int threadSpkCnt = mergedNeuronUpdateGroup" << n.getIndex() << "ThreadSpkCnt" << suffix << "[g][thread];" << std::endl;
+                        os << "if(begin != spkCnt)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "std::copy(&group->spk" << suffix << "[" << spikeQueueOffset << "begin], &group->spk" << suffix << "[" << spikeQueueOffset << "begin + threadSpkCnt], ";
+                            os << "&group->spk" << suffix << "[" << spikeQueueOffset << "spkCnt]);" << std::endl;
+                        }
+                        os << "spkCnt += threadSpkCnt;" << std::endl;
+                    }
+                    os << "group->spkCnt" << suffix << "[" << (spikeDelayRequired ? "*group->spkQuePtr" : "0") << "] = spkCnt;" << std::endl;
+                }
+
+                // **NOTE** spikes are gathered serially so this time is added to the first thread's
+                genGroupTimerStop(os, "0");
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces&,
+                               HostHandler preambleHandler, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
+                               PresynapticUpdateGroupMergedHandler wumEventHandler, PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler,
+                               PostsynapticUpdateGroupMergedHandler postLearnHandler, SynapseDynamicsGroupMergedHandler synapseDynamicsHandler,
+                               HostHandler pushEGPHandler) const
+{
+    // Generate struct definitions
+    // **YUCK** dendritic delay update structs not actually required
+    modelMerged.genMergedSynapseDendriticDelayUpdateStructs(os, *this);
+    modelMerged.genMergedPresynapticUpdateGroupStructs(os, *this);
+    modelMerged.genMergedPostsynapticUpdateGroupStructs(os, *this);
+    modelMerged.genMergedSynapseDynamicsGroupStructs(os, *this);
+
+    // Generate arrays of merged structs and functions to set them
+    // **YUCK** dendritic delay update structs not actually required
+    genMergedStructArrayPush(os, modelMerged.getMergedSynapseDendriticDelayUpdateGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedPresynapticUpdateGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedPostsynapticUpdateGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedSynapseDynamicsGroups());
+
+    // Find largest postsynaptic population of any group whose rows are split between threads
+    // **NOTE** as groups are processed one at a time, they can all share one set of per-thread input buffers
+    const ModelSpecInternal &model = modelMerged.getModel();
+    size_t threadInSynStride = 0;
+    for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+        if(isPresynapticRowSplit(s.getArchetype())) {
+            threadInSynStride = std::max(threadInSynStride, getMaxTrgNeurons(s));
+        }
+    }
+    for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
+        if(isSynapseDynamicsThreadInSynRequired(s.getArchetype())) {
+            threadInSynStride = std::max(threadInSynStride, getMaxTrgNeurons(s));
+        }
+    }
+
+    // If any are required, generate per-thread (and, in batched models, per-instance) buffers for input and flags indicating which threads used their buffers
+    const unsigned int batchSize = model.getBatchSize();
+    if(threadInSynStride > 0) {
+        os << "static " << model.getPrecision() << " threadInSyn[" << getNumThreads() * batchSize * threadInSynStride << "];" << std::endl;
+        os << "static bool threadInSynUsed[" << getNumThreads() << "];" << std::endl;
+        os << std::endl;
+    }
+
+    // If model is batched, generate per-thread scratch arrays to merge the events of every instance of a group in
+    // **NOTE** every thread merges the same events so threads can process them without synchronising
+    const size_t batchSpkScratchSize = getBatchSpkScratchSize(modelMerged);
+    if(batchSpkScratchSize > 0) {
+        os << "static unsigned int threadBatchSpk[" << getNumThreads() * batchSpkScratchSize << "];" << std::endl;
+        os << "static unsigned int threadBatchSpkIndex[" << getNumThreads() * batchSpkScratchSize << "];" << std::endl;
+        os << "static uint32_t threadBatchSpkInstances[" << getNumThreads() * batchSpkScratchSize * ((batchSize + 31) / 32) << "];" << std::endl;
+        os << std::endl;
+    }
+    auto genBatchSpkScratchPointers =
+        [batchSpkScratchSize, batchSize](CodeStream &os)
+        {
+            if(batchSpkScratchSize > 0) {
+                os << "unsigned int *batchSpk = &threadBatchSpk[thread * " << batchSpkScratchSize << "];" << std::endl;
+                os << "unsigned int *batchSpkIndex = &threadBatchSpkIndex[thread * " << batchSpkScratchSize << "];" << std::endl;
+                os << "uint32_t *batchSpkInstances = &threadBatchSpkInstances[thread * " << batchSpkScratchSize * ((batchSize + 31) / 32) << "];" << std::endl;
+            }
+        };
+
+    // Generate preamble
+    preambleHandler(os);
+
+    os << "void updateSynapses(" << model.getTimePrecision() << " t)";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
+        funcSubs.addVarSubstitution("t", "t");
+
+        // Push any required EGPs
+        pushEGPHandler(os);
+
+        // Synapse dynamics
+        if(!modelMerged.getMergedSynapseDynamicsGroups().empty()) {
+            Timer t(os, "synapseDynamics", model.isTimingEnabled());
+
+            // Each thread updates the synapses in its range of sparse rows or targetting its range of postsynaptic neurons
+            os << "threadPool.run([&](unsigned int thread)";
+            {
+                CodeStream::Scope b(os);
+
+                // Loop through merged synapse dynamics groups
+                for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
+                    CodeStream::Scope b(os);
+                    os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << s.getGroups().size() / batchSize << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        genBatchGroupPointers(os, s, batchSize);
+
+                        genPresynapticDelayOffsets(os, s, false);
+                        genPostsynapticDelayOffsets(os, s, false);
+
+                        // If rows are split between threads, get range of rows to update on this thread
+                        const bool rowSplit = isSynapseDynamicsRowSplit(s.getArchetype());
+                        const bool threadInSynRequired = isSynapseDynamicsThreadInSynRequired(s.getArchetype());
+                        if(rowSplit) {
+                            os << "unsigned int preBegin;" << std::endl;
+                            os << "unsigned int preEnd;" << std::endl;
+                            os << "threadPool.getRange(group->numSrcNeurons, thread, 1, preBegin, preEnd);" << std::endl;
+                            if(threadInSynRequired) {
+                                os << model.getPrecision() << " *groupThreadInSyn = &threadInSyn[thread * " << batchSize * threadInSynStride << "];" << std::endl;
+                                os << "threadInSynUsed[thread] = (preEnd > preBegin);" << std::endl;
+                            }
+                        }
+                        // Otherwise, get range of postsynaptic neurons
+                        else {
+                            genPostsynapticRange(os);
+                        }
+                        genGroupTimerStart(os);
+
+                        // Loop through presynaptic neurons
+                        if(rowSplit) {
+                            os << "for(unsigned int i = preBegin; i < preEnd; i++)";
+                        }
+                        else {
+                            os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                        }
+                        {
+                            // If this synapse group has sparse connectivity, loop through length of this row
+                            CodeStream::Scope b(os);
+                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
+                            }
+                            // Otherwise, if it's dense, loop through postsynaptic neurons owned by this thread
+                            else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                os << "for (unsigned int j = postBegin; j < postEnd; j++)";
+                            }
+                            else {
+                                throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
+                            }
+                            {
+                                CodeStream::Scope b(os);
+
+                                Substitutions synSubs(&funcSubs);
+                                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                    // Calculate index of synapse and use it to look up postsynaptic index
+                                    os << "const " << getSparseAddressType(s.getArchetype()) << " n = " << getSparseRowStart(s.getArchetype(), "i") << " + s;" << std::endl;
+                                    os << "const unsigned int j = group->ind[n];" << std::endl;
+
+                                    // If rows aren't split between threads, skip synapses targetting postsynaptic neurons owned by other threads
+                                    if(!rowSplit) {
+                                        os << "if(j < postBegin || j >= postEnd)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "continue;" << std::endl;
+                                        }
+                                    }
+
+                                    synSubs.addVarSubstitution("id_syn", "n");
+                                }
+                                else {
+                                    synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                                }
+
+                                // Add pre and postsynaptic indices to substitutions
+                                synSubs.addVarSubstitution("id_pre", "i");
+                                synSubs.addVarSubstitution("id_post", "j");
+
+                                // Add correct functions for apply synaptic input
+                                if(s.getArchetype().isDendriticDelayRequired()) {
+                                    synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + s.getDendriticDelayOffset("$(1)") + "j] += $(0)");
+                                }
+                                else if(threadInSynRequired && batchSize > 1) {
+                                    synSubs.addFuncSubstitution("addToInSyn", 1, "groupThreadInSyn[(instance * " + std::to_string(threadInSynStride) + ") + j] += $(0)");
+                                }
+                                else {
+                                    synSubs.addFuncSubstitution("addToInSyn", 1, (threadInSynRequired ? "groupThreadInSyn" : "group->inSyn") + std::string("[j] += $(0)"));
+                                }
+
+                                // Call synapse dynamics handler for each instance of batched models
+                                if(batchSize > 1) {
+                                    os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+                                    {
+                                        CodeStream::Scope b(os);
+                                        os << "const auto *group = &batchGroup[instance];" << std::endl;
+                                        synapseDynamicsHandler(os, s, synSubs);
+                                    }
+                                }
+                                else {
+                                    synapseDynamicsHandler(os, s, synSubs);
+                                }
+                            }
+                        }
+
+                        // If input was accumulated into per-thread buffers, reduce them into inSyn
+                        if(threadInSynRequired) {
+                            genThreadInSynReduce(os, model.getPrecision(), getNumThreads(), threadInSynStride, batchSize);
+                        }
+                        genGroupTimerStop(os, "thread");
+                    }
+                }
+            }
+            os << ");" << std::endl;
+        }
+
+        // Presynaptic update
+        if(!modelMerged.getMergedPresynapticUpdateGroups().empty()) {
+            Timer t(os, "presynapticUpdate", model.isTimingEnabled());
+
+            // Each thread either processes its share of the presynaptic events or
+            // processes every event but only updates the synapses targetting its range of postsynaptic neurons
+            os << "threadPool.run([&](unsigned int thread)";
+            {
+                CodeStream::Scope b(os);
+                genBatchSpkScratchPointers(os);
+                unsigned int prevPostAlignment = 0;
+                for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+                    // Determine how postsynaptic neurons are split between threads when they write inSyn
+                    // **NOTE** groups whose rows are split reduce their per-thread input into word-aligned ranges
+                    const bool rowSplit = isPresynapticRowSplit(s.getArchetype());
+                    const unsigned int tileSize = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) ? s.getArchetype().getPostsynapticTileSize() : 0;
+                    const unsigned int postAlignment = (!rowSplit && tileSize > 0) ? tileSize : 32;
+
+                    // If threads own different ranges of postsynaptic neurons than in the previous group, wait for all
+                    // threads to finish the previous group so no two threads can update the same inSyn element at once
+                    if(prevPostAlignment != 0 && postAlignment != prevPostAlignment) {
+                        os << "threadPool.barrier();" << std::endl;
+                    }
+                    prevPostAlignment = postAlignment;
+
+                    CodeStream::Scope b(os);
+                    os << "// merged presynaptic update group " << s.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << s.getGroups().size() / batchSize << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        genBatchGroupPointers(os, s, batchSize);
+
+                        genPresynapticDelayOffsets(os, s, true);
+                        genPostsynapticDelayOffsets(os, s, false);
+                        genGroupTimerStart(os);
+
+                        // Get expressions for numbers of events of each type, summed over instances of batched models
+                        const std::string preSlot = s.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "[preReadDelaySlot]" : "[0]";
+                        std::string numSpikeEvents = "group->srcSpkCntEvnt" + preSlot;
+                        std::string numSpikes = "group->srcSpkCnt" + preSlot;
+                        if(batchSize > 1 && (rowSplit || isGroupTimingEnabled())) {
+                            os << "unsigned int numBatchSpikeEvents = 0;" << std::endl;
+                            os << "unsigned int numBatchSpikes = 0;" << std::endl;
+                            os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+                            {
+                                CodeStream::Scope b(os);
+                                if(s.getArchetype().isSpikeEventRequired()) {
+                                    os << "numBatchSpikeEvents += batchGroup[instance].srcSpkCntEvnt" << preSlot << ";" << std::endl;
+                                }
+                                if(s.getArchetype().isTrueSpikeRequired()) {
+                                    os << "numBatchSpikes += batchGroup[instance].srcSpkCnt" << preSlot << ";" << std::endl;
+                                }
+                            }
+                            numSpikeEvents = "numBatchSpikeEvents";
+                            numSpikes = "numBatchSpikes";
+                        }
+
+                        // Presynaptic events may be processed by every thread so only count them on the first
+                        if(isGroupTimingEnabled()) {
+                            os << "if(thread == 0)";
+                            {
+                                CodeStream::Scope b(os);
+                                if(s.getArchetype().isSpikeEventRequired()) {
+                                    os << "group->numPresynapticEvents[0] += " << numSpikeEvents << ";" << std::endl;
+                                }
+                                if(s.getArchetype().isTrueSpikeRequired()) {
+                                    os << "group->numPresynapticEvents[0] += " << numSpikes << ";" << std::endl;
+                                }
+                            }
+                        }
+
+                        Substitutions rangeSubs(&funcSubs);
+
+                        // If rows are split between threads, process this thread's share of the presynaptic
+                        // events and accumulate their input into this thread's buffer
+                        if(rowSplit) {
+                            // Count events of all types processed by this group
+                            os << "const unsigned int numEvents = ";
+                            if(s.getArchetype().isSpikeEventRequired()) {
+                                os << numSpikeEvents << " + ";
+                            }
+                            if(s.getArchetype().isTrueSpikeRequired()) {
+                                os << numSpikes << " + ";
+                            }
+                            os << "0;" << std::endl;
+
+                            // Determine whether this thread will process any events
+                            // **NOTE** in batched models, threads split the merged events of all instances so any thread might
+                            if(batchSize > 1) {
+                                os << "threadInSynUsed[thread] = (numEvents > 0);" << std::endl;
+                            }
+                            else {
+                                os << "threadInSynUsed[thread] = false;" << std::endl;
+                                if(s.getArchetype().isSpikeEventRequired()) {
+                                    os << "threadInSynUsed[thread] |= ((((uint64_t)group->srcSpkCntEvnt" << preSlot << " * (thread + 1)) / " << getNumThreads() << ") > (((uint64_t)group->srcSpkCntEvnt" << preSlot << " * thread) / " << getNumThreads() << "));" << std::endl;
+                                }
+                                if(s.getArchetype().isTrueSpikeRequired()) {
+                                    os << "threadInSynUsed[thread] |= ((((uint64_t)group->srcSpkCnt" << preSlot << " * (thread + 1)) / " << getNumThreads() << ") > (((uint64_t)group->srcSpkCnt" << preSlot << " * thread) / " << getNumThreads() << "));" << std::endl;
+                                }
+                            }
+                            os << model.getPrecision() << " *groupThreadInSyn = &threadInSyn[thread * " << batchSize * threadInSynStride << "];" << std::endl;
+
+                            rangeSubs.addVarSubstitution("id_pre_thread", "thread");
+                            rangeSubs.addVarSubstitution("num_pre_threads", std::to_string(getNumThreads()));
+                            if(batchSize > 1) {
+                                rangeSubs.addVarSubstitution("in_syn", "(groupThreadInSyn + (instance * " + std::to_string(threadInSynStride) + "))");
+                            }
+                            else {
+                                rangeSubs.addVarSubstitution("in_syn", "groupThreadInSyn");
+                            }
+                        }
+                        // Otherwise, if sparse connectivity is split into postsynaptic tiles, give each thread whole tiles
+                        else {
+                            genPostsynapticRange(os, postAlignment);
+
+                            rangeSubs.addVarSubstitution("id_post_begin", "postBegin");
+                            rangeSubs.addVarSubstitution("id_post_end", "postEnd");
+                        }
+
+                        // generate the code for processing spike-like events
+                        if (s.getArchetype().isSpikeEventRequired()) {
+                            genPresynapticUpdate(os, modelMerged, s, rangeSubs, false, wumThreshHandler, wumEventHandler, wumProceduralConnectHandler);
+                        }
+
+                        // generate the code for processing true spike events
+                        if (s.getArchetype().isTrueSpikeRequired()) {
+                            genPresynapticUpdate(os, modelMerged, s, rangeSubs, true, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
+                        }
+
+                        // If input was accumulated into per-thread buffers, reduce them into inSyn
+                        // **NOTE** every thread reads the same event counts so all, or none, reach barriers
+                        if(rowSplit) {
+                            os << "if(numEvents > 0)";
+                            genThreadInSynReduce(os, model.getPrecision(), getNumThreads(), threadInSynStride, batchSize);
+                        }
+                        genGroupTimerStop(os, "thread");
+                        os << std::endl;
+                    }
+                }
+            }
+            os << ");" << std::endl;
+        }
+
+        // Postsynaptic update
+        if(!modelMerged.getMergedPostsynapticUpdateGroups().empty()) {
+            Timer t(os, "postsynapticUpdate", model.isTimingEnabled());
+
+            // Postsynaptic spikes are split between threads - as each spike
+            // corresponds to a different column, the synapses updated are disjoint
+            os << "threadPool.run([&](unsigned int thread)";
+            {
+                CodeStream::Scope b(os);
+                genBatchSpkScratchPointers(os);
+                for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
+                    CodeStream::Scope b(os);
+                    os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << s.getGroups().size() / batchSize << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        genBatchGroupPointers(os, s, batchSize);
+
+                        genPresynapticDelayOffsets(os, s, false);
+                        genPostsynapticDelayOffsets(os, s, true);
+                        genGroupTimerStart(os);
+
+                        // Get number of postsynaptic spikes
+                        const std::string trgSpkCnt = (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) ? "group->trgSpkCnt[postReadDelaySlot]" : "group->trgSpkCnt[0]";
+                        const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postReadDelayOffset + " : "";
+                        if(batchSize > 1) {
+                            genBatchSpkMerge(os, batchSize, trgSpkCnt, "group->trgSpk[" + offsetTrueSpkPost + "i]");
+                            os << "const unsigned int numSpikes = numBatchSpk;" << std::endl;
+                        }
+                        else {
+                            os << "const unsigned int numSpikes = " << trgSpkCnt << ";" << std::endl;
+                        }
+
+                        // Get range of spikes to process on this thread
+                        os << "unsigned int spikeBegin;" << std::endl;
+                        os << "unsigned int spikeEnd;" << std::endl;
+                        os << "threadPool.getRange(numSpikes, thread, 1, spikeBegin, spikeEnd);" << std::endl;
+
+                        // Loop through postsynaptic spikes
+                        os << "for (unsigned int j = spikeBegin; j < spikeEnd; j++)";
+                        {
+                            CodeStream::Scope b(os);
+
+                            if(batchSize > 1) {
+                                os << "const unsigned int spike = batchSpk[j];" << std::endl;
+                                genBatchSpkInstances(os, batchSize, "j");
+                            }
+                            else {
+                                os << "const unsigned int spike = group->trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
+                            }
+
+                            // Loop through column of presynaptic neurons
+                            if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                os << "const unsigned int npre = group->colLength[spike];" << std::endl;
+                                os << "for (unsigned int i = 0; i < npre; i++)";
+                            }
+                            else {
+                                os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                            }
+                            {
+                                CodeStream::Scope b(os);
+
+                                Substitutions synSubs(&funcSubs);
+                                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                    os << "const unsigned int colMajorIndex = (spike * group->colStride) + i;" << std::endl;
+                                    os << "const " << getSparseAddressType(s.getArchetype()) << " rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
+
+                                    // If presynaptic indices are stored alongside remapping, read them (once for all instances of batched models)
+                                    if(isRemapPreInd(s.getArchetype()) && batchSize > 1) {
+                                        os << "const unsigned int preIndex = group->remapPreInd[colMajorIndex];" << std::endl;
+                                        synSubs.addVarSubstitution("id_pre", "preIndex");
+                                    }
+                                    else if(isRemapPreInd(s.getArchetype())) {
+                                        synSubs.addVarSubstitution("id_pre", "group->remapPreInd[colMajorIndex]");
+                                    }
+                                    // Otherwise, if connectivity is compact, search row starts for the row containing synapse
+                                    else if(isCompactSparse(s.getArchetype())) {
+                                        os << "const unsigned int preIndex = (unsigned int)(std::upper_bound(group->rowPtr, group->rowPtr + group->numSrcNeurons + 1, rowMajorIndex) - group->rowPtr) - 1;" << std::endl;
+                                        synSubs.addVarSubstitution("id_pre", "preIndex");
+                                    }
+                                    // Otherwise, divide by stride
+                                    // **TODO** fast divide optimisations
+                                    else {
+                                        synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group->rowStride)");
+                                    }
+                                    synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                }
+                                else {
+                                    synSubs.addVarSubstitution("id_pre", "i");
+                                    synSubs.addVarSubstitution("id_syn", "((group->numTrgNeurons * i) + spike)");
+                                }
+                                synSubs.addVarSubstitution("id_post", "spike");
+
+                                // Apply to each instance of batched models in which postsynaptic neuron spiked
+                                if(batchSize > 1) {
+                                    os << "for(unsigned int bi = 0; bi < numBatchInstances; bi++)";
+                                    {
+                                        CodeStream::Scope b(os);
+                                        os << "const auto *group = &batchGroup[batchInstances[bi]];" << std::endl;
+                                        postLearnHandler(os, s, synSubs);
+                                    }
+                                }
+                                else {
+                                    postLearnHandler(os, s, synSubs);
+                                }
+                            }
+                        }
+                        genGroupTimerStop(os, "thread");
+                        os << std::endl;
+                    }
+                }
+            }
+            os << ");" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces&,
+                      HostHandler preambleHandler, NeuronInitGroupMergedHandler localNGHandler, SynapseDenseInitGroupMergedHandler sgDenseInitHandler,
+                      SynapseConnectivityInitMergedGroupHandler sgSparseRowConnectHandler, SynapseConnectivityInitMergedGroupHandler sgSparseColConnectHandler, 
+                      SynapseConnectivityInitMergedGroupHandler sgKernelInitHandler, SynapseSparseInitGroupMergedHandler sgSparseInitHandler,
+                      HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    // Generate struct definitions
+    modelMerged.genMergedNeuronInitGroupStructs(os, *this);
+    modelMerged.genMergedSynapseDenseInitGroupStructs(os, *this);
+    modelMerged.genMergedSynapseConnectivityInitGroupStructs(os, *this);
+    modelMerged.genMergedSynapseSparseInitGroupStructs(os, *this);
+
+    // Generate arrays of merged structs and functions to set them
+    genMergedStructArrayPush(os, modelMerged.getMergedNeuronInitGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedSynapseDenseInitGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedSynapseConnectivityInitGroups());
+    genMergedStructArrayPush(os, modelMerged.getMergedSynapseSparseInitGroups());
+
+    // Generate preamble
+    preambleHandler(os);
+
+    os << "void initialize()";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
+
+        // Push any required EGPs
+        initPushEGPHandler(os);
+
+        Timer t(os, "init", model.isTimingEnabled());
+
+        // Initialisation code uses PhiloxRNG streams created by genVariableInit etc
+        funcSubs.addVarSubstitution("rng", "rng");
+
+        // Initialise neuron and dense synapse variables in parallel
+        // **NOTE** genVariableInit and genSynapseVariableRowInit split variables between threads
+        if(!modelMerged.getMergedNeuronInitGroups().empty() || !modelMerged.getMergedSynapseDenseInitGroups().empty()) {
+            os << "threadPool.run([&](unsigned int thread)";
+            {
+                CodeStream::Scope b(os);
+                genInitNeuronGroups(os, modelMerged, funcSubs, localNGHandler);
+                genInitSynapseDenseGroups(os, modelMerged, funcSubs, sgDenseInitHandler);
+            }
+            os << ");" << std::endl;
+        }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with sparse connectivity" << std::endl;
+        os << "// **NOTE** skipped if connectivity has been loaded from cache by loadConnectivityCache" << std::endl;
+        os << "if(!connectivityCacheLoaded)" << CodeStream::OB(1);
+        for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto *group = &mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                genGroupTimerStart(os);
+
+                // Zero connectivity
+                genInitConnectivityZero(os, s);
+
+                // If connectivity is compact, count synapses in each row and lay out rows before building connectivity
+                // **NOTE** row and column RNG streams are recreated for each pass so the same synapses are generated
+                const bool compact = isCompactSparse(s.getArchetype());
+                for(bool countOnly : {true, false}) {
+                    if(countOnly && !compact) {
+                        continue;
+                    }
+
+                    // If there is row-building code in this snippet, build rows in parallel
+                    // **NOTE** with bitmask connectivity, rows are split between threads
+                    // in multiples of 32 so no two threads write to the same word
+                    const auto *snippet = s.getArchetype().getConnectivityInitialiser().getSnippet();
+                    if(!snippet->getRowBuildCode().empty()) {
+                        const unsigned int alignment = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) ? 32 : 1;
+                        os << "threadPool.run([&](unsigned int thread)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "unsigned int begin;" << std::endl;
+                            os << "unsigned int end;" << std::endl;
+                            os << "threadPool.getRange(group->numSrcNeurons, thread, " << alignment << ", begin, end);" << std::endl;
+                            genInitConnectivityLoop(os, s, funcSubs, "begin", "end",
+                                                    sgSparseRowConnectHandler, sgSparseColConnectHandler, sgKernelInitHandler, countOnly);
+                        }
+                        os << ");" << std::endl;
+                    }
+                    // Otherwise, as building a column can add synapses to any row, build columns serially
+                    else {
+                        genInitConnectivityLoop(os, s, funcSubs, "0", "group->numTrgNeurons",
+                                                sgSparseRowConnectHandler, sgSparseColConnectHandler, sgKernelInitHandler, countOnly);
+                    }
+
+                    // Once synapses have been counted, lay out rows
+                    if(countOnly) {
+                        genInitCompactSparseRowPtr(os, s);
+                    }
+                }
+
+                // **NOTE** groups are initialised one at a time so time is added to the first thread's
+                genGroupTimerStop(os, "0");
+            }
+        }
+        os << CodeStream::CB(1);
+    }
+    os << std::endl;
+    os << "void initializeSparse()";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
+
+        // Push any required EGPs
+        initSparsePushEGPHandler(os);
+
+        Timer t(os, "initSparse", model.isTimingEnabled());
+
+        // Initialisation code uses PhiloxRNG streams created by genSynapseVariableRowInit
+        funcSubs.addVarSubstitution("rng", "rng");
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with sparse connectivity" << std::endl;
+        os << "// **NOTE** skipped if connectivity has been loaded from cache by loadConnectivityCache" << std::endl;
+        os << "if(!connectivityCacheLoaded)" << CodeStream::OB(2);
+        for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto *group = &mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                genGroupTimerStart(os);
+
+                // If postsynaptic learning is required, column lengths and remapping are built using a parallel
+                // counting sort - firstly each thread counts the synapses in its rows targetting each postsynaptic neuron
+                const bool postLearn = !s.getArchetype().getWUModel()->getLearnPostCode().empty();
+                if(postLearn) {
+                    os << "std::vector<unsigned int> threadColLength(" << getNumThreads() << " * group->numTrgNeurons, 0);" << std::endl;
+                }
+
+                os << "threadPool.run([&](unsigned int thread)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "unsigned int begin;" << std::endl;
+                    os << "unsigned int end;" << std::endl;
+                    os << "threadPool.getRange(group->numSrcNeurons, thread, 1, begin, end);" << std::endl;
+                    if(postLearn) {
+                        os << "unsigned int *colLength = &threadColLength[thread * group->numTrgNeurons];" << std::endl;
+                    }
+
+                    os << "// Loop through presynaptic neurons" << std::endl;
+                    os << "for (unsigned int i = begin; i < end; i++)" << std::endl;
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Generate sparse initialisation code
+                        genInitSparseRowVars(os, s, funcSubs, sgSparseInitHandler);
+
+                        // Find where each postsynaptic tile starts within row
+                        genInitSparseRowTiles(os, s);
+
+                        // Encode row's indices as deltas
+                        genInitSparseRowDeltas(os, s);
+
+                        // Count synapses in row targetting each postsynaptic neuron
+                        if(postLearn) {
+                            os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "colLength[group->ind[" << getSparseRowStart(s.getArchetype(), "i") << " + j]]++;" << std::endl;
+                            }
+                        }
+                    }
+                }
+                os << ");" << std::endl;
+
+                if(postLearn) {
+                    // Secondly, an exclusive scan across threads of each postsynaptic neuron's counts gives
+                    // the offset within each column at which each thread should start writing remap entries
+                    os << "threadPool.run([&](unsigned int thread)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "unsigned int begin;" << std::endl;
+                        os << "unsigned int end;" << std::endl;
+                        os << "threadPool.getRange(group->numTrgNeurons, thread, 1, begin, end);" << std::endl;
+                        os << "for(unsigned int j = begin; j < end; j++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "unsigned int colLength = 0;" << std::endl;
+                            os << "for(unsigned int t = 0; t < " << getNumThreads() << "; t++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "const unsigned int count = threadColLength[(t * group->numTrgNeurons) + j];" << std::endl;
+                                os << "threadColLength[(t * group->numTrgNeurons) + j] = colLength;" << std::endl;
+                                os << "colLength += count;" << std::endl;
+                            }
+                            os << "group->colLength[j] = colLength;" << std::endl;
+                        }
+                    }
+                    os << ");" << std::endl;
+
+                    // Finally, each thread fills in the remapping for its rows - this
+                    // results in the same column ordering as building them serially
+                    os << "threadPool.run([&](unsigned int thread)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "unsigned int begin;" << std::endl;
+                        os << "unsigned int end;" << std::endl;
+                        os << "threadPool.getRange(group->numSrcNeurons, thread, 1, begin, end);" << std::endl;
+                        os << "unsigned int *colOffset = &threadColLength[thread * group->numTrgNeurons];" << std::endl;
+                        os << "for (unsigned int i = begin; i < end; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "const " << getSparseAddressType(s.getArchetype()) << " rowMajorIndex = " << getSparseRowStart(s.getArchetype(), "i") << " + j;" << std::endl;
+                                os << "const unsigned int postIndex = group->ind[rowMajorIndex];" << std::endl;
+                                os << "const unsigned int colMajorIndex = (postIndex * group->colStride) + colOffset[postIndex]++;" << std::endl;
+                                os << "group->remap[colMajorIndex] = rowMajorIndex;" << std::endl;
+                                if(isRemapPreInd(s.getArchetype())) {
+                                    os << "group->remapPreInd[colMajorIndex] = i;" << std::endl;
+                                }
+                            }
+                        }
+                    }
+                    os << ");" << std::endl;
+                }
+
+                // **NOTE** groups are initialised one at a time so time is added to the first thread's
+                genGroupTimerStop(os, "0");
+            }
+        }
+        os << CodeStream::CB(2);
+
+        // Reset flag so subsequent calls to initialize() regenerate connectivity
+        os << "connectivityCacheLoaded = false;" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
+{
+    // Population variables are initialised by first thread
+    os << "if(thread == 0)";
+    {
+        CodeStream::Scope b(os);
+        SingleThreadedCPU::Backend::genPopVariableInit(os, kernelSubs, handler);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                              const Substitutions &kernelSubs, Handler handler) const
+{
+    // Initialise the elements of variable in this thread's range
+    CodeStream::Scope b(os);
+    os << "unsigned int begin;" << std::endl;
+    os << "unsigned int end;" << std::endl;
+    os << "threadPool.getRange(" << count << ", thread, 1, begin, end);" << std::endl;
+    genVariableInitLoop(os, "begin", "end", indexVarName, kernelSubs, handler);
+}
+//--------------------------------------------------------------------------
+void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMergedBase &sg,
+                                        const Substitutions &kernelSubs, Handler handler) const
+{
+    // Rows of sparse connectivity are already split between threads
+    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        SingleThreadedCPU::Backend::genSynapseVariableRowInit(os, sg, kernelSubs, handler);
+    }
+    // Otherwise, as every thread loops over all rows of dense connectivity, initialise the synapses in this thread's range of columns
+    else {
+        CodeStream::Scope b(os);
+        os << "unsigned int begin;" << std::endl;
+        os << "unsigned int end;" << std::endl;
+        os << "threadPool.getRange(group->numTrgNeurons, thread, 1, begin, end);" << std::endl;
+        genSynapseVariableRowInitLoop(os, sg, "begin", "end", kernelSubs, handler);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    SingleThreadedCPU::Backend::genDefinitionsInternalPreamble(os, modelMerged);
+
+    os << "// Thread pool used to parallelise updates" << std::endl;
+    os << "#include \"multi_threaded_cpu/threadPool.h\"" << std::endl;
+    os << "extern ThreadPool threadPool;" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    SingleThreadedCPU::Backend::genRunnerPreamble(os, modelMerged);
+
+    os << "ThreadPool threadPool(" << getNumThreads() << ");" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genMakefilePreamble(std::ostream &os) const
+{
+    SingleThreadedCPU::Backend::genMakefilePreamble(os);
+
+    // Add flags required to use std::thread
+    os << "CXXFLAGS += -pthread" << std::endl;
+    os << "LINKFLAGS += -pthread" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+std::vector<filesystem::path> Backend::getFilesToCopy(const ModelSpecMerged &modelMerged) const
+{
+    auto files = SingleThreadedCPU::Backend::getFilesToCopy(modelMerged);
+    files.push_back(filesystem::path("multi_threaded_cpu") / "threadPool.h");
+    return files;
+}
+//--------------------------------------------------------------------------
+void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const
+{
+    // Determine if delay is required and thus, at what offset we should write into the spike queue
+    const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
+    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
+
+    // Write spike into the part of the spike queue corresponding to this thread's range
+    // of neurons - the spikes emitted by each thread are compacted after the update
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    os << "group->spk" << suffix << "[" << spikeQueueOffset << "begin + threadSpkCnt" << suffix << "++] = " << subs["id"] << ";" << std::endl;
+
+    // Reset spike and spike-like-event times
+    const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
+    if(trueSpike && ng.getArchetype().isSpikeTimeRequired()) {
+        os << "group->sT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+    }
+    else if(!trueSpike && ng.getArchetype().isSpikeEventTimeRequired()) {
+        os << "group->seT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+    }
+
+    // If recording is enabled
+    // **NOTE** neuron ranges are word-aligned so no other thread writes to this word
+    if(recordingEnabled) {
+        const std::string recordSuffix = trueSpike ? "" : "Event";
+        os << "group->recordSpk" << recordSuffix << "[(recordingTimestep * numRecordingWords) + (" << subs["id"] << " / 32)]";
+        os << " |= (1 << (" << subs["id"] << " % 32));" << std::endl;
+    }
+}
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
@@ -0,0 +1,45 @@
+#include "optimiser.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <thread>
+
+// PLOG includes
+#include <plog/Log.h>
+
+// GeNN includes
+#include "logging.h"
+#include "modelSpecInternal.h"
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Optimiser
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+namespace Optimiser
+{
+Backend createBackend(const ModelSpecInternal &model, const filesystem::path&,
+                      const filesystem::path &, plog::Severity backendLevel,
+                      plog::IAppender *backendAppender, const Preferences &preferences)
+{
+    // If there isn't already a plog instance, initialise one
+    if(plog::get<Logging::CHANNEL_BACKEND>() == nullptr) {
+        plog::init<Logging::CHANNEL_BACKEND>(backendLevel, backendAppender);
+    }
+    // Otherwise, set it's max severity from GeNN preferences
+    else {
+        plog::get<Logging::CHANNEL_BACKEND>()->setMaxSeverity(backendLevel);
+    }
+
+    // If number of threads isn't specified, use one per hardware thread
+    // **NOTE** hardware_concurrency may return zero if it can't be determined
+    const unsigned int numThreads = (preferences.numThreads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : preferences.numThreads;
+    LOGI_BACKEND << "Generating code for " << numThreads << " threads";
+
+    return Backend(model.getPrecision(), preferences, numThreads);
+}
+}   // namespace Optimiser
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
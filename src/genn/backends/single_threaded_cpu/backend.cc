@@ -17,19 +17,37 @@ using namespace CodeGenerator;
 namespace
 {
 const std::vector<Substitutions::FunctionTemplate> cpuSinglePrecisionFunctions = {
-    {"gennrand_uniform", 0, "standardUniformDistribution($(rng))"},
-    {"gennrand_normal", 0, "standardNormalDistribution($(rng))"},
-    {"gennrand_exponential", 0, "standardExponentialDistribution($(rng))"},
-    {"gennrand_log_normal", 2, "std::lognormal_distribution<float>($(0), $(1))($(rng))"},
-    {"gennrand_gamma", 1, "std::gamma_distribution<float>($(0), 1.0f)($(rng))"}
+    {"gennrand_uniform", 0, "philoxUniform<float>($(rng))"},
+    {"gennrand_normal", 0, "philoxNormal<float>($(rng))"},
+    {"gennrand_exponential", 0, "philoxExponential<float>($(rng))"},
+    {"gennrand_log_normal", 2, "philoxLogNormal<float>($(rng), $(0), $(1))"},
+    {"gennrand_gamma", 1, "philoxGamma<float>($(rng), $(0))"}
 };
 //--------------------------------------------------------------------------
 const std::vector<Substitutions::FunctionTemplate> cpuDoublePrecisionFunctions = {
-    {"gennrand_uniform", 0, "standardUniformDistribution($(rng))"},
-    {"gennrand_normal", 0, "standardNormalDistribution($(rng))"},
-    {"gennrand_exponential", 0, "standardExponentialDistribution($(rng))"},
-    {"gennrand_log_normal", 2, "std::lognormal_distribution<double>($(0), $(1))($(rng))"},
-    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))"}
+    {"gennrand_uniform", 0, "philoxUniform<double>($(rng))"},
+    {"gennrand_normal", 0, "philoxNormal<double>($(rng))"},
+    {"gennrand_exponential", 0, "philoxExponential<double>($(rng))"},
+    {"gennrand_log_normal", 2, "philoxLogNormal<double>($(rng), $(0), $(1))"},
+    {"gennrand_gamma", 1, "philoxGamma<double>($(rng), $(0))"}
+};
+
+//! Number of postsynaptic neurons processed together by blocked presynaptic updates
+//! **NOTE** this is a multiple of 64 so blocks of bitmask connectivity are processed in whole 64-bit windows
+const unsigned int presynapticUpdateBlockSize = 1024;
+
+//--------------------------------------------------------------------------
+// PhiloxStream
+//--------------------------------------------------------------------------
+//! Purposes for which Philox RNG streams are created - combined with merged group index so every stream is distinct
+enum class PhiloxStream : uint32_t
+{
+    NeuronUpdate            = 1,
+    NeuronInit              = 2,
+    SynapseDenseInit        = 3,
+    SynapseConnectivityInit = 4,
+    SynapseSparseInit       = 5,
+    SynapseProcedural       = 6,
 };
 
 //--------------------------------------------------------------------------
@@ -65,11 +83,32 @@ private:
 };
 
 //-----------------------------------------------------------------------
-const std::vector<Substitutions::FunctionTemplate> &getFunctionTemplates(const std::string &precision)
+std::string getPhiloxStream(PhiloxStream stream, size_t mergedGroupIndex)
 {
-    return (precision == "double") ? cpuDoublePrecisionFunctions : cpuSinglePrecisionFunctions;
+    return std::to_string(((uint32_t)stream << 24) | (uint32_t)mergedGroupIndex) + "u";
+}
+//-----------------------------------------------------------------------
+uint32_t hashCode(const std::string &code)
+{
+    // 32-bit FNV-1a hash
+    uint32_t hash = 2166136261u;
+    for(char c : code) {
+        hash = (hash ^ (uint8_t)c) * 16777619u;
+    }
+    return hash;
+}
+//-----------------------------------------------------------------------
+void genInitRNG(CodeStream &os, const Substitutions &kernelSubs, const std::string &id, const std::string &initCode)
+{
+    // **NOTE** each variable is initialised in a separate loop so use hash of code to give each its own stream
+    os << "PhiloxRNG rng(philoxSeed, " << kernelSubs["rng_stream"] << ", g, " << id << ", " << hashCode(initCode) << "u);" << std::endl;
+}
+//-----------------------------------------------------------------------
+std::string getSparseIndDeltaEscape(const SynapseGroupInternal &sg)
+{
+    // **NOTE** the largest value of the delta type is reserved to indicate the full index should be read instead
+    return (sg.getSparseIndDeltaType() == "uint8_t") ? "0xFFu" : "0xFFFFu";
 }
-
 }
 
 //--------------------------------------------------------------------------
@@ -112,66 +151,9 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
         Timer t(os, "neuronUpdate", model.isTimingEnabled());
 
-        // Loop through merged neuron spike queue update groups
-        for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
-
-                // If previous spikes times are required
-                if(n.getArchetype().isPrevSpikeTimeRequired() || n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                    if(n.getArchetype().isDelayRequired()) {
-                        // Calculate delay slot corresponding to last timestep
-                        os << "const unsigned int lastTimestepDelaySlot = (*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots() << ";" << std::endl;
-                        os << "const unsigned int lastTimestepDelayOffset = lastTimestepDelaySlot * group->numNeurons;" << std::endl;
-
-                        if(n.getArchetype().isPrevSpikeTimeRequired()) {
-                            // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                            os << "for(unsigned int i = 0; i < group->spkCnt[lastTimestepDelaySlot]; i++)";
-                            {
-                                CodeStream::Scope b(os);
-                                os << "group->prevST[lastTimestepDelayOffset + group->spk[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
-                            }
-                        }
-                        if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                            // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                            os << "for(unsigned int i = 0; i < group->spkCntEvnt[lastTimestepDelaySlot]; i++)";
-                            {
-                                CodeStream::Scope b(os);
-                                os << "group->prevSET[lastTimestepDelayOffset + group->spkEvnt[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
-                            }
-                        }
-                    }
-                    else {
-                        if(n.getArchetype().isPrevSpikeTimeRequired()) {
-                            // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                            os << "for(unsigned int i = 0; i < group->spkCnt[0]; i++)";
-                            {
-                                CodeStream::Scope b(os);
-                                os << "group->prevST[group->spk[i]] = t - DT;" << std::endl;
-                            }
-                        }
-                        if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                            // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                            os << "for(unsigned int i = 0; i < group->spkCntEvnt[0]; i++)";
-                            {
-                                CodeStream::Scope b(os);
-                                os << "group->prevSET[group->spkEvnt[i]] = t - DT;" << std::endl;
-                            }
-                        }
-                    }
-                }
+        // Update spike queues
+        genNeuronSpikeQueueUpdate(os, modelMerged);
 
-                // Generate spike count reset
-                n.genMergedGroupSpikeCountReset(os);
-            }
-            
-        }
         // Loop through merged neuron update groups
         for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
             CodeStream::Scope b(os);
@@ -182,6 +164,7 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
                 // Get reference to group
                 os << "const auto *group = &mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+                genGroupTimerStart(os);
 
                 // If spike or spike-like event recording is in use
                 if(n.getArchetype().isSpikeRecordingEnabled() || n.getArchetype().isSpikeEventRecordingEnabled()) {
@@ -208,35 +191,9 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                 }
                 os << std::endl;
 
-                os << "for(unsigned int i = 0; i < group->numNeurons; i++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    Substitutions popSubs(&funcSubs);
-                    popSubs.addVarSubstitution("id", "i");
-
-                    // If this neuron group requires a simulation RNG, substitute in global RNG
-                    if(n.getArchetype().isSimRNGRequired()) {
-                        popSubs.addVarSubstitution("rng", "hostRNG");
-                    }
-
-                    simHandler(os, n, popSubs,
-                               // Emit true spikes
-                               [this, wuVarUpdateHandler](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                               {
-                                   // Insert code to update WU vars
-                                   wuVarUpdateHandler(os, ng, subs);
-
-                                   // Insert code to emit true spikes
-                                   genEmitSpike(os, ng, subs, true, ng.getArchetype().isSpikeRecordingEnabled());
-                               },
-                               // Emit spike-like events
-                               [this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                               {
-                                   // Insert code to emit spike-like events
-                                   genEmitSpike(os, ng, subs, false, ng.getArchetype().isSpikeEventRecordingEnabled());
-                               });
-                }
+                // Update neurons
+                genNeuronUpdateLoop(os, n, funcSubs, "0", "group->numNeurons", simHandler, wuVarUpdateHandler);
+                genGroupTimerStop(os, "0");
             }
         }
     }
@@ -244,7 +201,7 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 //--------------------------------------------------------------------------
 void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, MemorySpaces&,
                                HostHandler preambleHandler, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
-                               PresynapticUpdateGroupMergedHandler wumEventHandler, PresynapticUpdateGroupMergedHandler,
+                               PresynapticUpdateGroupMergedHandler wumEventHandler, PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler,
                                PostsynapticUpdateGroupMergedHandler postLearnHandler, SynapseDynamicsGroupMergedHandler synapseDynamicsHandler,
                                HostHandler pushEGPHandler) const
 {
@@ -262,10 +219,21 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
     genMergedStructArrayPush(os, modelMerged.getMergedPostsynapticUpdateGroups());
     genMergedStructArrayPush(os, modelMerged.getMergedSynapseDynamicsGroups());
 
+    // If model is batched, generate scratch arrays to merge the events of every instance of a group in
+    // **NOTE** batchSpkIndex must start zeroed and is re-zeroed after each merge
+    const ModelSpecInternal &model = modelMerged.getModel();
+    const unsigned int batchSize = model.getBatchSize();
+    const size_t batchSpkScratchSize = getBatchSpkScratchSize(modelMerged);
+    if(batchSpkScratchSize > 0) {
+        os << "static unsigned int batchSpk[" << batchSpkScratchSize << "];" << std::endl;
+        os << "static unsigned int batchSpkIndex[" << batchSpkScratchSize << "];" << std::endl;
+        os << "static uint32_t batchSpkInstances[" << batchSpkScratchSize * ((batchSize + 31) / 32) << "];" << std::endl;
+        os << std::endl;
+    }
+
     // Generate preamble
     preambleHandler(os);
 
-    const ModelSpecInternal &model = modelMerged.getModel();
     os << "void updateSynapses(" << model.getTimePrecision() << " t)";
     {
         CodeStream::Scope b(os);
@@ -282,12 +250,13 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
             for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
                 CodeStream::Scope b(os);
                 os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                os << "for(unsigned int g = 0; g < " << s.getGroups().size() / batchSize << "; g++)";
                 {
                     CodeStream::Scope b(os);
 
                     // Get reference to group
-                    os << "const auto *group = &mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
+                    genBatchGroupPointers(os, s, batchSize);
+                    genGroupTimerStart(os);
 
                     // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
                     if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
@@ -328,7 +297,7 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                             Substitutions synSubs(&funcSubs);
                             if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                                 // Calculate index of synapse and use it to look up postsynaptic index
-                                os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
+                                os << "const " << getSparseAddressType(s.getArchetype()) << " n = " << getSparseRowStart(s.getArchetype(), "i") << " + s;" << std::endl;
                                 os << "const unsigned int j = group->ind[n];" << std::endl;
 
                                 synSubs.addVarSubstitution("id_syn", "n");
@@ -349,10 +318,21 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                                 synSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[j] += $(0)");
                             }
 
-                            // Call synapse dynamics handler
-                            synapseDynamicsHandler(os, s, synSubs);
+                            // Call synapse dynamics handler for each instance of batched models
+                            if(batchSize > 1) {
+                                os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "const auto *group = &batchGroup[instance];" << std::endl;
+                                    synapseDynamicsHandler(os, s, synSubs);
+                                }
+                            }
+                            else {
+                                synapseDynamicsHandler(os, s, synSubs);
+                            }
                         }
                     }
+                    genGroupTimerStop(os, "0");
                 }
             }
         }
@@ -363,12 +343,13 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
             for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
                 CodeStream::Scope b(os);
                 os << "// merged presynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                os << "for(unsigned int g = 0; g < " << s.getGroups().size() / batchSize << "; g++)";
                 {
                     CodeStream::Scope b(os);
 
                     // Get reference to group
-                    os << "const auto *group = &mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+                    genBatchGroupPointers(os, s, batchSize);
+                    genGroupTimerStart(os);
 
                     // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
                     if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
@@ -391,13 +372,14 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 
                     // generate the code for processing spike-like events
                     if (s.getArchetype().isSpikeEventRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler);
+                        genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler, wumProceduralConnectHandler);
                     }
 
                     // generate the code for processing true spike events
                     if (s.getArchetype().isTrueSpikeRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler);
+                        genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
                     }
+                    genGroupTimerStop(os, "0");
                     os << std::endl;
                 }
             }
@@ -409,12 +391,13 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
             for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
                 CodeStream::Scope b(os);
                 os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                os << "for(unsigned int g = 0; g < " << s.getGroups().size() / batchSize << "; g++)";
                 {
                     CodeStream::Scope b(os);
 
                     // Get reference to group
-                    os << "const auto *group = &mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+                    genBatchGroupPointers(os, s, batchSize);
+                    genGroupTimerStart(os);
 
                     // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
                     if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
@@ -436,11 +419,14 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                     }
 
                     // Get number of postsynaptic spikes
-                    if (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) {
-                        os << "const unsigned int numSpikes = group->trgSpkCnt[postReadDelaySlot];" << std::endl;
+                    const std::string trgSpkCnt = (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) ? "group->trgSpkCnt[postReadDelaySlot]" : "group->trgSpkCnt[0]";
+                    const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postReadDelayOffset + " : "";
+                    if(batchSize > 1) {
+                        genBatchSpkMerge(os, batchSize, trgSpkCnt, "group->trgSpk[" + offsetTrueSpkPost + "i]");
+                        os << "const unsigned int numSpikes = numBatchSpk;" << std::endl;
                     }
                     else {
-                        os << "const unsigned int numSpikes = group->trgSpkCnt[0];" << std::endl;
+                        os << "const unsigned int numSpikes = " << trgSpkCnt << ";" << std::endl;
                     }
 
                     // Loop through postsynaptic spikes
@@ -448,8 +434,13 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                     {
                         CodeStream::Scope b(os);
 
-                        const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postReadDelayOffset + " : "";
-                        os << "const unsigned int spike = group->trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
+                        if(batchSize > 1) {
+                            os << "const unsigned int spike = batchSpk[j];" << std::endl;
+                            genBatchSpkInstances(os, batchSize, "j");
+                        }
+                        else {
+                            os << "const unsigned int spike = group->trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
+                        }
 
                         // Loop through column of presynaptic neurons
                         if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
@@ -465,10 +456,26 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                             Substitutions synSubs(&funcSubs);
                             if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                                 os << "const unsigned int colMajorIndex = (spike * group->colStride) + i;" << std::endl;
-                                os << "const unsigned int rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
-
+                                os << "const " << getSparseAddressType(s.getArchetype()) << " rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
+
+                                // If presynaptic indices are stored alongside remapping, read them (once for all instances of batched models)
+                                if(isRemapPreInd(s.getArchetype()) && batchSize > 1) {
+                                    os << "const unsigned int preIndex = group->remapPreInd[colMajorIndex];" << std::endl;
+                                    synSubs.addVarSubstitution("id_pre", "preIndex");
+                                }
+                                else if(isRemapPreInd(s.getArchetype())) {
+                                    synSubs.addVarSubstitution("id_pre", "group->remapPreInd[colMajorIndex]");
+                                }
+                                // Otherwise, if connectivity is compact, search row starts for the row containing synapse
+                                else if(isCompactSparse(s.getArchetype())) {
+                                    os << "const unsigned int preIndex = (unsigned int)(std::upper_bound(group->rowPtr, group->rowPtr + group->numSrcNeurons + 1, rowMajorIndex) - group->rowPtr) - 1;" << std::endl;
+                                    synSubs.addVarSubstitution("id_pre", "preIndex");
+                                }
+                                // Otherwise, divide by stride
                                 // **TODO** fast divide optimisations
-                                synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group->rowStride)");
+                                else {
+                                    synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group->rowStride)");
+                                }
                                 synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
                             }
                             else {
@@ -477,9 +484,21 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                             }
                             synSubs.addVarSubstitution("id_post", "spike");
 
-                            postLearnHandler(os, s, synSubs);
+                            // Apply to each instance of batched models in which postsynaptic neuron spiked
+                            if(batchSize > 1) {
+                                os << "for(unsigned int bi = 0; bi < numBatchInstances; bi++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "const auto *group = &batchGroup[batchInstances[bi]];" << std::endl;
+                                    postLearnHandler(os, s, synSubs);
+                                }
+                            }
+                            else {
+                                postLearnHandler(os, s, synSubs);
+                            }
                         }
                     }
+                    genGroupTimerStop(os, "0");
                     os << std::endl;
                 }
             }
@@ -520,45 +539,16 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
 
         Timer t(os, "init", model.isTimingEnabled());
 
-        // If model requires a host RNG, add RNG to substitutions
-        if(isGlobalHostRNGRequired(modelMerged)) {
-            funcSubs.addVarSubstitution("rng", "hostRNG");
-        }
-
-        os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Local neuron groups" << std::endl;
-        for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron init group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                localNGHandler(os, n, popSubs);
-            }
-        }
-
-        os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Synapse groups with dense connectivity" << std::endl;
-        for(const auto &s : modelMerged.getMergedSynapseDenseInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged synapse dense init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+        // Initialisation code uses PhiloxRNG streams created by genVariableInit etc
+        funcSubs.addVarSubstitution("rng", "rng");
 
-                // Get reference to group
-                os << "const auto *group = &mergedSynapseDenseInitGroup" << s.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                sgDenseInitHandler(os, s, popSubs);
-            }
-        }
+        genInitNeuronGroups(os, modelMerged, funcSubs, localNGHandler);
+        genInitSynapseDenseGroups(os, modelMerged, funcSubs, sgDenseInitHandler);
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with sparse connectivity" << std::endl;
+        os << "// **NOTE** skipped if connectivity has been loaded from cache by loadConnectivityCache" << std::endl;
+        os << "if(!connectivityCacheLoaded)" << CodeStream::OB(1);
         for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
             CodeStream::Scope b(os);
             os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
@@ -568,140 +558,28 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
 
                 // Get reference to group
                 os << "const auto *group = &mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                genGroupTimerStart(os);
 
-                // If matrix connectivity is ragged
-                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                    // Zero row lengths
-                    os << "memset(group->rowLength, 0, group->numSrcNeurons * sizeof(unsigned int));" << std::endl;
-                }
-                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << "const size_t gpSize = ((((size_t)group->numSrcNeurons * (size_t)group->rowStride) + 32 - 1) / 32);" << std::endl;
-                    os << "memset(group->gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
-                }
-                else {
-                    throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
-                }
+                // Zero connectivity
+                genInitConnectivityZero(os, s);
 
-                // If there is row-building code in this snippet
-                Substitutions popSubs(&funcSubs);
+                // If connectivity is compact, count synapses in each row and lay out rows before building connectivity
+                // **NOTE** row and column RNG streams are recreated for each pass so the same synapses are generated
                 const auto *snippet = s.getArchetype().getConnectivityInitialiser().getSnippet();
-                if(!snippet->getRowBuildCode().empty()) {
-                    // Generate loop through source neurons
-                    os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
-
-                    // Configure substitutions
-                    popSubs.addVarSubstitution("id_pre", "i");
-                    popSubs.addVarSubstitution("id_post_begin", "0");
-                    popSubs.addVarSubstitution("id_thread", "0");
-                    popSubs.addVarSubstitution("num_threads", "1");
-                    popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
-                    popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
-                }
-                // Otherwise
-                else {
-                    assert(!snippet->getColBuildCode().empty());
-
-                    // Loop through target neurons
-                    os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
-
-                    // Configure substitutions
-                    popSubs.addVarSubstitution("id_post", "j");
-                    popSubs.addVarSubstitution("id_pre_begin", "0");
-                    popSubs.addVarSubstitution("id_thread", "0");
-                    popSubs.addVarSubstitution("num_threads", "1");
-                    popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
-                    popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+                const std::string end = snippet->getRowBuildCode().empty() ? "group->numTrgNeurons" : "group->numSrcNeurons";
+                if(isCompactSparse(s.getArchetype())) {
+                    genInitConnectivityLoop(os, s, funcSubs, "0", end,
+                                            sgSparseRowConnectHandler, sgSparseColConnectHandler, sgKernelInitHandler, true);
+                    genInitCompactSparseRowPtr(os, s);
                 }
-                {
-                    CodeStream::Scope b(os);
-
-                    // Create new stream to generate addSynapse function which initializes all kernel variables
-                    std::ostringstream kernelInitStream;
-                    CodeStream kernelInit(kernelInitStream);
-
-                    // Use classic macro trick to turn block of initialization code into statement and 'eat' semicolon
-                    kernelInit << "do";
-                    {
-                        CodeStream::Scope b(kernelInit);
-
-                        // Calculate index in data structure of this synapse
-                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            if(!snippet->getRowBuildCode().empty()) {
-                                kernelInit << "const unsigned int idx = " << "(" + popSubs["id_pre"] + " * group->rowStride) + group->rowLength[i];" << std::endl;
-                            }
-                            else {
-                                kernelInit << "const unsigned int idx = " << "(($(0)) * group->rowStride) + group->rowLength[$(0)];" << std::endl;
-                            }
-                        }
-
-                        // If there is a kernel
-                        if(!s.getArchetype().getKernelSize().empty()) {
-                            Substitutions kernelInitSubs(&popSubs);
-
-                            // Replace $(id_post) with first 'function' parameter as simulation code is
-                            // going to be, in turn, substituted into procedural connectivity generation code
-                            if(!snippet->getRowBuildCode().empty()) {
-                                kernelInitSubs.addVarSubstitution("id_post", "$(0)");
-                            }
-                            else {
-                                kernelInitSubs.addVarSubstitution("id_pre", "$(0)");
-                            }
-
-                            // Add index of synapse
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInitSubs.addVarSubstitution("id_syn", "idx");
-                            }
-
-                            // Replace kernel indices with the subsequent 'function' parameters
-                            for(size_t i = 0; i < s.getArchetype().getKernelSize().size(); i++) {
-                                kernelInitSubs.addVarSubstitution("id_kernel_" + std::to_string(i), "$(" + std::to_string(i + 1) + ")");
-                            }
-
-                            // Call handler to initialize variables
-                            sgKernelInitHandler(kernelInit, s, kernelInitSubs);
-                        }
-
-                        // If there is row-building code in this snippet
-                        if(!snippet->getRowBuildCode().empty()) {
-                            // If matrix is sparse, add function to increment row length and insert synapse into ind array
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInit << "group->ind[idx] = $(0);" << std::endl;
-                                kernelInit << "group->rowLength[i]++;" << std::endl;
-                            }
-                            // Otherwise, add function to set correct bit in bitmask
-                            else {
-                                kernelInit << "const int64_t rowStartGID = i * group->rowStride;" << std::endl;
-                                kernelInit << "setB(group->gp[(rowStartGID + ($(0))) / 32], (rowStartGID + $(0)) & 31);" << std::endl;
-                            }
-                        }
-                        // Otherwise
-                        else {
-                            // If matrix is sparse, add function to increment row length and insert synapse into ind array
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInit << "group->ind[idx] = " << popSubs["id_post"] << ";" << std::endl;
-                                kernelInit << "group->rowLength[$(0)]++;" << std::endl;
-                            }
-                            else {
-                                kernelInit << "const int64_t colStartGID = j;" << std::endl;
-                                kernelInit << "setB(group->gp[(colStartGID + (($(0)) * group->rowStride)) / 32], ((colStartGID + (($(0)) * group->rowStride)) & 31));" << std::endl;
-                            }
-                        }
-                    }
-                    kernelInit << "while(false)";
 
-                    popSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)s.getArchetype().getKernelSize().size(),
-                                                kernelInitStream.str());
-
-                    // Call appropriate connectivity handler
-                    if(!snippet->getRowBuildCode().empty()) {
-                        sgSparseRowConnectHandler(os, s, popSubs);
-                    }
-                    else {
-                        sgSparseColConnectHandler(os, s, popSubs);
-                    }
-                }
+                // Build connectivity
+                genInitConnectivityLoop(os, s, funcSubs, "0", end,
+                                        sgSparseRowConnectHandler, sgSparseColConnectHandler, sgKernelInitHandler, false);
+                genGroupTimerStop(os, "0");
             }
         }
+        os << CodeStream::CB(1);
     }
     os << std::endl;
     os << "void initializeSparse()";
@@ -714,13 +592,13 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
 
         Timer t(os, "initSparse", model.isTimingEnabled());
 
-        // If model requires RNG, add it to substitutions
-        if(isGlobalHostRNGRequired(modelMerged)) {
-            funcSubs.addVarSubstitution("rng", "hostRNG");
-        }
+        // Initialisation code uses PhiloxRNG streams created by genSynapseVariableRowInit
+        funcSubs.addVarSubstitution("rng", "rng");
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with sparse connectivity" << std::endl;
+        os << "// **NOTE** skipped if connectivity has been loaded from cache by loadConnectivityCache" << std::endl;
+        os << "if(!connectivityCacheLoaded)" << CodeStream::OB(2);
         for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
             CodeStream::Scope b(os);
             os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
@@ -730,6 +608,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
 
                 // Get reference to group
                 os << "const auto *group = &mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                genGroupTimerStart(os);
 
                 // If postsynaptic learning is required, initially zero column lengths
                 if (!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
@@ -743,12 +622,13 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
                     CodeStream::Scope b(os);
 
                     // Generate sparse initialisation code
-                    if(s.getArchetype().isWUVarInitRequired()) {
-                        Substitutions popSubs(&funcSubs);
-                        popSubs.addVarSubstitution("id_pre", "i");
-                        popSubs.addVarSubstitution("row_len", "group->rowLength[i]");
-                        sgSparseInitHandler(os, s, popSubs);
-                    }
+                    genInitSparseRowVars(os, s, funcSubs, sgSparseInitHandler);
+
+                    // Find where each postsynaptic tile starts within row
+                    genInitSparseRowTiles(os, s);
+
+                    // Encode row's indices as deltas
+                    genInitSparseRowDeltas(os, s);
 
                     // If postsynaptic learning is required
                     if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
@@ -760,7 +640,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
                             // If postsynaptic learning is required, calculate column length and remapping
                             if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
                                 os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
-                                os << "const unsigned int rowMajorIndex = (i * group->rowStride) + j;" << std::endl;
+                                os << "const " << getSparseAddressType(s.getArchetype()) << " rowMajorIndex = " << getSparseRowStart(s.getArchetype(), "i") << " + j;" << std::endl;
                                 os << "// Using this, lookup postsynaptic target" << std::endl;
                                 os << "const unsigned int postIndex = group->ind[rowMajorIndex];" << std::endl;
                                 os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
@@ -769,12 +649,21 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, Memory
                                 os << "group->colLength[postIndex]++;" << std::endl;
                                 os << "// Add remapping entry" << std::endl;
                                 os << "group->remap[colMajorIndex] = rowMajorIndex;" << std::endl;
+                                if(isRemapPreInd(s.getArchetype())) {
+                                    os << "// Store presynaptic index alongside remapping entry" << std::endl;
+                                    os << "group->remapPreInd[colMajorIndex] = i;" << std::endl;
+                                }
                             }
                         }
                     }
                 }
+                genGroupTimerStop(os, "0");
             }
         }
+        os << CodeStream::CB(2);
+
+        // Reset flag so subsequent calls to initialize() regenerate connectivity
+        os << "connectivityCacheLoaded = false;" << std::endl;
     }
 }
 //--------------------------------------------------------------------------
@@ -816,7 +705,7 @@ void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &mode
     }
 }
 //--------------------------------------------------------------------------
-void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &) const
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
 
@@ -844,11 +733,59 @@ void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerg
             os << "return 32;" << std::endl;
         }
     }
-    // Otherwise, on *nix, use __builtin_clz intrinsic
+    os << std::endl;
+    os << "int inline gennCTZ(unsigned int value)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned long trailingZero = 0;" << std::endl;
+        os << "if( _BitScanForward(&trailingZero, value))";
+        {
+            CodeStream::Scope b(os);
+            os << "return trailingZero;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return 32;" << std::endl;
+        }
+    }
+    os << std::endl;
+    os << "int inline gennCLZ64(unsigned long long value)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned long leadingZero = 0;" << std::endl;
+        os << "if( _BitScanReverse64(&leadingZero, value))";
+        {
+            CodeStream::Scope b(os);
+            os << "return 63 - leadingZero;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return 64;" << std::endl;
+        }
+    }
+    // Otherwise, on *nix, use __builtin_clz and __builtin_ctz intrinsics
 #else
     os << "#define gennCLZ __builtin_clz" << std::endl;
+    os << "#define gennCTZ __builtin_ctz" << std::endl;
+    os << "#define gennCLZ64 __builtin_clzll" << std::endl;
 #endif
     os << std::endl;
+
+    // If generated code is compiled with AVX-512 enabled, include intrinsics used to expand bitmask connectivity
+    os << "#ifdef __AVX512F__" << std::endl;
+    os << "#include <immintrin.h>" << std::endl;
+    os << "#endif" << std::endl;
+    os << std::endl;
+
+    // If model requires Philox RNG streams, include RNG and declare seed
+    if(isPhiloxRNGRequired(modelMerged)) {
+        os << "// Counter-based RNG used for simulation and initialisation" << std::endl;
+        os << "#include \"single_threaded_cpu/philoxRNG.h\"" << std::endl;
+        os << "extern uint64_t philoxSeed;" << std::endl;
+        os << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
@@ -862,9 +799,30 @@ void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerg
         os << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution(" << model.scalarExpr(1.0) << ");" << std::endl;
         os << std::endl;
     }
+
+    // If model requires Philox RNG streams, implement seed - using system randomness if no seed is specified
+    if(isPhiloxRNGRequired(modelMerged)) {
+        if(model.getSeed() == 0) {
+            os << "uint64_t philoxSeed = PhiloxRNG::generateSeed();" << std::endl;
+        }
+        else {
+            os << "uint64_t philoxSeed = " << model.getSeed() << "ull;" << std::endl;
+        }
+    }
     os << std::endl;
 }
 //--------------------------------------------------------------------------
+std::vector<std::pair<std::string, std::string>> Backend::getCheckpointHostScalars(const ModelSpecMerged &modelMerged) const
+{
+    // Philox RNG streams are fully determined by the seed and the timestep so this is all that needs saving
+    if(isPhiloxRNGRequired(modelMerged)) {
+        return {{"uint64_t", "philoxSeed"}};
+    }
+    else {
+        return {};
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genAllocateMemPreamble(CodeStream&, const ModelSpecMerged&) const
 {
 }
@@ -957,39 +915,17 @@ void Backend::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs
 void Backend::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
                               const Substitutions &kernelSubs, Handler handler) const
 {
-     // **TODO** loops like this should be generated like CUDA threads
-    os << "for (unsigned i = 0; i < (" << count << "); i++)";
-    {
-        CodeStream::Scope b(os);
-
-        Substitutions varSubs(&kernelSubs);
-        varSubs.addVarSubstitution(indexVarName, "i");
-        handler(os, varSubs);
-    }
+    genVariableInitLoop(os, "0", count, indexVarName, kernelSubs, handler);
 }
 //--------------------------------------------------------------------------
 void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMergedBase &sg, 
                                         const Substitutions &kernelSubs, Handler handler) const
 {
     if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-        os << "for (unsigned j = 0; j < group->rowLength[" << kernelSubs["id_pre"] << "]; j++)";
+        genSynapseVariableRowInitLoop(os, sg, "0", "group->rowLength[" + kernelSubs["id_pre"] + "]", kernelSubs, handler);
     }
     else {
-        os << "for (unsigned j = 0; j < group->numTrgNeurons; j++)";
-    }
-    {
-        CodeStream::Scope b(os);
-
-        Substitutions varSubs(&kernelSubs);
-        if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
-            varSubs.addVarSubstitution("id_post", "group->ind[(" + kernelSubs["id_pre"] + " * group->rowStride) + j]");
-        }
-        else {
-            varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
-            varSubs.addVarSubstitution("id_post", "j");
-        }
-        handler(os, varSubs);
+        genSynapseVariableRowInitLoop(os, sg, "0", "group->numTrgNeurons", kernelSubs, handler);
     }
 }
 //--------------------------------------------------------------------------
@@ -1132,7 +1068,44 @@ void Backend::genMSBuildImportTarget(std::ostream&) const
 {
 }
 //--------------------------------------------------------------------------
+std::vector<filesystem::path> Backend::getFilesToCopy(const ModelSpecMerged &modelMerged) const
+{
+    if(isPhiloxRNGRequired(modelMerged)) {
+        return {filesystem::path("single_threaded_cpu") / "philoxRNG.h"};
+    }
+    else {
+        return {};
+    }
+}
+//--------------------------------------------------------------------------
 bool Backend::isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const
+{
+    // **NOTE** simulation and initialisation code uses Philox RNG streams so the 
+    // host RNG is only required if any host connectivity initialisation code uses it
+    const ModelSpecInternal &model = modelMerged.getModel();
+    return std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                       [](const ModelSpec::SynapseGroupValueType &s)
+                       {
+                           return s.second.isHostInitRNGRequired();
+                       });
+}
+//--------------------------------------------------------------------------
+bool Backend::isGlobalDeviceRNGRequired(const ModelSpecMerged &) const
+{
+    return false;
+}
+//--------------------------------------------------------------------------
+Backend::MemorySpaces Backend::getMergedGroupMemorySpaces(const ModelSpecMerged &) const
+{
+    return {{"", std::numeric_limits<size_t>::max()}};
+}
+//--------------------------------------------------------------------------
+const std::vector<Substitutions::FunctionTemplate> &Backend::getFunctionTemplates(const std::string &precision)
+{
+    return (precision == "double") ? cpuDoublePrecisionFunctions : cpuSinglePrecisionFunctions;
+}
+//--------------------------------------------------------------------------
+bool Backend::isPhiloxRNGRequired(const ModelSpecMerged &modelMerged) const
 {
     // If any neuron groups require simulation RNGs or require RNG for initialisation, return true
     // **NOTE** this takes postsynaptic model initialisation into account
@@ -1146,161 +1119,1026 @@ bool Backend::isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const
         return true;
     }
 
-    // If any synapse groups require an RNG for weight update model initialisation, return true
-    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
-                   [](const ModelSpec::SynapseGroupValueType &s)
-                   {
-                       return (s.second.isWUInitRNGRequired() || s.second.isHostInitRNGRequired());
-                   }))
-    {
-        return true;
-    }
-
-    return false;
-}
-//--------------------------------------------------------------------------
-bool Backend::isGlobalDeviceRNGRequired(const ModelSpecMerged &) const
-{
-    return false;
+    // Return true if any synapse groups require an RNG for weight update model initialisation or for initialising or regenerating connectivity
+    return std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                       [](const ModelSpec::SynapseGroupValueType &s)
+                       {
+                           return s.second.isWUInitRNGRequired() || s.second.isProceduralConnectivityRNGRequired();
+                       });
 }
 //--------------------------------------------------------------------------
-Backend::MemorySpaces Backend::getMergedGroupMemorySpaces(const ModelSpecMerged &) const
+void Backend::genNeuronSimRNG(CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &popSubs) const
 {
-    return {{"", std::numeric_limits<size_t>::max()}};
+    if(ng.getArchetype().isSimRNGRequired()) {
+        // **NOTE** stream is identified by neuron and timestep so it doesn't matter which thread updates which neuron
+        // **NOTE** the 64-bit timestep is used as the RNG's id so long simulations don't repeat streams
+        os << "PhiloxRNG rng(philoxSeed, " << getPhiloxStream(PhiloxStream::NeuronUpdate, ng.getIndex()) << ", g, iT, " << popSubs["id"] << ");" << std::endl;
+        popSubs.addVarSubstitution("rng", "rng");
+    }
 }
 //--------------------------------------------------------------------------
-void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
-                                   bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler) const
+void Backend::genNeuronUpdateLoop(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &funcSubs,
+                                  const std::string &begin, const std::string &end,
+                                  NeuronGroupSimHandler simHandler, NeuronUpdateGroupMergedHandler wuVarUpdateHandler) const
 {
-    // Get suffix based on type of events
-    const std::string eventSuffix = trueSpike ? "" : "Evnt";
-    const auto *wu = sg.getArchetype().getWUModel();
+    // If vectorised neuron updates aren't enabled, update neurons and emit spikes in one loop
+    if(!getPreferences<Preferences>().enableVectorisedNeuronUpdate) {
+        os << "for(unsigned int i = " << begin << "; i < " << end << "; i++)";
+        {
+            CodeStream::Scope b(os);
 
-    // Detect spike events or spikes and do the update
-    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-    if (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-        os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[preReadDelaySlot]; i++)";
-    }
-    else {
-        os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[0]; i++)";
+            Substitutions popSubs(&funcSubs);
+            popSubs.addVarSubstitution("id", "i");
+
+            // If this neuron group requires a simulation RNG, create stream for this neuron
+            genNeuronSimRNG(os, ng, popSubs);
+
+            simHandler(os, ng, popSubs,
+                       // Emit true spikes
+                       [this, wuVarUpdateHandler](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                       {
+                           // Insert code to update WU vars
+                           wuVarUpdateHandler(os, ng, subs);
+
+                           // Insert code to emit true spikes
+                           genEmitSpike(os, ng, subs, true, ng.getArchetype().isSpikeRecordingEnabled());
+                       },
+                       // Emit spike-like events
+                       [this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                       {
+                           // Insert code to emit spike-like events
+                           genEmitSpike(os, ng, subs, false, ng.getArchetype().isSpikeEventRecordingEnabled());
+                       });
+        }
+        return;
     }
+
+    // Otherwise, update neurons in blocks of 32
+    // **NOTE** begin is always word-aligned
+    const bool spikeEventRequired = ng.getArchetype().isSpikeEventRequired();
+    os << "for(unsigned int wordStart = " << begin << "; wordStart < " << end << "; wordStart += 32)";
     {
         CodeStream::Scope b(os);
-        if (!wu->getSimSupportCode().empty()) {
-            os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
-        }
+        os << "const unsigned int wordEnd = std::min(wordStart + 32, " << end << ");" << std::endl;
 
-        const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
-        os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
-
-        // If this is a spike-like event, insert threshold check for this presynaptic neuron
-        if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-            os << "if(";
+        // First pass updates neuron state, only recording whether each neuron spiked in an array of flags - with no
+        // stores into the spike queue inside the loop, the compiler is free to vectorise threshold and reset code
+        os << "uint8_t spikeFlags[32];" << std::endl;
+        if(spikeEventRequired) {
+            os << "uint8_t spikeEventFlags[32];" << std::endl;
+        }
+        os << "for(unsigned int i = wordStart; i < wordEnd; i++)";
+        {
+            CodeStream::Scope b(os);
 
-            Substitutions threshSubs(&popSubs);
-            threshSubs.addVarSubstitution("id_pre", "ipre");
+            Substitutions popSubs(&funcSubs);
+            popSubs.addVarSubstitution("id", "i");
 
-            // Generate weight update threshold condition
-            wumThreshHandler(os, sg, threshSubs);
+            // If this neuron group requires a simulation RNG, create stream for this neuron
+            genNeuronSimRNG(os, ng, popSubs);
 
-            os << ")";
-            os << CodeStream::OB(10);
+            os << "bool spike = false;" << std::endl;
+            if(spikeEventRequired) {
+                os << "bool spikeEvent = false;" << std::endl;
+            }
+            simHandler(os, ng, popSubs,
+                       // Emit true spikes
+                       [wuVarUpdateHandler](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                       {
+                           // Insert code to update WU vars
+                           wuVarUpdateHandler(os, ng, subs);
+
+                           // Set flag
+                           os << "spike = true;" << std::endl;
+                       },
+                       // Emit spike-like events
+                       [](CodeStream &os, const NeuronUpdateGroupMerged&, Substitutions&)
+                       {
+                           os << "spikeEvent = true;" << std::endl;
+                       });
+
+            // Store flags
+            os << "spikeFlags[i - wordStart] = spike;" << std::endl;
+            if(spikeEventRequired) {
+                os << "spikeEventFlags[i - wordStart] = spikeEvent;" << std::endl;
+            }
         }
 
-        Substitutions synSubs(&popSubs);
-        synSubs.addVarSubstitution("id_pre", "ipre");
-        synSubs.addVarSubstitution("id_post", "ipost");
-        synSubs.addVarSubstitution("id_syn", "synAddress");
-
-        if(sg.getArchetype().isDendriticDelayRequired()) {
-            synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)");
+        // Pack flags into bitmask words
+        // **NOTE** this is done in a separate loop as packing requires variable shifts which not all SIMD instruction sets support
+        os << "uint32_t spikeWord = 0;" << std::endl;
+        if(spikeEventRequired) {
+            os << "uint32_t spikeEventWord = 0;" << std::endl;
         }
-        else {
-            synSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[ipost] += $(0)");
+        os << "for(unsigned int j = 0; j < (wordEnd - wordStart); j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "spikeWord |= ((uint32_t)spikeFlags[j] << j);" << std::endl;
+            if(spikeEventRequired) {
+                os << "spikeEventWord |= ((uint32_t)spikeEventFlags[j] << j);" << std::endl;
+            }
         }
 
-        if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
-            os << "for (unsigned int j = 0; j < npost; j++)";
+        // Finally, scan words for set bits and emit spikes in ascending order
+        for(bool trueSpike : {true, false}) {
+            if(!trueSpike && !spikeEventRequired) {
+                continue;
+            }
+
+            const std::string word = trueSpike ? "spikeWord" : "spikeEventWord";
+
+            // If recording is enabled, word can be copied directly into recording buffer
+            if(trueSpike ? ng.getArchetype().isSpikeRecordingEnabled() : ng.getArchetype().isSpikeEventRecordingEnabled()) {
+                const std::string recordSuffix = trueSpike ? "" : "Event";
+                os << "group->recordSpk" << recordSuffix << "[(recordingTimestep * numRecordingWords) + (wordStart / 32)] = " << word << ";" << std::endl;
+            }
+
+            os << "while(" << word << " != 0)";
             {
                 CodeStream::Scope b(os);
+                os << "const unsigned int i = wordStart + gennCTZ(" << word << ");" << std::endl;
 
-                // **TODO** seperate stride from max connection
-                os << "const unsigned int synAddress = (ipre * group->rowStride) + j;" << std::endl;
-                os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
+                Substitutions spikeSubs(&funcSubs);
+                spikeSubs.addVarSubstitution("id", "i");
+                genEmitSpike(os, ng, spikeSubs, trueSpike, false);
+
+                // Clear lowest set bit
+                os << word << " &= (" << word << " - 1);" << std::endl;
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitNeuronGroups(CodeStream &os, const ModelSpecMerged &modelMerged, const Substitutions &funcSubs, 
+                                  NeuronInitGroupMergedHandler localNGHandler) const
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Local neuron groups" << std::endl;
+    for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
+        CodeStream::Scope b(os);
+        os << "// merged neuron init group " << n.getIndex() << std::endl;
+        os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+        {
+            CodeStream::Scope b(os);
+
+            // Get reference to group
+            os << "const auto *group = &mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
+            Substitutions popSubs(&funcSubs);
+            popSubs.addVarSubstitution("rng_stream", getPhiloxStream(PhiloxStream::NeuronInit, n.getIndex()));
+            genGroupTimerStart(os);
+            localNGHandler(os, n, popSubs);
+            genGroupTimerStop(os, getGroupTimingSlot());
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitSynapseDenseGroups(CodeStream &os, const ModelSpecMerged &modelMerged, const Substitutions &funcSubs, 
+                                        SynapseDenseInitGroupMergedHandler sgDenseInitHandler) const
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Synapse groups with dense connectivity" << std::endl;
+    for(const auto &s : modelMerged.getMergedSynapseDenseInitGroups()) {
+        CodeStream::Scope b(os);
+        os << "// merged synapse dense init group " << s.getIndex() << std::endl;
+        os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+        {
+            CodeStream::Scope b(os);
+
+            // Get reference to group
+            os << "const auto *group = &mergedSynapseDenseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+            Substitutions popSubs(&funcSubs);
+            popSubs.addVarSubstitution("rng_stream", getPhiloxStream(PhiloxStream::SynapseDenseInit, s.getIndex()));
+            genGroupTimerStart(os);
+            sgDenseInitHandler(os, s, popSubs);
+            genGroupTimerStop(os, getGroupTimingSlot());
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitConnectivityZero(CodeStream &os, const SynapseConnectivityInitGroupMerged &s) const
+{
+    // If matrix connectivity is ragged
+    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        // Zero row lengths
+        os << "memset(group->rowLength, 0, group->numSrcNeurons * sizeof(unsigned int));" << std::endl;
+    }
+    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+        os << "const size_t gpSize = ((((size_t)group->numSrcNeurons * (size_t)group->rowStride) + 32 - 1) / 32);" << std::endl;
+        os << "memset(group->gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
+    }
+    else {
+        throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitConnectivityLoop(CodeStream &os, const SynapseConnectivityInitGroupMerged &s, const Substitutions &funcSubs,
+                                      const std::string &begin, const std::string &end,
+                                      SynapseConnectivityInitMergedGroupHandler sgSparseRowConnectHandler, SynapseConnectivityInitMergedGroupHandler sgSparseColConnectHandler,
+                                      SynapseConnectivityInitMergedGroupHandler sgKernelInitHandler, bool countOnly) const
+{
+    // If there is row-building code in this snippet
+    Substitutions popSubs(&funcSubs);
+    const auto *snippet = s.getArchetype().getConnectivityInitialiser().getSnippet();
+    if(!snippet->getRowBuildCode().empty()) {
+        // Generate loop through source neurons
+        os << "for (unsigned int i = " << begin << "; i < " << end << "; i++)";
+
+        // Configure substitutions
+        popSubs.addVarSubstitution("id_pre", "i");
+        popSubs.addVarSubstitution("id_post_begin", "0");
+        popSubs.addVarSubstitution("id_thread", "0");
+        popSubs.addVarSubstitution("num_threads", "1");
+        popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+        popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+    }
+    // Otherwise
+    else {
+        assert(!snippet->getColBuildCode().empty());
+
+        // Loop through target neurons
+        os << "for (unsigned int j = " << begin << "; j < " << end << "; j++)";
+
+        // Configure substitutions
+        popSubs.addVarSubstitution("id_post", "j");
+        popSubs.addVarSubstitution("id_pre_begin", "0");
+        popSubs.addVarSubstitution("id_thread", "0");
+        popSubs.addVarSubstitution("num_threads", "1");
+        popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+        popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+    }
+    {
+        CodeStream::Scope b(os);
+
+        // If connectivity or kernel initialisation requires an RNG, create stream for this row or column
+        if(s.getArchetype().isWUInitRNGRequired()) {
+            os << "PhiloxRNG rng(philoxSeed, " << getPhiloxStream(PhiloxStream::SynapseConnectivityInit, s.getIndex()) << ", g, ";
+            os << (snippet->getRowBuildCode().empty() ? "j" : "i") << ", 0);" << std::endl;
+        }
+
+        // Create new stream to generate addSynapse function which initializes all kernel variables
+        std::ostringstream kernelInitStream;
+        CodeStream kernelInit(kernelInitStream);
+
+        // Use classic macro trick to turn block of initialization code into statement and 'eat' semicolon
+        kernelInit << "do";
+        {
+            CodeStream::Scope b(kernelInit);
+
+            // Unless synapses are only being counted, calculate index in data structure of this synapse
+            if(!countOnly && (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+                const std::string addressType = getSparseAddressType(s.getArchetype());
+                if(!snippet->getRowBuildCode().empty()) {
+                    kernelInit << "const " << addressType << " idx = " << getSparseRowStart(s.getArchetype(), popSubs["id_pre"]) << " + group->rowLength[i];" << std::endl;
+                }
+                else {
+                    kernelInit << "const " << addressType << " idx = " << getSparseRowStart(s.getArchetype(), "($(0))") << " + group->rowLength[$(0)];" << std::endl;
+                }
+            }
+
+            // If there is a kernel
+            if(!countOnly && !s.getArchetype().getKernelSize().empty()) {
+                Substitutions kernelInitSubs(&popSubs);
+
+                // Replace $(id_post) with first 'function' parameter as simulation code is
+                // going to be, in turn, substituted into procedural connectivity generation code
+                if(!snippet->getRowBuildCode().empty()) {
+                    kernelInitSubs.addVarSubstitution("id_post", "$(0)");
+                }
+                else {
+                    kernelInitSubs.addVarSubstitution("id_pre", "$(0)");
+                }
+
+                // Add index of synapse
+                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                    kernelInitSubs.addVarSubstitution("id_syn", "idx");
+                }
+
+                // Replace kernel indices with the subsequent 'function' parameters
+                for(size_t i = 0; i < s.getArchetype().getKernelSize().size(); i++) {
+                    kernelInitSubs.addVarSubstitution("id_kernel_" + std::to_string(i), "$(" + std::to_string(i + 1) + ")");
+                }
+
+                // Call handler to initialize variables
+                sgKernelInitHandler(kernelInit, s, kernelInitSubs);
+            }
+
+            // If synapses are only being counted, add function to increment row length
+            if(countOnly) {
+                assert(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+                kernelInit << "group->rowLength[" << (snippet->getRowBuildCode().empty() ? "$(0)" : "i") << "]++;" << std::endl;
+            }
+            // Otherwise, if there is row-building code in this snippet
+            else if(!snippet->getRowBuildCode().empty()) {
+                // If matrix is sparse, add function to increment row length and insert synapse into ind array
+                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                    kernelInit << "group->ind[idx] = $(0);" << std::endl;
+                    kernelInit << "group->rowLength[i]++;" << std::endl;
+                }
+                // Otherwise, add function to set correct bit in bitmask
+                else {
+                    kernelInit << "const int64_t rowStartGID = i * group->rowStride;" << std::endl;
+                    kernelInit << "setB(group->gp[(rowStartGID + ($(0))) / 32], (rowStartGID + $(0)) & 31);" << std::endl;
+                }
+            }
+            // Otherwise
+            else {
+                // If matrix is sparse, add function to increment row length and insert synapse into ind array
+                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                    kernelInit << "group->ind[idx] = " << popSubs["id_post"] << ";" << std::endl;
+                    kernelInit << "group->rowLength[$(0)]++;" << std::endl;
+                }
+                else {
+                    kernelInit << "const int64_t colStartGID = j;" << std::endl;
+                    kernelInit << "setB(group->gp[(colStartGID + (($(0)) * group->rowStride)) / 32], ((colStartGID + (($(0)) * group->rowStride)) & 31));" << std::endl;
+                }
+            }
+        }
+        kernelInit << "while(false)";
+
+        popSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)s.getArchetype().getKernelSize().size(),
+                                    kernelInitStream.str());
+
+        // Call appropriate connectivity handler
+        if(!snippet->getRowBuildCode().empty()) {
+            sgSparseRowConnectHandler(os, s, popSubs);
+        }
+        else {
+            sgSparseColConnectHandler(os, s, popSubs);
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitCompactSparseRowPtr(CodeStream &os, const SynapseConnectivityInitGroupMerged &s) const
+{
+    os << "// Calculate start of each row from row lengths" << std::endl;
+    os << "size_t rowStart = 0;" << std::endl;
+    os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "group->rowPtr[i] = (" << s.getArchetype().getSparseRowPtrType() << ")rowStart;" << std::endl;
+        os << "rowStart += group->rowLength[i];" << std::endl;
+    }
+    os << "if(rowStart > group->maxTotalConnections)";
+    {
+        CodeStream::Scope b(os);
+        os << "throw std::runtime_error(\"Compact sparse connectivity contains more synapses than its maximum total number of connections\");" << std::endl;
+    }
+    os << "group->rowPtr[group->numSrcNeurons] = (" << s.getArchetype().getSparseRowPtrType() << ")rowStart;" << std::endl;
+
+    // Zero row lengths again so they can be used to fill rows
+    os << "memset(group->rowLength, 0, group->numSrcNeurons * sizeof(unsigned int));" << std::endl;
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSparseRowStart(const SynapseGroupInternal &sg, const std::string &idPre) const
+{
+    return isCompactSparse(sg) ? ("group->rowPtr[" + idPre + "]") : ("(" + idPre + " * group->rowStride)");
+}
+//--------------------------------------------------------------------------
+void Backend::genInitSparseRowVars(CodeStream &os, const SynapseSparseInitGroupMerged &s, const Substitutions &funcSubs,
+                                   SynapseSparseInitGroupMergedHandler sgSparseInitHandler) const
+{
+    if(s.getArchetype().isWUVarInitRequired()) {
+        Substitutions popSubs(&funcSubs);
+        popSubs.addVarSubstitution("rng_stream", getPhiloxStream(PhiloxStream::SynapseSparseInit, s.getIndex()));
+        popSubs.addVarSubstitution("id_pre", "i");
+        popSubs.addVarSubstitution("row_len", "group->rowLength[i]");
+        sgSparseInitHandler(os, s, popSubs);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitSparseRowTiles(CodeStream &os, const SynapseSparseInitGroupMerged &s) const
+{
+    const unsigned int tileSize = s.getArchetype().getPostsynapticTileSize();
+    if(tileSize > 0) {
+        os << "unsigned int *tileRowStart = &group->tileRowStart[i * (((group->numTrgNeurons + " << tileSize - 1 << ") / " << tileSize << ") + 1)];" << std::endl;
+        os << "unsigned int tile = 0;" << std::endl;
+        os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int ipost = group->ind[" << getSparseRowStart(s.getArchetype(), "i") << " + j];" << std::endl;
+
+            // As each tile's synapses are assumed to be contiguous, check row is sorted
+            os << "if(j > 0 && ipost < group->ind[" << getSparseRowStart(s.getArchetype(), "i") << " + j - 1])";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(\"Rows of sparse connectivity processed in postsynaptic tiles must be sorted\");" << std::endl;
+            }
 
-                wumSimHandler(os, sg, synSubs);
+            // Tiles up to and including the one containing ipost start at or before this synapse
+            os << "for(; tile <= (ipost / " << tileSize << "); tile++)";
+            {
+                CodeStream::Scope b(os);
+                os << "tileRowStart[tile] = j;" << std::endl;
             }
         }
-        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
-            throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity.");
+
+        // Any remaining tiles (and the end of the last tile) are at the end of the row
+        os << "for(; tile <= ((group->numTrgNeurons + " << tileSize - 1 << ") / " << tileSize << "); tile++)";
+        {
+            CodeStream::Scope b(os);
+            os << "tileRowStart[tile] = group->rowLength[i];" << std::endl;
         }
-        else if(getPreferences().enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
-            // Determine the number of words in each row
-            os << "const unsigned int rowWords = ((group->numTrgNeurons + 32 - 1) / 32);" << std::endl;
-            os << "for(unsigned int w = 0; w < rowWords; w++)";
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInitSparseRowDeltas(CodeStream &os, const SynapseSparseInitGroupMerged &s) const
+{
+    if(isDeltaSparseInd(s.getArchetype())) {
+        CodeStream::Scope b(os);
+        const std::string escape = getSparseIndDeltaEscape(s.getArchetype());
+        const unsigned int tileSize = s.getArchetype().getPostsynapticTileSize();
+        os << "unsigned int prevIPost = 0;" << std::endl;
+        os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << getSparseAddressType(s.getArchetype()) << " synAddress = " << getSparseRowStart(s.getArchetype(), "i") << " + j;" << std::endl;
+            os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
+
+            // As deltas are unsigned, check row is sorted
+            os << "if(ipost < prevIPost)";
             {
                 CodeStream::Scope b(os);
+                os << "throw std::runtime_error(\"Rows of sparse connectivity with delta-encoded indices must be sorted\");" << std::endl;
+            }
 
-                // Read row word
-                os << "uint32_t connectivityWord = group->gp[(ipre * rowWords) + w];" << std::endl;
+            // If delta is too large to represent or, as tiles are decoded independently, this synapse starts a new tile, escape
+            os << "if((ipost - prevIPost) >= " << escape;
+            if(tileSize > 0) {
+                os << " || (ipost / " << tileSize << ") != (prevIPost / " << tileSize << ")";
+            }
+            os << ")";
+            {
+                CodeStream::Scope b(os);
+                os << "group->indDelta[synAddress] = " << escape << ";" << std::endl;
+            }
+            os << "else";
+            {
+                CodeStream::Scope b(os);
+                os << "group->indDelta[synAddress] = (" << s.getArchetype().getSparseIndDeltaType() << ")(ipost - prevIPost);" << std::endl;
+            }
+            os << "prevIPost = ipost;" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genVariableInitLoop(CodeStream &os, const std::string &begin, const std::string &end, const std::string &indexVarName,
+                                  const Substitutions &kernelSubs, Handler handler) const
+{
+    // Generate initialisation code into temporary stream
+    std::ostringstream initStream;
+    CodeStream init(initStream);
+    Substitutions varSubs(&kernelSubs);
+    varSubs.addVarSubstitution(indexVarName, "i");
+    handler(init, varSubs);
+    const std::string initCode = initStream.str();
 
-                // Set ipost to first synapse in connectivity word
-                os << "unsigned int ipost = w * 32;" << std::endl;
+     // **TODO** loops like this should be generated like CUDA threads
+    os << "for (unsigned i = " << begin << "; i < (" << end << "); i++)";
+    {
+        CodeStream::Scope b(os);
 
-                // While there any bits left
-                os << "while(connectivityWord != 0)";
-                {
-                    CodeStream::Scope b(os);
+        // If initialisation code uses RNG, create stream for this element
+        if(initCode.find("rng") != std::string::npos) {
+            genInitRNG(os, kernelSubs, "i", initCode);
+        }
+        os << initCode;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genSynapseVariableRowInitLoop(CodeStream &os, const SynapseGroupMergedBase &sg, const std::string &begin, const std::string &end,
+                                            const Substitutions &kernelSubs, Handler handler) const
+{
+    // Generate initialisation code into temporary stream
+    std::ostringstream initStream;
+    CodeStream init(initStream);
+    Substitutions varSubs(&kernelSubs);
+    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        varSubs.addVarSubstitution("id_syn", getSparseRowStart(sg.getArchetype(), kernelSubs["id_pre"]) + " + j");
+        varSubs.addVarSubstitution("id_post", "group->ind[" + getSparseRowStart(sg.getArchetype(), kernelSubs["id_pre"]) + " + j]");
+    }
+    else {
+        varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
+        varSubs.addVarSubstitution("id_post", "j");
+    }
+    handler(init, varSubs);
+    const std::string initCode = initStream.str();
+
+    os << "for (unsigned j = " << begin << "; j < " << end << "; j++)";
+    {
+        CodeStream::Scope b(os);
 
-                    // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
-                    os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
+        // If initialisation code uses RNG, create stream for this synapse
+        // **NOTE** streams are per-synapse so rows can be split between threads and, as they are identified
+        // by the synapse's position in the padded matrix, compact connectivity is initialised identically
+        if(initCode.find("rng") != std::string::npos) {
+            genInitRNG(os, kernelSubs, "(((uint64_t)" + kernelSubs["id_pre"] + " * group->rowStride) + j)", initCode);
+        }
+        os << initCode;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genGroupTimerStart(CodeStream &os) const
+{
+    if(isGroupTimingEnabled()) {
+        os << "const auto groupTimerStart = std::chrono::high_resolution_clock::now();" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genGroupTimerStop(CodeStream &os, const std::string &slot) const
+{
+    if(isGroupTimingEnabled()) {
+        os << "group->groupTime[" << slot << "] += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - groupTimerStart).count();" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genNeuronSpikeQueueUpdate(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    // Loop through merged neuron spike queue update groups
+    for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
+        CodeStream::Scope b(os);
+        os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
+        os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+        {
+            CodeStream::Scope b(os);
 
-                    // Shift off zeros and the one just discovered
-                    // **NOTE** << 32 appears to result in undefined behaviour
-                    os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
+            // Get reference to group
+            os << "const auto *group = &mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
 
-                    // Add to ipost
-                    os << "ipost += numLZ;" << std::endl;
+            // If previous spikes times are required
+            if(n.getArchetype().isPrevSpikeTimeRequired() || n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                if(n.getArchetype().isDelayRequired()) {
+                    // Calculate delay slot corresponding to last timestep
+                    os << "const unsigned int lastTimestepDelaySlot = (*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots() << ";" << std::endl;
+                    os << "const unsigned int lastTimestepDelayOffset = lastTimestepDelaySlot * group->numNeurons;" << std::endl;
 
-                    // If we aren't in padding region
-                    // **TODO** don't bother checking if there is no padding
-                    os << "if(ipost < group->numTrgNeurons)";
-                    {
-                        CodeStream::Scope b(os);
-                        wumSimHandler(os, sg, synSubs);
+                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
+                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                        os << "for(unsigned int i = 0; i < group->spkCnt[lastTimestepDelaySlot]; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group->prevST[lastTimestepDelayOffset + group->spk[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
+                        }
                     }
+                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[lastTimestepDelaySlot]; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group->prevSET[lastTimestepDelayOffset + group->spkEvnt[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
+                        }
+                    }
+                }
+                else {
+                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
+                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                        os << "for(unsigned int i = 0; i < group->spkCnt[0]; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group->prevST[group->spk[i]] = t - DT;" << std::endl;
+                        }
+                    }
+                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[0]; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group->prevSET[group->spkEvnt[i]] = t - DT;" << std::endl;
+                        }
+                    }
+                }
+            }
+
+            // Generate spike count reset
+            n.genMergedGroupSpikeCountReset(os);
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
+                                   bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
+                                   PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler) const
+{
+    // Get suffix based on type of events
+    const std::string eventSuffix = trueSpike ? "" : "Evnt";
+    const auto *wu = sg.getArchetype().getWUModel();
 
-                    // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
-                    os << "ipost++;" << std::endl;
+    // If a range of postsynaptic neurons has been specified, only update synapses targetting it
+    const bool postRange = popSubs.hasVarSubstitution("id_post_begin");
+    const std::string postBegin = postRange ? popSubs["id_post_begin"] : "0";
+    const std::string postEnd = postRange ? popSubs["id_post_end"] : "group->numTrgNeurons";
+
+    // If presynaptic events are split between several calls, only process this call's share of them
+    const bool preSplit = popSubs.hasVarSubstitution("id_pre_thread");
+
+    // If a separate array to accumulate input into has been specified, use it rather than inSyn
+    const std::string inSyn = popSubs.hasVarSubstitution("in_syn") ? popSubs["in_syn"] : "group->inSyn";
+
+    // If model is batched, the events of every instance are merged so each row is only read once
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const bool batched = (batchSize > 1);
+
+    // If group timing is enabled, count presynaptic events (unless they are being split between several
+    // calls by postsynaptic range or presynaptic event) and, in a local variable, the synapses they are processed by
+    const bool groupTiming = isGroupTimingEnabled();
+    const std::string spkCnt = "group->srcSpkCnt" + eventSuffix + (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "[preReadDelaySlot]" : "[0]");
+    const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
+    if(groupTiming) {
+        os << CodeStream::OB(1);
+        os << "unsigned long long numSynapticEvents = 0;" << std::endl;
+        if(!postRange && !preSplit) {
+            if(batched) {
+                os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "batchGroup->numPresynapticEvents[" << getGroupTimingSlot() << "] += batchGroup[instance].srcSpkCnt" << eventSuffix;
+                    os << (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "[preReadDelaySlot]" : "[0]") << ";" << std::endl;
                 }
             }
+            else {
+                os << "group->numPresynapticEvents[" << getGroupTimingSlot() << "] += " << spkCnt << ";" << std::endl;
+            }
         }
-        // Otherwise (DENSE or BITMASK)
-        else {
-            os << "for (unsigned int ipost = 0; ipost < group->numTrgNeurons; ipost++)";
+    }
+    if(batched) {
+        os << CodeStream::OB(3);
+        genBatchSpkMerge(os, batchSize, spkCnt, "group->srcSpk" + eventSuffix + "[" + queueOffset + "i]");
+    }
+    const std::string eventCnt = batched ? "numBatchSpk" : spkCnt;
+
+    // If model is batched, apply each synaptic event to every instance in which the presynaptic event occurred
+    auto synapticEventHandler =
+        [groupTiming, batched, wumSimHandler](CodeStream &os, const PresynapticUpdateGroupMerged &sg, Substitutions &subs)
+        {
+            if(batched) {
+                os << "for(unsigned int bi = 0; bi < numBatchInstances; bi++)";
+                os << CodeStream::OB(20);
+                os << "const unsigned int instance = batchInstances[bi];" << std::endl;
+                os << "const auto *group = &batchGroup[instance];" << std::endl;
+            }
+            wumSimHandler(os, sg, subs);
+            if(groupTiming) {
+                os << "numSynapticEvents++;" << std::endl;
+            }
+            if(batched) {
+                os << CodeStream::CB(20);
+            }
+        };
+
+    // If indices are delta-encoded, decode them by accumulating deltas (unless escaped) from the start of each row or tile
+    // **NOTE** this means only the narrow deltas, rather than the full indices, are typically read from memory
+    const bool deltaInd = (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) && isDeltaSparseInd(sg.getArchetype());
+    auto genReadPostIndex =
+        [deltaInd, &sg](CodeStream &os)
+        {
+            if(deltaInd) {
+                const std::string escape = getSparseIndDeltaEscape(sg.getArchetype());
+                os << "const " << sg.getArchetype().getSparseIndDeltaType() << " delta = group->indDelta[synAddress];" << std::endl;
+                os << "ipost = (delta == " << escape << ") ? (unsigned int)group->ind[synAddress] : (ipost + delta);" << std::endl;
+            }
+            else {
+                os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
+            }
+        };
+
+    // If sparse connectivity is split into postsynaptic tiles, loop through tiles
+    // so all presynaptic events are processed targetting one tile at a time
+    // **NOTE** postsynaptic ranges are expected to start on a tile boundary
+    const unsigned int tileSize = (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) ? sg.getArchetype().getPostsynapticTileSize() : 0;
+    if(tileSize > 0) {
+        os << "for(unsigned int tile = (" << postBegin << " + " << tileSize - 1 << ") / " << tileSize << "; tile < ((" << postEnd << " + " << tileSize - 1 << ") / " << tileSize << "); tile++)";
+        os << CodeStream::OB(5);
+    }
+
+    // Generate loop which processes presynaptic events targetting a range of postsynaptic neurons
+    auto genSpikeLoop =
+        [&](CodeStream &os, const std::string &rangeBegin, const std::string &rangeEnd, bool range)
+        {
+            os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+            if(preSplit) {
+                os << CodeStream::OB(2);
+                os << "const unsigned int spikeBegin = (unsigned int)(((uint64_t)" << eventCnt << " * " << popSubs["id_pre_thread"] << ") / " << popSubs["num_pre_threads"] << ");" << std::endl;
+                os << "const unsigned int spikeEnd = (unsigned int)(((uint64_t)" << eventCnt << " * (" << popSubs["id_pre_thread"] << " + 1)) / " << popSubs["num_pre_threads"] << ");" << std::endl;
+                os << "for (unsigned int i = spikeBegin; i < spikeEnd; i++)";
+            }
+            else {
+                os << "for (unsigned int i = 0; i < " << eventCnt << "; i++)";
+            }
             {
                 CodeStream::Scope b(os);
+                if (!wu->getSimSupportCode().empty()) {
+                    os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
+                }
+
+                if(batched) {
+                    os << "const unsigned int ipre = batchSpk[i];" << std::endl;
+                    genBatchSpkInstances(os, batchSize, "i");
+
+                    // If this is a spike-like event, only keep the instances in which this presynaptic neuron passes the threshold check
+                    if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                        os << "unsigned int numThresholdInstances = 0;" << std::endl;
+                        os << "for(unsigned int bi = 0; bi < numBatchInstances; bi++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "const unsigned int instance = batchInstances[bi];" << std::endl;
+                            os << "const auto *group = &batchGroup[instance];" << std::endl;
+                            os << "if(";
+
+                            Substitutions threshSubs(&popSubs);
+                            threshSubs.addVarSubstitution("id_pre", "ipre");
 
-                if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << "const uint64_t gid = (ipre * (uint64_t)group->numTrgNeurons + ipost);" << std::endl;
-                    os << "if (B(group->gp[gid / 32], gid & 31))" << CodeStream::OB(20);
+                            // Generate weight update threshold condition
+                            wumThreshHandler(os, sg, threshSubs);
+
+                            os << ")";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "batchInstances[numThresholdInstances++] = instance;" << std::endl;
+                            }
+                        }
+                        os << "numBatchInstances = numThresholdInstances;" << std::endl;
+                        os << "if(numBatchInstances == 0)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "continue;" << std::endl;
+                        }
+                    }
+                }
+                else {
+                    os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
+                }
+
+                // If this is a spike-like event, insert threshold check for this presynaptic neuron
+                if (!batched && !trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                    os << "if(";
+
+                    Substitutions threshSubs(&popSubs);
+                    threshSubs.addVarSubstitution("id_pre", "ipre");
+
+                    // Generate weight update threshold condition
+                    wumThreshHandler(os, sg, threshSubs);
+
+                    os << ")";
+                    os << CodeStream::OB(10);
+                }
+
+                Substitutions synSubs(&popSubs);
+                synSubs.addVarSubstitution("id_pre", "ipre");
+                synSubs.addVarSubstitution("id_post", "ipost");
+                synSubs.addVarSubstitution("id_syn", "synAddress");
+
+                if(sg.getArchetype().isDendriticDelayRequired()) {
+                    synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)");
+                }
+                else {
+                    synSubs.addFuncSubstitution("addToInSyn", 1, inSyn + "[ipost] += $(0)");
+                }
+
+                // If connectivity is split into postsynaptic tiles, loop through the synapses in this row which target the current tile
+                if(tileSize > 0) {
+                    os << "const unsigned int *tileRowStart = &group->tileRowStart[ipre * (((group->numTrgNeurons + " << tileSize - 1 << ") / " << tileSize << ") + 1)];" << std::endl;
+                    if(deltaInd) {
+                        os << "unsigned int ipost = 0;" << std::endl;
+                    }
+                    os << "for (unsigned int j = tileRowStart[tile]; j < tileRowStart[tile + 1]; j++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "const " << getSparseAddressType(sg.getArchetype()) << " synAddress = " << getSparseRowStart(sg.getArchetype(), "ipre") << " + j;" << std::endl;
+                        genReadPostIndex(os);
+                        synapticEventHandler(os, sg, synSubs);
+                    }
                 }
+                else if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                    os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
+                    if(deltaInd) {
+                        os << "unsigned int ipost = 0;" << std::endl;
+                    }
+                    os << "for (unsigned int j = 0; j < npost; j++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // **TODO** seperate stride from max connection
+                        os << "const " << getSparseAddressType(sg.getArchetype()) << " synAddress = " << getSparseRowStart(sg.getArchetype(), "ipre") << " + j;" << std::endl;
+                        genReadPostIndex(os);
 
-                os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+                        if(range) {
+                            os << "if(ipost >= " << rangeBegin << " && ipost < " << rangeEnd << ")" << CodeStream::OB(30);
+                        }
 
-                wumSimHandler(os, sg, synSubs);
+                        synapticEventHandler(os, sg, synSubs);
 
-                if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << CodeStream::CB(20);
+                        if(range) {
+                            os << CodeStream::CB(30);
+                        }
+                    }
                 }
+                else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
+                    // If row building requires an RNG, create stream for this row
+                    // **NOTE** the same stream is recreated every time this neuron spikes so the row is regenerated identically
+                    const std::string rngStream = getPhiloxStream(PhiloxStream::SynapseProcedural, sg.getIndex());
+                    if(sg.getArchetype().isProceduralConnectivityRNGRequired()) {
+                        os << "PhiloxRNG rng(philoxSeed, " << rngStream << ", g, ipre, 0);" << std::endl;
+                        synSubs.addVarSubstitution("rng", "rng");
+                    }
+
+                    // Create substitution stack for generating procedural connectivity code
+                    // **NOTE** the whole row is always generated so connectivity is independent of postsynaptic range
+                    Substitutions connSubs(&synSubs);
+                    connSubs.addVarSubstitution("id_post_begin", "0");
+                    connSubs.addVarSubstitution("id_thread", "0");
+                    connSubs.addVarSubstitution("num_threads", "1");
+                    connSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+                    connSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+
+                    // Create another substitution stack for generating presynaptic simulation code
+                    // **NOTE** simulation code is going to be, in turn, substituted into procedural connectivity
+                    // generation code so replace $(id_post) and any kernel indices with 'function' parameters
+                    Substitutions presynapticUpdateSubs(&synSubs);
+                    presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+
+                    // If procedural weights require an RNG, use a separate stream for each synapse so the
+                    // row's RNG stream is consumed identically however the postsynaptic neurons are partitioned
+                    const bool weightRNGRequired = ((sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL)
+                                                    && ::Utils::isRNGRequired(sg.getArchetype().getWUVarInitialisers()));
+                    if(weightRNGRequired) {
+                        presynapticUpdateSubs.addVarSubstitution("rng", "synRNG");
+                    }
+                    for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
+                        presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i), "$(" + std::to_string(i + 1) + ")");
+                    }
+
+                    if(sg.getArchetype().isDendriticDelayRequired()) {
+                        presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getDendriticDelayOffset("$(1)") + "$(id_post)] += $(0)");
+                    }
+                    else {
+                        presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, inSyn + "[$(id_post)] += $(0)");
+                    }
+
+                    // Generate presynaptic simulation code into new stringstream-backed code stream
+                    // using classic macro trick to turn block of code into statement and 'eat' semicolon
+                    std::ostringstream presynapticUpdateStream;
+                    CodeStream presynapticUpdate(presynapticUpdateStream);
+                    presynapticUpdate << "do";
+                    {
+                        CodeStream::Scope b(presynapticUpdate);
+                        if(range) {
+                            presynapticUpdate << "if(($(0)) >= " << rangeBegin << " && ($(0)) < " << rangeEnd << ")" << CodeStream::OB(40);
+                        }
+
+                        if(weightRNGRequired) {
+                            presynapticUpdate << "PhiloxRNG synRNG(philoxSeed, " << rngStream << ", g, ipre, 1 + ($(0)));" << std::endl;
+                        }
+
+                        synapticEventHandler(presynapticUpdate, sg, presynapticUpdateSubs);
+
+                        if(range) {
+                            presynapticUpdate << CodeStream::CB(40);
+                        }
+                    }
+                    presynapticUpdate << "while(false)";
+
+                    // When a synapse should be 'added', substitute in presynaptic update code
+                    connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(),
+                                                 presynapticUpdateStream.str());
+
+                    // Generate procedural connectivity code
+                    wumProceduralConnectHandler(os, sg, connSubs);
+                }
+                else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                    // Rows are stored as a stream of bits, most significant first, which are
+                    // only padded to a whole number of words if bitmask optimisations are enabled
+                    const std::string rowStride = getPreferences().enableBitmaskOptimisations ? "(((group->numTrgNeurons + 32 - 1) / 32) * 32)" : "group->numTrgNeurons";
+                    os << "const uint64_t rowStartBit = ipre * (uint64_t)" << rowStride << ";" << std::endl;
+
+                    // Loop through row in 64-bit windows
+                    // **NOTE** windows are assembled from 32-bit words so the layout is shared with other backends and initialisation
+                    os << "for(unsigned int windowStart = " << rangeBegin << "; windowStart < " << rangeEnd << "; windowStart += 64)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Read the (up to three) words which overlap window, without reading beyond the end of the range
+                        os << "const uint64_t windowStartBit = rowStartBit + windowStart;" << std::endl;
+                        os << "const unsigned int numWindowBits = std::min(64u, " << rangeEnd << " - windowStart);" << std::endl;
+                        os << "const unsigned int shift = (unsigned int)(windowStartBit % 32);" << std::endl;
+                        os << "const unsigned int numWindowWords = (shift + numWindowBits + 32 - 1) / 32;" << std::endl;
+                        os << "const uint32_t *windowWords = &group->gp[windowStartBit / 32];" << std::endl;
+                        os << "uint64_t connectivityWord = ((uint64_t)windowWords[0] << 32) | ((numWindowWords > 1) ? windowWords[1] : 0);" << std::endl;
+                        os << "if(shift != 0)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "connectivityWord = (connectivityWord << shift) | ((numWindowWords > 2) ? (windowWords[2] >> (32 - shift)) : 0);" << std::endl;
+                        }
+
+                        // Mask out any bits beyond the end of the range
+                        os << "if(numWindowBits < 64)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "connectivityWord &= ~(~0ull >> numWindowBits);" << std::endl;
+                        }
+
+                        // If AVX-512 is available, expand set bits 16 at a time into a batch of postsynaptic indices and process batch
+                        // **NOTE** bits are expanded in reverse order within each group of 16 but, as
+                        // each postsynaptic neuron appears once per row, this doesn't change results
+                        os << "#ifdef __AVX512F__" << std::endl;
+                        os << "unsigned int batch[64];" << std::endl;
+                        os << "unsigned int batchSize = 0;" << std::endl;
+                        os << "const __m512i lane = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);" << std::endl;
+                        os << "for(int c = 3; c >= 0; c--)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "const __mmask16 chunk = (__mmask16)(connectivityWord >> (16 * c));" << std::endl;
+                            os << "const __m512i chunkPost = _mm512_sub_epi32(_mm512_set1_epi32((int)(windowStart + 63 - (16 * c))), lane);" << std::endl;
+                            os << "_mm512_storeu_si512(&batch[batchSize], _mm512_maskz_compress_epi32(chunk, chunkPost));" << std::endl;
+                            os << "batchSize += _mm_popcnt_u32(chunk);" << std::endl;
+                        }
+                        os << "for(unsigned int b = 0; b < batchSize; b++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "const unsigned int ipost = batch[b];" << std::endl;
+                            os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+                            synapticEventHandler(os, sg, synSubs);
+                        }
+
+                        // Otherwise, process set bits one at a time
+                        os << "#else" << std::endl;
+                        os << "while(connectivityWord != 0)";
+                        {
+                            CodeStream::Scope b(os);
+
+                            // Count leading zeros (as bits are indexed backwards this is index of next synapse) and clear bit
+                            os << "const int numLZ = gennCLZ64(connectivityWord);" << std::endl;
+                            os << "connectivityWord &= ~(0x8000000000000000ull >> numLZ);" << std::endl;
+
+                            os << "const unsigned int ipost = windowStart + numLZ;" << std::endl;
+                            os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+                            synapticEventHandler(os, sg, synSubs);
+                        }
+                        os << "#endif" << std::endl;
+                    }
+                }
+                // Otherwise (DENSE)
+                else {
+                    os << "for (unsigned int ipost = " << rangeBegin << "; ipost < " << rangeEnd << "; ipost++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+
+                        synapticEventHandler(os, sg, synSubs);
+                    }
+                }
+                // If this is a spike-like event, close braces around threshold check
+                if (!batched && !trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                    os << CodeStream::CB(10);
+                }
+            }
+            if(preSplit) {
+                os << CodeStream::CB(2);
+            }
+        };
+
+    // If connectivity is DENSE or BITMASK and there are enough presynaptic events to make it worthwhile,
+    // process them in blocks of postsynaptic neurons so inSyn and any postsynaptic state stays in cache
+    // **NOTE** this preserves the order in which each postsynaptic neuron receives its input so results are identical
+    // **NOTE** code which samples random numbers is not blocked so the order in which they are sampled is unchanged
+    const unsigned int blockThreshold = getPreferences<Preferences>().blockedPresynapticUpdateThreshold;
+    const bool denseOrBitmask = ((sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE)
+                                 || (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK));
+    if(blockThreshold > 0 && denseOrBitmask && !::Utils::isRNGRequired(trueSpike ? wu->getSimCode() : wu->getEventCode()))
+    {
+        os << "if(" << eventCnt << " >= " << blockThreshold << ")";
+        {
+            CodeStream::Scope b(os);
+            os << "for(unsigned int blockBegin = " << postBegin << "; blockBegin < " << postEnd << "; blockBegin += " << presynapticUpdateBlockSize << ")";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int blockEnd = std::min(blockBegin + " << presynapticUpdateBlockSize << "u, " << postEnd << ");" << std::endl;
+                genSpikeLoop(os, "blockBegin", "blockEnd", true);
             }
         }
-        // If this is a spike-like event, close braces around threshold check
-        if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-            os << CodeStream::CB(10);
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            genSpikeLoop(os, postBegin, postEnd, postRange);
         }
     }
+    else {
+        genSpikeLoop(os, postBegin, postEnd, postRange);
+    }
+
+    // If connectivity is split into postsynaptic tiles, close tile loop
+    if(tileSize > 0) {
+        os << CodeStream::CB(5);
+    }
+
+    // If events were merged, close their scope
+    if(batched) {
+        os << CodeStream::CB(3);
+    }
+
+    // Add synaptic events to group's count
+    if(groupTiming) {
+        os << "group->numSynapticEvents[" << getGroupTimingSlot() << "] += numSynapticEvents;" << std::endl;
+        os << CodeStream::CB(1);
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const
@@ -1335,5 +2173,74 @@ void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, co
         os << " |= (1 << (" << subs["id"] << " % 32));" << std::endl;
     }
 }
+//--------------------------------------------------------------------------
+size_t Backend::getBatchSpkScratchSize(const ModelSpecMerged &modelMerged) const
+{
+    // Find largest population whose events are merged by presynaptic or postsynaptic updates
+    size_t scratchSize = 0;
+    if(modelMerged.getModel().getBatchSize() > 1) {
+        for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+            for(const auto &sg : s.getGroups()) {
+                scratchSize = std::max(scratchSize, (size_t)sg.get().getSrcNeuronGroup()->getNumNeurons());
+            }
+        }
+        for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
+            for(const auto &sg : s.getGroups()) {
+                scratchSize = std::max(scratchSize, (size_t)sg.get().getTrgNeuronGroup()->getNumNeurons());
+            }
+        }
+    }
+    return scratchSize;
+}
+//--------------------------------------------------------------------------
+void Backend::genBatchSpkMerge(CodeStream &os, unsigned int batchSize, const std::string &spkCnt, const std::string &spk) const
+{
+    // **NOTE** batchSpkIndex holds one plus the position of each neuron in the merged list, or zero if it's not in it
+    const unsigned int numInstanceWords = (batchSize + 31) / 32;
+    os << "unsigned int numBatchSpk = 0;" << std::endl;
+    os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+    {
+        CodeStream::Scope b(os);
+        os << "const auto *group = &batchGroup[instance];" << std::endl;
+        os << "for(unsigned int i = 0; i < " << spkCnt << "; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int id = " << spk << ";" << std::endl;
+            os << "if(batchSpkIndex[id] == 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "batchSpk[numBatchSpk] = id;" << std::endl;
+                for(unsigned int w = 0; w < numInstanceWords; w++) {
+                    os << "batchSpkInstances[(numBatchSpk * " << numInstanceWords << ") + " << w << "] = 0;" << std::endl;
+                }
+                os << "batchSpkIndex[id] = ++numBatchSpk;" << std::endl;
+            }
+            os << "batchSpkInstances[((batchSpkIndex[id] - 1) * " << numInstanceWords << ") + (instance / 32)] |= (1u << (instance % 32));" << std::endl;
+        }
+    }
+
+    // Reset positions so scratch arrays are ready to merge the next group's events
+    os << "for(unsigned int i = 0; i < numBatchSpk; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "batchSpkIndex[batchSpk[i]] = 0;" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genBatchSpkInstances(CodeStream &os, unsigned int batchSize, const std::string &spkIndex) const
+{
+    const unsigned int numInstanceWords = (batchSize + 31) / 32;
+    os << "unsigned int batchInstances[" << batchSize << "];" << std::endl;
+    os << "unsigned int numBatchInstances = 0;" << std::endl;
+    os << "for(unsigned int instance = 0; instance < " << batchSize << "; instance++)";
+    {
+        CodeStream::Scope b(os);
+        os << "if(batchSpkInstances[(" << spkIndex << " * " << numInstanceWords << ") + (instance / 32)] & (1u << (instance % 32)))";
+        {
+            CodeStream::Scope b(os);
+            os << "batchInstances[numBatchInstances++] = instance;" << std::endl;
+        }
+    }
+}
 }   // namespace SingleThreadedCPU
 }   // namespace CodeGenerator
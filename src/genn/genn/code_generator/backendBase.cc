@@ -3,6 +3,8 @@
 // GeNN includes
 #include "gennUtils.h"
 #include "logging.h"
+#include "neuronGroupInternal.h"
+#include "synapseGroupInternal.h"
 
 // Macro for simplifying defining type sizes
 #define TYPE(T) {#T, sizeof(T)}
@@ -25,6 +27,10 @@ CodeGenerator::BackendBase::BackendBase(const std::string &scalarType, const Pre
 {
     // Add scalar type
     addType("scalar", (scalarType == "float") ? sizeof(float) : sizeof(double));
+
+    // Add reduced precision storage types
+    addType("half", 2);
+    addType("bfloat16", 2);
 }
 //--------------------------------------------------------------------------
 size_t CodeGenerator::BackendBase::getSize(const std::string &type) const
@@ -47,3 +53,25 @@ size_t CodeGenerator::BackendBase::getSize(const std::string &type) const
         }
     }
 }
+//--------------------------------------------------------------------------
+bool CodeGenerator::BackendBase::isCompactSparse(const SynapseGroupInternal &sg) const
+{
+    return (isCompactSparseSupported() && sg.isCompactSparseEnabled());
+}
+//--------------------------------------------------------------------------
+bool CodeGenerator::BackendBase::isDeltaSparseInd(const SynapseGroupInternal &sg) const
+{
+    return (isDeltaSparseIndSupported() && sg.isDeltaSparseIndEnabled());
+}
+//--------------------------------------------------------------------------
+bool CodeGenerator::BackendBase::isRemapPreInd(const SynapseGroupInternal &sg) const
+{
+    return (isPostsynapticRemapRequired() && isRemapPreIndSupported()
+            && sg.isRemapPreIndEnabled() && !sg.getWUModel()->getLearnPostCode().empty());
+}
+//--------------------------------------------------------------------------
+std::string CodeGenerator::BackendBase::getSparseAddressType(const SynapseGroupInternal &sg) const
+{
+    // **NOTE** padded connectivity is addressed using unsigned int throughout
+    return isCompactSparse(sg) ? sg.getSparseRowPtrType() : "unsigned int";
+}
@@ -18,7 +18,12 @@
     #error "GeNN now requires a functioning std::regex implementation - please upgrade your version of GCC to at least 4.9.1"
 #endif
 
+// Standard C++ includes
+#include <unordered_map>
+
 // Standard C includes
+#include <cassert>
+#include <cctype>
 #include <cstring>
 
 // GeNN includes
@@ -102,6 +107,66 @@ const char *mathsFuncs[][MathsFuncMax] = {
     {"fma", "fmaf"}
 };
 
+//--------------------------------------------------------------------------
+bool isIdentifierChar(char c)
+{
+    return (::isalnum(static_cast<unsigned char>(c)) || c == '_');
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Scans code once for identifiers (maximal runs of characters which can be part of a C identifier)
+           and replaces each one for which getReplacementFn returns a non-null replacement
+ */
+//--------------------------------------------------------------------------
+template<typename R>
+bool identifierSubstitute(std::string &s, R getReplacementFn)
+{
+    std::string output;
+    size_t copyStart = 0;
+    bool replaced = false;
+    for(size_t i = 0; i < s.size();) {
+        // If this character can't be part of an identifier, skip it
+        if(!isIdentifierChar(s[i])) {
+            i++;
+            continue;
+        }
+
+        // Find end of identifier
+        size_t end = i + 1;
+        while(end < s.size() && isIdentifierChar(s[end])) {
+            end++;
+        }
+
+        // If identifier should be replaced, copy preceding code and replacement to output
+        const std::string *replacement = getReplacementFn(s, i, end);
+        if(replacement) {
+            output.append(s, copyStart, i - copyStart);
+            output += *replacement;
+            copyStart = end;
+            replaced = true;
+        }
+        i = end;
+    }
+
+    // If any replacements were made, copy remaining code and replace original
+    if(replaced) {
+        output.append(s, copyStart, std::string::npos);
+        s = std::move(output);
+    }
+    return replaced;
+}
+
+//--------------------------------------------------------------------------
+//! Is code at position i followed by optional whitespace and an opening bracket i.e. a function call
+//--------------------------------------------------------------------------
+bool isFunctionCall(const std::string &s, size_t i)
+{
+    while(i < s.size() && ::isspace(static_cast<unsigned char>(s[i]))) {
+        i++;
+    }
+    return (i < s.size() && s[i] == '(');
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function removes explicit single precision function calls as
            single-threaded CPU and CUDA kernels both support C++ i.e. overloads 
@@ -111,11 +176,24 @@ const char *mathsFuncs[][MathsFuncMax] = {
 //--------------------------------------------------------------------------
 void ensureMathFunctionFtype(std::string &code)
 {
-    // Replace any outstanding explicit single-precision maths functions  
-    // with C++ versions where overloads should work the same
-    for(const auto &m : mathsFuncs) {
-        CodeGenerator::regexFuncSubstitute(code, m[MathsFuncSingle], m[MathsFuncCPP]);
-    }
+    // Build map of explicit single-precision maths functions to C++ versions where overloads should work the same
+    static const std::unordered_map<std::string, std::string> singleMathsFuncs = 
+        []()
+        {
+            std::unordered_map<std::string, std::string> funcs;
+            for(const auto &m : mathsFuncs) {
+                funcs.emplace(m[MathsFuncSingle], m[MathsFuncCPP]);
+            }
+            return funcs;
+        }();
+
+    // Replace any outstanding calls to these in a single pass over code
+    identifierSubstitute(code,
+                         [](const std::string &s, size_t begin, size_t end) -> const std::string*
+                         {
+                             const auto m = singleMathsFuncs.find(s.substr(begin, end - begin));
+                             return (m != singleMathsFuncs.cend() && isFunctionCall(s, end)) ? &m->second : nullptr;
+                         });
 }
 
 //--------------------------------------------------------------------------
@@ -144,48 +222,6 @@ void doFinal(std::string &code, unsigned int i, const std::string &type, unsigne
     }
 }
 
-bool regexSubstitute(std::string &s, const std::regex &regex, const std::string &format)
-{
-    // **NOTE** the following code performs the same function as std::regex_replace
-    // but has a return value indicating whether any replacements are made
-    // see http://en.cppreference.com/w/cpp/regex/regex_replace
-
-    // Create regex iterator to iterate over matches found in code
-    std::sregex_iterator matchesBegin(s.cbegin(), s.cend(), regex);
-    std::sregex_iterator matchesEnd;
-
-    // If there are no matches, leave s unmodified and return false
-    if(matchesBegin == matchesEnd) {
-        return false;
-    }
-    // Otherwise
-    else {
-        // Loop through matches
-        std::string output;
-        for(std::sregex_iterator m = matchesBegin;;) {
-            // Copy the non-matched subsequence (m->prefix()) onto output
-            std::copy(m->prefix().first, m->prefix().second, std::back_inserter(output));
-
-            // Then replaces the matched subsequence with the formatted replacement string
-            m->format(std::back_inserter(output), format);
-
-            // If there are no subsequent matches
-            if(std::next(m) == matchesEnd) {
-                // Copy the remaining non-matched characters onto output
-                std::copy(m->suffix().first, m->suffix().second, std::back_inserter(output));
-                break;
-            }
-            // Otherwise go onto next match
-            else {
-                m++;
-            }
-        }
-
-        // Set reference to newly processed version and return true
-        s = output;
-        return true;
-    }
-}
 }    // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -206,37 +242,31 @@ void substitute(std::string &s, const std::string &trg, const std::string &rep)
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable  names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match variable name with at least one
-    // character that can't be in a variable name on either side (or an end/beginning of string)
-    // **NOTE** the suffix is non-capturing so two instances of variables separated by a single character are matched e.g. a*a
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=$|[^a-zA-Z0-9_])");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Replace identifiers which exactly match variable name
+    // **NOTE** because identifiers are matched in their entirety, names which are part of
+    // longer identifiers e.g. foo in foo123 and two instances separated by a single character e.g. a*a are handled correctly
+    return identifierSubstitute(s,
+                                [&trg, &rep](const std::string &code, size_t begin, size_t end) -> const std::string*
+                                {
+                                    return (code.compare(begin, end - begin, trg) == 0) ? &rep : nullptr;
+                                });
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match function name with at least one
-    // character that can't be part of the function name on the left and a bracket on the right (with optional whitespace)
-    // **NOTE** the suffix is non-capturing so two instances of functions separated by a single character are matched e.g. sin(cos(x));
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=\\s*\\()");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Replace identifiers which exactly match function name and are followed by a bracket (with optional whitespace)
+    return identifierSubstitute(s,
+                                [&trg, &rep](const std::string &code, size_t begin, size_t end) -> const std::string*
+                                {
+                                    return (code.compare(begin, end - begin, trg) == 0 && isFunctionCall(code, end)) ? &rep : nullptr;
+                                });
 }
 
 //--------------------------------------------------------------------------
@@ -260,13 +290,6 @@ void functionSubstitute(std::string &code, const std::string &funcName,
     }
     // Otherwise
     else {
-        // Reserve vector to hold parameters
-        std::vector<std::string> params;
-        params.reserve(numParams);
-
-        // String to hold parameter currently being parsed
-        std::string currentParam = "";
-
         // Function will start with opening GeNN wrapper, name and comma before first argument
         // **NOTE** need to match up to comma so longer function names with same prefix aren't matched
         const std::string funcStart = "$(" + funcName + ",";
@@ -275,69 +298,79 @@ void functionSubstitute(std::string &code, const std::string &funcName,
         size_t found = code.find(funcStart);
 
         // While functions are found
+        std::vector<std::string> params;
         while (found != std::string::npos) {
-            // Loop through subsequent characerters of code
-            unsigned int bracketDepth = 0;
-            for(size_t i = found + funcStart.length(); i < code.size(); i++) {
-                // If this character is a comma at function bracket depth
-                if(code[i] == ',' && bracketDepth == 0) {
-                    assert(!currentParam.empty());
+            // Parse parameters
+            params.clear();
+            const size_t end = parseFunctionParameters(code, found + funcStart.length(), params);
+            if(params.size() != numParams) {
+                throw std::runtime_error("Function '" + funcName + "' called with " + std::to_string(params.size())
+                                         + " parameters but it expects " + std::to_string(numParams));
+            }
 
-                    // Add parameter to array
-                    params.push_back(currentParam);
-                    currentParam = "";
+            // Substitute parsed parameters into function template and replace this into code
+            code.replace(found, end - found + 1, expandFunctionTemplate(replaceFuncTemplate, params));
+
+            // Find start of next function to replace
+            found = code.find(funcStart);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+size_t parseFunctionParameters(const std::string &code, size_t begin, std::vector<std::string> &params)
+{
+    // Loop through subsequent characerters of code
+    std::string currentParam = "";
+    unsigned int bracketDepth = 0;
+    for(size_t i = begin; i < code.size(); i++) {
+        // If this character is a comma at function bracket depth
+        if(code[i] == ',' && bracketDepth == 0) {
+            assert(!currentParam.empty());
+
+            // Add parameter to array
+            params.push_back(currentParam);
+            currentParam = "";
+        }
+        // Otherwise
+        else {
+            // If this is an open bracket, increase bracket depth
+            if(code[i] == '(') {
+                bracketDepth++;
+            }
+            // Otherwise, it's a close bracket
+            else if(code[i] == ')') {
+                // If we are at a deeper bracket depth than function, decrease bracket depth
+                if(bracketDepth > 0) {
+                    bracketDepth--;
                 }
-                // Otherwise
+                // Otherwise, add final parameter to array and return position of closing bracket
                 else {
-                    // If this is an open bracket, increase bracket depth
-                    if(code[i] == '(') {
-                        bracketDepth++;
-                    }
-                    // Otherwise, it's a close bracket
-                    else if(code[i] == ')') {
-                        // If we are at a deeper bracket depth than function, decrease bracket depth
-                        if(bracketDepth > 0) {
-                            bracketDepth--;
-                        }
-                        // Otherwise
-                        else {
-                            assert(!currentParam.empty());
-
-                            // Add parameter to array
-                            params.push_back(currentParam);
-                            currentParam = "";
-
-                            // Check parameters match
-                            assert(params.size() == numParams);
-
-                            // Substitute parsed parameters into function template
-                            std::string replaceFunc = replaceFuncTemplate;
-                            for(unsigned int p = 0; p < numParams; p++) {
-                                substitute(replaceFunc, "$(" + std::to_string(p) + ")", params[p]);
-                            }
-
-                            // Clear parameters now they have been substituted
-                            // into the final string to replace in to code
-                            params.clear();
-
-                            // Replace this into code
-                            code.replace(found, i - found + 1, replaceFunc);
-                            break;
-                        }
-                    }
-
-                    // If this isn't a space at function bracket depth,
-                    // add to parameter string
-                    if(bracketDepth > 0 || !::isspace(code[i])) {
-                        currentParam += code[i];
-                    }
+                    assert(!currentParam.empty());
+                    params.push_back(currentParam);
+                    return i;
                 }
             }
 
-            // Find start of next function to replace
-            found = code.find(funcStart);
+            // If this isn't a space at function bracket depth,
+            // add to parameter string
+            if(bracketDepth > 0 || !::isspace(code[i])) {
+                currentParam += code[i];
+            }
         }
     }
+
+    throw std::runtime_error("Unterminated function call in code '" + code + "'");
+}
+
+//--------------------------------------------------------------------------
+std::string expandFunctionTemplate(const std::string &replaceFuncTemplate, const std::vector<std::string> &params)
+{
+    std::string replaceFunc = replaceFuncTemplate;
+    for(size_t p = 0; p < params.size(); p++) {
+        substitute(replaceFunc, "$(" + std::to_string(p) + ")", params[p]);
+    }
+    return replaceFunc;
 }
 
 void genTypeRange(CodeStream &os, const std::string &precision, const std::string &prefix)
@@ -364,6 +397,136 @@ void genTypeRange(CodeStream &os, const std::string &precision, const std::strin
     os << std::endl;
 }
 
+void genReducedPrecisionTypes(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// reduced precision storage types" << std::endl;
+    os << "// **NOTE** types are distinct structs rather than integer typedefs so floating point values can't be assigned to them without conversion" << std::endl;
+    os << "struct half{ uint16_t bits; };" << std::endl;
+    os << "struct bfloat16{ uint16_t bits; };" << std::endl;
+    os << std::endl;
+
+    // IEEE 754 binary16 to float, normalising subnormal values
+    os << "inline float halfToFloat(half value)";
+    {
+        CodeStream::Scope b(os);
+        os << "const uint32_t sign = (uint32_t)(value.bits & 0x8000u) << 16;" << std::endl;
+        os << "const uint32_t exponent = (value.bits >> 10) & 0x1Fu;" << std::endl;
+        os << "uint32_t mantissa = value.bits & 0x3FFu;" << std::endl;
+        os << "uint32_t bits;" << std::endl;
+        os << "if(exponent == 0x1Fu)";
+        {
+            CodeStream::Scope b(os);
+            os << "bits = sign | 0x7F800000u | (mantissa << 13);" << std::endl;
+        }
+        os << "else if(exponent != 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);" << std::endl;
+        }
+        os << "else if(mantissa == 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "bits = sign;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "uint32_t floatExponent = 113u;" << std::endl;
+            os << "while((mantissa & 0x400u) == 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "mantissa <<= 1;" << std::endl;
+                os << "floatExponent--;" << std::endl;
+            }
+            os << "bits = sign | (floatExponent << 23) | ((mantissa & 0x3FFu) << 13);" << std::endl;
+        }
+        os << "float result;" << std::endl;
+        os << "memcpy(&result, &bits, sizeof(float));" << std::endl;
+        os << "return result;" << std::endl;
+    }
+    os << std::endl;
+
+    // Float to IEEE 754 binary16, rounding to nearest even and saturating to infinity
+    os << "inline half floatToHalf(float value)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint32_t bits;" << std::endl;
+        os << "memcpy(&bits, &value, sizeof(float));" << std::endl;
+        os << "const uint32_t sign = (bits >> 16) & 0x8000u;" << std::endl;
+        os << "const uint32_t absBits = bits & 0x7FFFFFFFu;" << std::endl;
+        os << "if(absBits > 0x7F800000u)";
+        {
+            CodeStream::Scope b(os);
+            os << "return half{(uint16_t)(sign | 0x7E00u)};" << std::endl;
+        }
+        os << "else if(absBits >= 0x477FF000u)";
+        {
+            CodeStream::Scope b(os);
+            os << "return half{(uint16_t)(sign | 0x7C00u)};" << std::endl;
+        }
+        os << "else if(absBits < 0x33000001u)";
+        {
+            CodeStream::Scope b(os);
+            os << "return half{(uint16_t)sign};" << std::endl;
+        }
+        os << "else if(absBits < 0x38800000u)";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint32_t shift = 126u - (absBits >> 23);" << std::endl;
+            os << "const uint32_t mantissa = (absBits & 0x7FFFFFu) | 0x800000u;" << std::endl;
+            os << "const uint32_t remainder = mantissa & ((1u << shift) - 1u);" << std::endl;
+            os << "const uint32_t halfway = 1u << (shift - 1u);" << std::endl;
+            os << "const uint32_t subnormal = mantissa >> shift;" << std::endl;
+            os << "return half{(uint16_t)(sign | (subnormal + (((remainder > halfway) || ((remainder == halfway) && (subnormal & 1u))) ? 1u : 0u)))};" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return half{(uint16_t)(sign | ((absBits + 0xFFFu + ((absBits >> 13) & 1u) - 0x38000000u) >> 13))};" << std::endl;
+        }
+    }
+    os << std::endl;
+
+    // bfloat16 is simply the top 16 bits of a float
+    os << "inline float bfloat16ToFloat(bfloat16 value)";
+    {
+        CodeStream::Scope b(os);
+        os << "const uint32_t bits = (uint32_t)value.bits << 16;" << std::endl;
+        os << "float result;" << std::endl;
+        os << "memcpy(&result, &bits, sizeof(float));" << std::endl;
+        os << "return result;" << std::endl;
+    }
+    os << std::endl;
+
+    // Float to bfloat16, rounding to nearest even and keeping NaNs quiet
+    os << "inline bfloat16 floatToBfloat16(float value)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint32_t bits;" << std::endl;
+        os << "memcpy(&bits, &value, sizeof(float));" << std::endl;
+        os << "if((bits & 0x7FFFFFFFu) > 0x7F800000u)";
+        {
+            CodeStream::Scope b(os);
+            os << "return bfloat16{(uint16_t)((bits >> 16) | 0x40u)};" << std::endl;
+        }
+        os << "return bfloat16{(uint16_t)((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16)};" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+std::string getReducedPrecisionLoad(const std::string &type, const std::string &value)
+{
+    assert(Utils::isTypeReducedPrecision(type));
+    return ((type == "half") ? "halfToFloat(" : "bfloat16ToFloat(") + value + ")";
+}
+//--------------------------------------------------------------------------
+std::string getReducedPrecisionStore(const std::string &type, const std::string &value)
+{
+    assert(Utils::isTypeReducedPrecision(type));
+    return ((type == "half") ? "floatToHalf(" : "floatToBfloat16(") + value + ")";
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function implements a parser that converts any floating point constant in a code snippet to a floating point constant with an explicit precision (by appending "f" or removing it). 
  */
@@ -473,10 +636,16 @@ std::string ensureFtype(const std::string &oldcode, const std::string &type)
 
 void checkUnreplacedVariables(const std::string &code, const std::string &codeName)
 {
-    std::regex rgx("\\$\\([\\w]+\\)");
+    // Find any remaining identifiers wrapped in '$()'
     std::string vars= "";
-    for (std::sregex_iterator it(code.begin(), code.end(), rgx), end; it != end; it++) {
-        vars+= it->str().substr(2,it->str().size()-3) + ", ";
+    for (size_t start = code.find("$("); start != std::string::npos; start = code.find("$(", start + 2)) {
+        size_t end = start + 2;
+        while (end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+        if (end > (start + 2) && end < code.size() && code[end] == ')') {
+            vars+= code.substr(start + 2, end - start - 2) + ", ";
+        }
     }
     if (vars.size() > 0) {
         vars= vars.substr(0, vars.size()-2);
@@ -2,6 +2,10 @@
 
 // Standard C++ includes
 #include <fstream>
+#include <future>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -28,6 +32,31 @@
 //--------------------------------------------------------------------------
 namespace
 {
+void writeFileIfChanged(const filesystem::path &file, const std::string &contents)
+{
+    // If file already exists, read its existing contents
+    std::ifstream existingFileStream(file.str(), std::ios::binary);
+    if(existingFileStream.good()) {
+        std::ostringstream existingContents;
+        existingContents << existingFileStream.rdbuf();
+
+        // If contents are unchanged, leave file (and its modification time) alone so build systems don't rebuild it
+        if(existingContents.str() == contents) {
+            LOGD_CODE_GEN << "'" << file << "' unchanged";
+            return;
+        }
+    }
+    existingFileStream.close();
+
+    // Otherwise, write new contents
+    LOGD_CODE_GEN << "Writing '" << file << "'";
+    std::ofstream outputFileStream(file.str(), std::ios::binary);
+    if(!outputFileStream.good()) {
+        throw std::runtime_error("Unable to open '" + file.str() + "' for writing");
+    }
+    outputFileStream << contents;
+}
+//--------------------------------------------------------------------------
 void copyFile(const filesystem::path &file, const filesystem::path &sharePath, const filesystem::path &outputPath)
 {
     // Get full path to input and output files
@@ -40,13 +69,14 @@ void copyFile(const filesystem::path &file, const filesystem::path &sharePath, c
     // Create output directory if required
     filesystem::create_directory_recursive(outputFile.parent_path());
 
-    // Copy file
-    // **THINK** we could check modification etc but it doesn't seem worthwhile
+    // Read input file
     LOGD_CODE_GEN << "Copying '" << inputFile << "' to '" << outputFile << "'" << std::endl;
     std::ifstream inputFileStream(inputFile.str(), std::ios::binary);
-    std::ofstream outputFileStream(outputFile.str(), std::ios::binary);
-    assert(outputFileStream.good());
-    outputFileStream << inputFileStream.rdbuf();
+    std::ostringstream inputContents;
+    inputContents << inputFileStream.rdbuf();
+
+    // Copy file if it has changed
+    writeFileIfChanged(outputFile, inputContents.str());
 }
 }
 
@@ -60,38 +90,83 @@ std::pair<std::vector<std::string>, CodeGenerator::MemAlloc> CodeGenerator::gene
     // Create directory for generated code
     filesystem::create_directory(outputPath);
 
-    // Open output file streams for generated code files
-    std::ofstream definitionsStream((outputPath / "definitions.h").str());
-    std::ofstream definitionsInternalStream((outputPath / "definitionsInternal.h").str());
-    std::ofstream neuronUpdateStream((outputPath / "neuronUpdate.cc").str());
-    std::ofstream synapseUpdateStream((outputPath / "synapseUpdate.cc").str());
-    std::ofstream initStream((outputPath / "init.cc").str());
-    std::ofstream runnerStream((outputPath / "runner.cc").str());
-
-    // Wrap output file streams in CodeStreams for formatting
+    // Create string streams for generated code files
+    // **NOTE** files are only written once generation is complete and then only if their contents have changed
+    std::ostringstream definitionsStream;
+    std::ostringstream definitionsInternalStream;
+    std::ostringstream neuronUpdateStream;
+    std::ostringstream synapseUpdateStream;
+    std::ostringstream initStream;
+    std::ostringstream runnerStream;
+    std::ostringstream runnerPushPullStream;
+
+    // Wrap string streams in CodeStreams for formatting
     CodeStream definitions(definitionsStream);
     CodeStream definitionsInternal(definitionsInternalStream);
     CodeStream neuronUpdate(neuronUpdateStream);
     CodeStream synapseUpdate(synapseUpdateStream);
     CodeStream init(initStream);
     CodeStream runner(runnerStream);
+    CodeStream runnerPushPull(runnerPushPullStream);
 
     // Create merged model
     ModelSpecMerged modelMerged(model, backend);
 
-    // Generate modules
-    //**NOTE** memory spaces are given out on a first-come, first-serve basis so the modules should be in preferential order
+    // Generate runner concurrently with other modules
+    auto runnerFuture = std::async(std::launch::async,
+                                   [&]()
+                                   {
+                                       return generateRunner(definitions, definitionsInternal, runner, runnerPushPull,
+                                                             modelMerged, backend);
+                                   });
+
+    // If backend's merged group memory spaces can't run out (none or a single unbounded space, as the CPU
+    // backends use), give each remaining module its own copy and generate them concurrently
+    //**NOTE** memory spaces are given out on a first-come, first-serve basis so, otherwise,
+    // the modules are generated sequentially in preferential order so allocation is deterministic
     auto memorySpaces = backend.getMergedGroupMemorySpaces(modelMerged);
-    auto mem = generateRunner(definitions, definitionsInternal, runner, modelMerged, backend);
-    generateSynapseUpdate(synapseUpdate, memorySpaces, modelMerged, backend);
-    generateNeuronUpdate(neuronUpdate, memorySpaces, modelMerged, backend);
-    generateInit(init, memorySpaces, modelMerged, backend);
+    if(memorySpaces.empty() || (memorySpaces.size() == 1 && memorySpaces.front().second == std::numeric_limits<size_t>::max())) {
+        auto synapseUpdateFuture = std::async(std::launch::async,
+                                              [&]()
+                                              {
+                                                  auto synapseUpdateMemorySpaces = memorySpaces;
+                                                  generateSynapseUpdate(synapseUpdate, synapseUpdateMemorySpaces, modelMerged, backend);
+                                              });
+        auto neuronUpdateFuture = std::async(std::launch::async,
+                                             [&]()
+                                             {
+                                                 auto neuronUpdateMemorySpaces = memorySpaces;
+                                                 generateNeuronUpdate(neuronUpdate, neuronUpdateMemorySpaces, modelMerged, backend);
+                                             });
+        auto initMemorySpaces = memorySpaces;
+        generateInit(init, initMemorySpaces, modelMerged, backend);
+
+        // Wait for modules, rethrowing any exceptions
+        synapseUpdateFuture.get();
+        neuronUpdateFuture.get();
+    }
+    else {
+        generateSynapseUpdate(synapseUpdate, memorySpaces, modelMerged, backend);
+        generateNeuronUpdate(neuronUpdate, memorySpaces, modelMerged, backend);
+        generateInit(init, memorySpaces, modelMerged, backend);
+    }
+    const auto mem = runnerFuture.get();
+
+    // Write generated code files which have changed
+    writeFileIfChanged(outputPath / "definitions.h", definitionsStream.str());
+    writeFileIfChanged(outputPath / "definitionsInternal.h", definitionsInternalStream.str());
+    writeFileIfChanged(outputPath / "neuronUpdate.cc", neuronUpdateStream.str());
+    writeFileIfChanged(outputPath / "synapseUpdate.cc", synapseUpdateStream.str());
+    writeFileIfChanged(outputPath / "init.cc", initStream.str());
+    writeFileIfChanged(outputPath / "runner.cc", runnerStream.str());
+    writeFileIfChanged(outputPath / "runnerPushPull.cc", runnerPushPullStream.str());
 
     // Generate support code module if the backend supports namespaces
     if (backend.supportsNamespace()) {
-        std::ofstream supportCodeStream((outputPath / "supportCode.h").str());
+        std::ostringstream supportCodeStream;
         CodeStream supportCode(supportCodeStream);
         generateSupportCode(supportCode, modelMerged);
+        writeFileIfChanged(outputPath / "supportCode.h", supportCodeStream.str());
     }
 
     // Get list of files to copy into generated code
@@ -107,9 +182,10 @@ std::pair<std::vector<std::string>, CodeGenerator::MemAlloc> CodeGenerator::gene
 
     // If we aren't building standalone modules
     if(!standaloneModules) {
-        // Because it won't be included in each
-        // module, add runner to list of modules
+        // Because they won't be included in each
+        // module, add runner modules to list of modules
         modules.push_back("runner");
+        modules.push_back("runnerPushPull");
 
         // **YUCK** this is kinda (ab)using standaloneModules for things it's not intended for but...
         // Show memory usage
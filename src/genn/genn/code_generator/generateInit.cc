@@ -194,7 +194,10 @@ void genInitWUVarCode(CodeStream &os, const BackendBase &backend, const Substitu
             backend.genSynapseVariableRowInit(os, sg, popSubs,
                 [&vars, &varInit, &sg, &ftype, k](CodeStream &os, Substitutions &varSubs)
                 {
-                    varSubs.addVarSubstitution("value", "group->" + vars[k].name + "[" + varSubs["id_syn"] +  "]");
+                    // If variable is stored using a reduced precision type, initialise into scalar
+                    const std::string target = "group->" + vars[k].name + "[" + varSubs["id_syn"] +  "]";
+                    const bool reducedPrecision = Utils::isTypeReducedPrecision(vars[k].type);
+                    varSubs.addVarSubstitution("value", reducedPrecision ? "initVal" : target);
                     varSubs.addParamValueSubstitution(varInit.getSnippet()->getParamNames(), varInit.getParams(),
                                                       [k, &sg](size_t p) { return sg.isWUVarInitParamHeterogeneous(k, p); },
                                                       "", "group->", vars[k].name);
@@ -207,7 +210,15 @@ void genInitWUVarCode(CodeStream &os, const BackendBase &backend, const Substitu
                     std::string code = varInit.getSnippet()->getCode();
                     varSubs.applyCheckUnreplaced(code, "initVar : merged" + vars[k].name + std::to_string(sg.getIndex()));
                     code = ensureFtype(code, ftype);
-                    os << code << std::endl;
+                    if(reducedPrecision) {
+                        CodeStream::Scope b(os);
+                        os << "scalar initVal;" << std::endl;
+                        os << code << std::endl;
+                        os << target << " = " << getReducedPrecisionStore(vars[k].type, "initVal") << ";" << std::endl;
+                    }
+                    else {
+                        os << code << std::endl;
+                    }
                 });
         }
     }
@@ -450,7 +461,10 @@ void CodeGenerator::generateInit(CodeStream &os, BackendBase::MemorySpaces &memo
                 if(varInit.getSnippet()->requiresKernel()) {
                     CodeStream::Scope b(os);
 
-                    popSubs.addVarSubstitution("value", "group->" + vars[k].name + "[" + popSubs["id_syn"] + "]");
+                    // If variable is stored using a reduced precision type, initialise into scalar
+                    const std::string target = "group->" + vars[k].name + "[" + popSubs["id_syn"] + "]";
+                    const bool reducedPrecision = Utils::isTypeReducedPrecision(vars[k].type);
+                    popSubs.addVarSubstitution("value", reducedPrecision ? "initVal" : target);
                     popSubs.addParamValueSubstitution(varInit.getSnippet()->getParamNames(), varInit.getParams(),
                                                       [k, &sg](size_t p) { return sg.isWUVarInitParamHeterogeneous(k, p); },
                                                       "", "group->", vars[k].name);
@@ -464,7 +478,14 @@ void CodeGenerator::generateInit(CodeStream &os, BackendBase::MemorySpaces &memo
                     //popSubs.applyCheckUnreplaced(code, "initVar : merged" + vars[k].name + std::to_string(sg.getIndex()));
                     popSubs.apply(code);
                     code = ensureFtype(code, model.getPrecision());
-                    os << code << std::endl;
+                    if(reducedPrecision) {
+                        os << "scalar initVal;" << std::endl;
+                        os << code << std::endl;
+                        os << target << " = " << getReducedPrecisionStore(vars[k].type, "initVal") << ";" << std::endl;
+                    }
+                    else {
+                        os << code << std::endl;
+                    }
                 }
             }
         },
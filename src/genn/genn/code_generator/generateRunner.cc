@@ -1,12 +1,17 @@
 #include "code_generator/generateRunner.h"
 
 // Standard C++ includes
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <random>
+#include <set>
 #include <sstream>
 #include <string>
 
 // GeNN includes
 #include "gennUtils.h"
+#include "logging.h"
 
 // GeNN code generator
 #include "code_generator/codeGenUtils.h"
@@ -24,6 +29,28 @@ using namespace CodeGenerator;
 //--------------------------------------------------------------------------
 namespace
 {
+//! Version of checkpoint file format written by saveCheckpoint
+const uint64_t checkpointVersion = 1;
+
+//! Version of connectivity cache file format written by saveConnectivityCache
+const uint64_t connectivityCacheVersion = 1;
+
+//--------------------------------------------------------------------------
+// CheckpointVar
+//--------------------------------------------------------------------------
+//! Array or host scalar which is saved in checkpoints
+struct CheckpointVar
+{
+    std::string type;
+    std::string name;
+    size_t count;
+    bool hostScalar;
+
+    //! Synapse group whose sparse connectivity or weight update variable initialisation writes this array, if any
+    const SynapseGroupInternal *initGroup;
+};
+
+//--------------------------------------------------------------------------
 void genSpikeMacros(CodeStream &os, const NeuronGroupInternal &ng, bool trueSpike)
 {
     const bool delayRequired = trueSpike
@@ -73,12 +100,45 @@ void genHostScalar(CodeStream &definitionsVar, CodeStream &runnerVarDecl, const
     runnerVarDecl << type << " " << name << " = " << value << ";" << std::endl;
 }
 //--------------------------------------------------------------------------
+void genGroupTimingArray(CodeStream &definitionsFunc, CodeStream &definitionsInternalVar, CodeStream &runnerVarDecl,
+                         CodeStream &runnerGetterFunc, const std::string &type, const std::string &name, const std::string &groupName,
+                         const std::string &getterSuffix, unsigned int numSlots, bool sum)
+{
+    // Declare zero-initialised array with a slot for each thread that can update the group
+    definitionsInternalVar << "EXPORT_VAR " << type << " " << name << groupName << "[" << numSlots << "];" << std::endl;
+    runnerVarDecl << type << " " << name << groupName << "[" << numSlots << "] = {};" << std::endl;
+
+    // Export getter
+    definitionsFunc << "EXPORT_FUNC " << type << " get" << groupName << getterSuffix << "();" << std::endl;
+
+    // Define getter which either sums counts or takes the maximum time across slots
+    runnerGetterFunc << type << " get" << groupName << getterSuffix << "()";
+    {
+        CodeStream::Scope a(runnerGetterFunc);
+        runnerGetterFunc << type << " value = " << name << groupName << "[0];" << std::endl;
+        runnerGetterFunc << "for(unsigned int i = 1; i < " << numSlots << "; i++)";
+        {
+            CodeStream::Scope b(runnerGetterFunc);
+            if(sum) {
+                runnerGetterFunc << "value += " << name << groupName << "[i];" << std::endl;
+            }
+            else {
+                runnerGetterFunc << "value = (" << name << groupName << "[i] > value) ? " << name << groupName << "[i] : value;" << std::endl;
+            }
+        }
+        runnerGetterFunc << "return value;" << std::endl;
+    }
+    runnerGetterFunc << std::endl;
+}
+//--------------------------------------------------------------------------
 MemAlloc genHostDeviceScalar(const BackendBase &backend, CodeStream &definitionsVar, CodeStream &definitionsInternalVar, 
                          CodeStream &runnerVarDecl, CodeStream &runnerVarAlloc, CodeStream &runnerVarFree,
-                         const std::string &type, const std::string &name, const std::string &hostValue)
+                         const std::string &type, const std::string &name, const std::string &hostValue,
+                         std::vector<CheckpointVar> &checkpointVars)
 {
     // Generate a host scalar
     genHostScalar(definitionsVar, runnerVarDecl, type, name, hostValue);
+    checkpointVars.push_back({type, name, 1, true, nullptr});
 
     // Generate a single-element array on device
     if(backend.isDeviceScalarRequired()) {
@@ -90,6 +150,16 @@ MemAlloc genHostDeviceScalar(const BackendBase &backend, CodeStream &definitions
     }
 }
 //--------------------------------------------------------------------------
+MemAlloc genCheckpointedArray(const BackendBase &backend, CodeStream &definitionsVar, CodeStream &definitionsInternalVar,
+                              CodeStream &runnerVarDecl, CodeStream &runnerVarAlloc, CodeStream &runnerVarFree,
+                              const std::string &type, const std::string &name, VarLocation loc, size_t count,
+                              std::vector<CheckpointVar> &checkpointVars, const SynapseGroupInternal *initGroup = nullptr)
+{
+    checkpointVars.push_back({type, name, count, false, initGroup});
+    return backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                            type, name, loc, count);
+}
+//--------------------------------------------------------------------------
 bool canPushPullVar(VarLocation loc)
 {
     // A variable can be pushed and pulled if it is located on both host and device
@@ -224,7 +294,8 @@ void genStatePushPull(CodeStream &definitionsFunc, CodeStream &runnerPushFunc, C
 MemAlloc genVariable(const BackendBase &backend, CodeStream &definitionsVar, CodeStream &definitionsFunc,
                      CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
                      CodeStream &push, CodeStream &pull, const std::string &type, const std::string &name,
-                     VarLocation loc, bool autoInitialized, size_t count, std::vector<std::string> &statePushPullFunction)
+                     VarLocation loc, bool autoInitialized, size_t count, std::vector<std::string> &statePushPullFunction,
+                     std::vector<CheckpointVar> &checkpointVars, const SynapseGroupInternal *initGroup = nullptr)
 {
     // Generate push and pull functions
     genVarPushPullScope(definitionsFunc, push, pull, loc, backend.getPreferences().automaticCopy, name, statePushPullFunction,
@@ -234,18 +305,24 @@ MemAlloc genVariable(const BackendBase &backend, CodeStream &definitionsVar, Cod
         });
 
     // Generate variables
-    return backend.genArray(definitionsVar, definitionsInternal, runner, allocations, free,
-                            type, name, loc, count);
+    return genCheckpointedArray(backend, definitionsVar, definitionsInternal, runner, allocations, free,
+                                type, name, loc, count, checkpointVars, initGroup);
 }
 //-------------------------------------------------------------------------
 void genExtraGlobalParam(const ModelSpecMerged &modelMerged, const BackendBase &backend, CodeStream &definitionsVar,
                          CodeStream &definitionsFunc, CodeStream &definitionsInternalVar, CodeStream &runner,
-                         CodeStream &extraGlobalParam, const std::string &type, const std::string &name, bool apiRequired, VarLocation loc)
+                         CodeStream &extraGlobalParam, const std::string &type, const std::string &name, bool apiRequired, VarLocation loc,
+                         std::vector<CheckpointVar> &checkpointVars)
 {
     // Generate variables
     backend.genExtraGlobalParamDefinition(definitionsVar, definitionsInternalVar, type, name, loc);
     backend.genExtraGlobalParamImplementation(runner, type, name, loc);
 
+    // Scalar extra global parameters are checkpointed but the size of pointer ones is only known to user code
+    if(!Utils::isTypePointer(type)) {
+        checkpointVars.push_back({type, name, 1, true, nullptr});
+    }
+
     // If type is a pointer and API is required
     if(Utils::isTypePointer(type) && apiRequired) {
         // Write definitions for functions to allocate and free extra global param
@@ -333,6 +410,298 @@ MemAlloc genGlobalHostRNG(CodeStream &definitionsVar, CodeStream &runnerVarDecl,
     return MemAlloc::host(sizeof(std::mt19937));
 }
 //-------------------------------------------------------------------------
+void genCheckpoint(CodeStream &runner, const ModelSpecMerged &modelMerged, const BackendBase &backend,
+                   std::vector<CheckpointVar> checkpointVars, bool hostRNG)
+{
+    // Checkpoints read and write 'device' arrays directly so can only be supported if they can be accessed from the host
+    if(!backend.isDeviceMemoryHostAccessible()) {
+        throw std::runtime_error("Checkpointing is not supported by this backend");
+    }
+
+    // Add any backend-specific host scalars e.g. RNG seeds
+    for(const auto &s : backend.getCheckpointHostScalars(modelMerged)) {
+        checkpointVars.push_back({s.first, s.second, 1, true, nullptr});
+    }
+
+    // Hash checkpoint layout so checkpoints can't be loaded into models they weren't saved from
+    const ModelSpecInternal &model = modelMerged.getModel();
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(model.getName(), hash);
+    Utils::updateHash(model.getDT(), hash);
+    Utils::updateHash(model.getPrecision(), hash);
+    Utils::updateHash(model.getTimePrecision(), hash);
+    Utils::updateHash(hostRNG, hash);
+    for(const auto &v : checkpointVars) {
+        Utils::updateHash(v.type, hash);
+        Utils::updateHash(v.name, hash);
+        Utils::updateHash(v.count, hash);
+        Utils::updateHash(v.hostScalar, hash);
+    }
+
+    // Generate function to write header, every array in one large sequential write each and the host RNG state
+    runner << "void saveCheckpoint(const char *filename)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "std::ofstream checkpoint(filename, std::ios::binary);" << std::endl;
+        runner << "if(!checkpoint.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Unable to open checkpoint file '\" + std::string(filename) + \"'\");" << std::endl;
+        }
+        runner << "const uint64_t header[3] = {" << checkpointVersion << "ull, " << hash << "ull, iT};" << std::endl;
+        runner << "checkpoint.write(\"GENNCKPT\", 8);" << std::endl;
+        runner << "checkpoint.write(reinterpret_cast<const char*>(header), sizeof(header));" << std::endl;
+        for(const auto &v : checkpointVars) {
+            if(v.hostScalar) {
+                runner << "checkpoint.write(reinterpret_cast<const char*>(&" << v.name << "), sizeof(" << v.type << "));" << std::endl;
+            }
+            else {
+                runner << "checkpoint.write(reinterpret_cast<const char*>(" << v.name << "), " << v.count << " * sizeof(" << v.type << "));" << std::endl;
+            }
+        }
+        if(hostRNG) {
+            CodeStream::Scope b(runner);
+            runner << "std::ostringstream rngStream;" << std::endl;
+            runner << "rngStream << hostRNG;" << std::endl;
+            runner << "const std::string rngState = rngStream.str();" << std::endl;
+            runner << "const uint64_t rngStateSize = rngState.size();" << std::endl;
+            runner << "checkpoint.write(reinterpret_cast<const char*>(&rngStateSize), sizeof(uint64_t));" << std::endl;
+            runner << "checkpoint.write(rngState.data(), rngStateSize);" << std::endl;
+        }
+        runner << "if(!checkpoint.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Error writing checkpoint file '\" + std::string(filename) + \"'\");" << std::endl;
+        }
+    }
+    runner << std::endl;
+
+    // Generate function to validate header and read every array directly into place
+    runner << "void loadCheckpoint(const char *filename)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "std::ifstream checkpoint(filename, std::ios::binary);" << std::endl;
+        runner << "if(!checkpoint.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Unable to open checkpoint file '\" + std::string(filename) + \"'\");" << std::endl;
+        }
+        runner << "char magic[8];" << std::endl;
+        runner << "uint64_t header[3];" << std::endl;
+        runner << "checkpoint.read(magic, 8);" << std::endl;
+        runner << "checkpoint.read(reinterpret_cast<char*>(header), sizeof(header));" << std::endl;
+        runner << "if(!checkpoint.good() || std::string(magic, 8) != \"GENNCKPT\")";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"'\" + std::string(filename) + \"' is not a checkpoint file\");" << std::endl;
+        }
+        runner << "if(header[0] != " << checkpointVersion << "ull)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Checkpoint file '\" + std::string(filename) + \"' has unsupported version\");" << std::endl;
+        }
+        runner << "if(header[1] != " << hash << "ull)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Checkpoint file '\" + std::string(filename) + \"' was saved from a different model\");" << std::endl;
+        }
+        for(const auto &v : checkpointVars) {
+            if(v.hostScalar) {
+                runner << "checkpoint.read(reinterpret_cast<char*>(&" << v.name << "), sizeof(" << v.type << "));" << std::endl;
+            }
+            else {
+                runner << "checkpoint.read(reinterpret_cast<char*>(" << v.name << "), " << v.count << " * sizeof(" << v.type << "));" << std::endl;
+            }
+        }
+        if(hostRNG) {
+            CodeStream::Scope b(runner);
+            runner << "uint64_t rngStateSize = 0;" << std::endl;
+            runner << "checkpoint.read(reinterpret_cast<char*>(&rngStateSize), sizeof(uint64_t));" << std::endl;
+            runner << "std::string rngState(rngStateSize, '\\0');" << std::endl;
+            runner << "checkpoint.read(&rngState[0], rngStateSize);" << std::endl;
+            runner << "std::istringstream rngStream(rngState);" << std::endl;
+            runner << "rngStream >> hostRNG;" << std::endl;
+        }
+        runner << "if(!checkpoint.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Checkpoint file '\" + std::string(filename) + \"' is truncated\");" << std::endl;
+        }
+
+        // Restore time
+        runner << "iT = header[2];" << std::endl;
+        runner << "t = iT*DT;" << std::endl;
+    }
+    runner << std::endl;
+}
+//-------------------------------------------------------------------------
+void genConnectivityCache(CodeStream &runner, const ModelSpecMerged &modelMerged, const BackendBase &backend,
+                          const std::vector<CheckpointVar> &checkpointVars)
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    // Hash everything which determines the result of sparse connectivity and variable initialisation
+    // **NOTE** RNG streams are indexed by merged group so hash groups in merged order
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(model.getName(), hash);
+    Utils::updateHash(model.getPrecision(), hash);
+    Utils::updateHash(model.getSeed(), hash);
+    Utils::updateHash(model.getBatchSize(), hash);
+
+    // Build set of groups whose initialisation should be cached, checking they can be cached
+    std::string unsupportedReason;
+    std::set<const SynapseGroupInternal*> cachedGroups;
+    if(model.getSeed() == 0) {
+        unsupportedReason = "Connectivity cache requires a seed to be set with ModelSpec::setSeed";
+    }
+    auto addGroup =
+        [&cachedGroups, &unsupportedReason, &hash](const SynapseGroupInternal &sg)
+        {
+            // Weight sharing slaves initialise their master's connectivity
+            const SynapseGroupInternal &connectivityGroup = sg.isWeightSharingSlave() ? *sg.getWeightSharingMaster() : sg;
+            if(!connectivityGroup.isSparseConnectivityInitRequired()) {
+                unsupportedReason = "Connectivity cache requires connectivity of synapse group '" + connectivityGroup.getName() + "' to be initialised using a snippet";
+            }
+            if(!connectivityGroup.getConnectivityInitialiser().getSnippet()->getExtraGlobalParams().empty()) {
+                unsupportedReason = "Connectivity cache does not support connectivity of synapse group '" + connectivityGroup.getName() + "' which uses extra global parameters";
+            }
+            cachedGroups.insert(&connectivityGroup);
+            cachedGroups.insert(&sg);
+
+            // Hash initialiser parameters of variables with initialisation code
+            // **NOTE** uninitialised variables are set by the user after each call to initialize() so aren't cached
+            const auto vars = sg.getWUModel()->getVars();
+            for(size_t i = 0; i < vars.size(); i++) {
+                const auto &varInit = sg.getWUVarInitialisers()[i];
+                if(!varInit.getSnippet()->getCode().empty()) {
+                    if(!varInit.getSnippet()->getExtraGlobalParams().empty()) {
+                        unsupportedReason = "Connectivity cache does not support variables of synapse group '" + sg.getName() + "' initialised using extra global parameters";
+                    }
+                    Utils::updateHash(varInit.getParams(), hash);
+                    Utils::updateHash(varInit.getDerivedParams(), hash);
+                }
+            }
+        };
+    for(const auto &m : modelMerged.getMergedSynapseConnectivityInitGroups()) {
+        for(const auto &g : m.getGroups()) {
+            const SynapseGroupInternal &sg = g.get();
+            Utils::updateHash(m.getIndex(), hash);
+            Utils::updateHash(sg.getName(), hash);
+            Utils::updateHash(sg.getConnectivityInitHashDigest(), hash);
+            Utils::updateHash(sg.getConnectivityInitialiser().getParams(), hash);
+            Utils::updateHash(sg.getConnectivityInitialiser().getDerivedParams(), hash);
+            Utils::updateHash(sg.getKernelSize(), hash);
+            Utils::updateHash(sg.getSrcNeuronGroup()->getNumNeurons(), hash);
+            Utils::updateHash(sg.getTrgNeuronGroup()->getNumNeurons(), hash);
+            addGroup(sg);
+        }
+    }
+    for(const auto &m : modelMerged.getMergedSynapseSparseInitGroups()) {
+        for(const auto &g : m.getGroups()) {
+            const SynapseGroupInternal &sg = g.get();
+            Utils::updateHash(m.getIndex(), hash);
+            Utils::updateHash(sg.getName(), hash);
+            Utils::updateHash(sg.getWUInitHashDigest(), hash);
+            addGroup(sg);
+        }
+    }
+
+    // Select arrays allocated for these groups' initialisation (in the order they were allocated) and hash their layout
+    std::vector<CheckpointVar> cachedVars;
+    std::copy_if(checkpointVars.cbegin(), checkpointVars.cend(), std::back_inserter(cachedVars),
+                 [&cachedGroups](const CheckpointVar &v){ return cachedGroups.count(v.initGroup) > 0; });
+    for(const auto &v : cachedVars) {
+        Utils::updateHash(v.type, hash);
+        Utils::updateHash(v.name, hash);
+        Utils::updateHash(v.count, hash);
+    }
+
+    if(!backend.isDeviceMemoryHostAccessible()) {
+        unsupportedReason = "Connectivity cache is not supported by this backend";
+    }
+
+    // If cache can't be used, generate stubs
+    if(!unsupportedReason.empty()) {
+        runner << "bool loadConnectivityCache(const char*)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"" << unsupportedReason << "\");" << std::endl;
+        }
+        runner << std::endl;
+        runner << "void saveConnectivityCache(const char*)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"" << unsupportedReason << "\");" << std::endl;
+        }
+        runner << std::endl;
+        return;
+    }
+
+    // Cache files are named after the model and hash so caches for different models can share a directory
+    std::ostringstream filename;
+    filename << "/" << model.getName() << "_" << std::hex << hash << ".gennconn";
+
+    // Generate function to read cache directly into place if it exists and skip the next initialisation
+    runner << "bool loadConnectivityCache(const char *directory)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "const std::string filename = std::string(directory) + \"" << filename.str() << "\";" << std::endl;
+        runner << "std::ifstream cache(filename, std::ios::binary);" << std::endl;
+        runner << "if(!cache.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "return false;" << std::endl;
+        }
+        runner << "char magic[8];" << std::endl;
+        runner << "uint64_t header[2];" << std::endl;
+        runner << "cache.read(magic, 8);" << std::endl;
+        runner << "cache.read(reinterpret_cast<char*>(header), sizeof(header));" << std::endl;
+        runner << "if(!cache.good() || std::string(magic, 8) != \"GENNCONN\" || header[0] != " << connectivityCacheVersion << "ull || header[1] != " << hash << "ull)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"'\" + filename + \"' is not a valid connectivity cache for this model\");" << std::endl;
+        }
+        for(const auto &v : cachedVars) {
+            runner << "cache.read(reinterpret_cast<char*>(" << v.name << "), " << v.count << " * sizeof(" << v.type << "));" << std::endl;
+        }
+        runner << "if(!cache.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Connectivity cache '\" + filename + \"' is truncated\");" << std::endl;
+        }
+        runner << "connectivityCacheLoaded = true;" << std::endl;
+        runner << "return true;" << std::endl;
+    }
+    runner << std::endl;
+
+    // Generate function to write cache, renaming it into place once complete so concurrent runs never read partial caches
+    runner << "void saveConnectivityCache(const char *directory)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "const std::string filename = std::string(directory) + \"" << filename.str() << "\";" << std::endl;
+        runner << "const std::string tempFilename = filename + \".tmp\";" << std::endl;
+        runner << "std::ofstream cache(tempFilename, std::ios::binary);" << std::endl;
+        runner << "if(!cache.good())";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Unable to open connectivity cache file '\" + tempFilename + \"'\");" << std::endl;
+        }
+        runner << "const uint64_t header[2] = {" << connectivityCacheVersion << "ull, " << hash << "ull};" << std::endl;
+        runner << "cache.write(\"GENNCONN\", 8);" << std::endl;
+        runner << "cache.write(reinterpret_cast<const char*>(header), sizeof(header));" << std::endl;
+        for(const auto &v : cachedVars) {
+            runner << "cache.write(reinterpret_cast<const char*>(" << v.name << "), " << v.count << " * sizeof(" << v.type << "));" << std::endl;
+        }
+        runner << "cache.close();" << std::endl;
+        runner << "if(!cache.good() || std::rename(tempFilename.c_str(), filename.c_str()) != 0)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Error writing connectivity cache file '\" + filename + \"'\");" << std::endl;
+        }
+    }
+    runner << std::endl;
+}
+//-------------------------------------------------------------------------
 void genSynapseConnectivityHostInit(const BackendBase &backend, CodeStream &os, 
                                     const SynapseConnectivityHostInitGroupMerged &sg, const std::string &precision)
 {
@@ -405,7 +774,7 @@ void genSynapseConnectivityHostInit(const BackendBase &backend, CodeStream &os,
 //--------------------------------------------------------------------------
 // CodeGenerator
 //--------------------------------------------------------------------------
-MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner,
+MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &runnerPushPull,
                                        const ModelSpecMerged &modelMerged, const BackendBase &backend)
 {
     // Track memory allocations, initially starting from zero
@@ -448,6 +817,19 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     genTypeRange(definitions, model.getPrecision(), "SCALAR");
     genTypeRange(definitions, model.getTimePrecision(), "TIME");
 
+    // If any variables are stored using reduced precision types, check backend supports them and write types
+    if(model.isReducedPrecisionInUse()) {
+        if(!backend.isReducedPrecisionStorageSupported()) {
+            throw std::runtime_error("Backend does not support storing variables using reduced precision types");
+        }
+        genReducedPrecisionTypes(definitions);
+    }
+
+    // If several instances of model are simulated in a batch, check backend supports it
+    if(model.getBatchSize() > 1 && !backend.isBatchingSupported()) {
+        throw std::runtime_error("Backend does not support simulating models with a batch size greater than 1");
+    }
+
     definitions << "// ------------------------------------------------------------------------" << std::endl;
     definitions << "// bit tool macros" << std::endl;
     definitions << "#define B(x,i) ((x) & (0x80000000 >> (i))) //!< Extract the bit at the specified position i from x" << std::endl;
@@ -457,8 +839,19 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
     // Write runner preamble
     runner << "#include \"definitionsInternal.h\"" << std::endl << std::endl;
+    if(backend.isDeviceMemoryHostAccessible()) {
+        runner << "// Standard C++ includes" << std::endl;
+        runner << "#include <cstdio>" << std::endl;
+        runner << "#include <fstream>" << std::endl;
+        runner << "#include <sstream>" << std::endl << std::endl;
+    }
     backend.genRunnerPreamble(runner, modelMerged);
 
+    // Write push-pull module preamble
+    // **NOTE** extra global parameter, push, pull and getter functions only access variables
+    // declared in definitionsInternal.h so are compiled in a separate translation unit
+    runnerPushPull << "#include \"definitionsInternal.h\"" << std::endl << std::endl;
+
     // Create codestreams to generate different sections of runner and definitions
     std::stringstream runnerVarDeclStream;
     std::stringstream runnerVarAllocStream;
@@ -499,12 +892,21 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     allVarStreams << "// global variables" << std::endl;
     allVarStreams << "// ------------------------------------------------------------------------" << std::endl;
 
+    // Arrays and scalars which should be saved in checkpoints
+    std::vector<CheckpointVar> checkpointVars;
+
     // Define and declare time variables
     definitionsVar << "EXPORT_VAR unsigned long long iT;" << std::endl;
     definitionsVar << "EXPORT_VAR " << model.getTimePrecision() << " t;" << std::endl;
     runnerVarDecl << "unsigned long long iT;" << std::endl;
     runnerVarDecl << model.getTimePrecision() << " t;" << std::endl;
 
+    // Flag set by loadConnectivityCache to skip the next sparse connectivity initialisation
+    if(backend.isDeviceMemoryHostAccessible()) {
+        definitionsInternalVar << "EXPORT_VAR bool connectivityCacheLoaded;" << std::endl;
+        runnerVarDecl << "bool connectivityCacheLoaded = false;" << std::endl;
+    }
+
     if(model.isRecordingInUse()) {
         runnerVarDecl << "unsigned long long numRecordingTimesteps = 0;" << std::endl;
     }
@@ -573,93 +975,41 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         allVarStreams << std::endl;
     }
 
-    runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
-    runnerVarDecl << "// merged group arrays" << std::endl;
-    runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
-
-    definitionsInternal << "// ------------------------------------------------------------------------" << std::endl;
-    definitionsInternal << "// merged group structures" << std::endl;
-    definitionsInternal << "// ------------------------------------------------------------------------" << std::endl;
-
-    definitionsInternalVar << "// ------------------------------------------------------------------------" << std::endl;
-    definitionsInternalVar << "// merged group arrays for host initialisation" << std::endl;
-    definitionsInternalVar << "// ------------------------------------------------------------------------" << std::endl;
-
-    definitionsInternalFunc << "// ------------------------------------------------------------------------" << std::endl;
-    definitionsInternalFunc << "// copying merged group structures to device" << std::endl;
-    definitionsInternalFunc << "// ------------------------------------------------------------------------" << std::endl;
-
-    // Loop through merged synapse connectivity host initialisation groups
-    for(const auto &m : modelMerged.getMergedSynapseConnectivityHostInitGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged synapse connectivity host init groups and generate host init code
-    // **NOTE** this is done here so valid pointers get copied straight into subsequent structures and merged EGP system isn't required
-    for(const auto &sg : modelMerged.getMergedSynapseConnectivityHostInitGroups()) {
-        genSynapseConnectivityHostInit(backend, runnerMergedStructAlloc, sg, model.getPrecision());
-    }
+    // If per-group timing is enabled
+    if(backend.isGroupTimingEnabled()) {
+        const unsigned int numSlots = backend.getNumGroupTimingSlots();
 
-    // Generate merged neuron initialisation groups
-    for(const auto &m : modelMerged.getMergedNeuronInitGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged dense synapse init groups
-    for(const auto &m : modelMerged.getMergedSynapseDenseInitGroups()) {
-         m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                          runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged synapse connectivity initialisation groups
-    for(const auto &m : modelMerged.getMergedSynapseConnectivityInitGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged sparse synapse init groups
-    for(const auto &m : modelMerged.getMergedSynapseSparseInitGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged neuron update groups
-    for(const auto &m : modelMerged.getMergedNeuronUpdateGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged presynaptic update groups
-    for(const auto &m : modelMerged.getMergedPresynapticUpdateGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through merged postsynaptic update groups
-    for(const auto &m : modelMerged.getMergedPostsynapticUpdateGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
-    }
-
-    // Loop through synapse dynamics groups
-    for(const auto &m : modelMerged.getMergedSynapseDynamicsGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
+        runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
+        runnerVarDecl << "// group timers" << std::endl;
+        runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
+        for(const auto &n : model.getNeuronGroups()) {
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "double", "neuronUpdateTime", n.first, "NeuronUpdateTime", numSlots, false);
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "double", "neuronInitTime", n.first, "InitTime", numSlots, false);
+        }
+        for(const auto &s : model.getSynapseGroups()) {
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "double", "presynapticUpdateTime", s.first, "PresynapticUpdateTime", numSlots, false);
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "double", "postsynapticUpdateTime", s.first, "PostsynapticUpdateTime", numSlots, false);
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "double", "synapseDynamicsTime", s.first, "SynapseDynamicsTime", numSlots, false);
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "double", "synapseInitTime", s.first, "InitTime", numSlots, false);
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "unsigned long long", "numPresynapticEvents", s.first, "NumPresynapticEvents", numSlots, true);
+            genGroupTimingArray(definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerGetterFunc, "unsigned long long", "numSynapticEvents", s.first, "NumSynapticEvents", numSlots, true);
+        }
+        runnerVarDecl << std::endl;
     }
-
-    // Loop through neuron groups whose spike queues need resetting
-    for(const auto &m : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
-        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                         runnerVarDecl, runnerMergedStructAlloc);
+    else if(backend.getPreferences().enableGroupTiming) {
+        LOGW_CODE_GEN << "Per-group timing is not supported by this backend - enableGroupTiming preference will be ignored";
     }
 
-    // Loop through synapse groups whose dendritic delay pointers need updating
-    for(const auto &m : modelMerged.getMergedSynapseDendriticDelayUpdateGroups()) {
-       m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
-                        runnerVarDecl, runnerMergedStructAlloc);
-    }
+    // Arrays of per-instance state are allocated for every instance of a batched model
+    // **NOTE** the number of elements each instance requires is recorded so merged groups can be offset into them
+    const unsigned int batchSize = model.getBatchSize();
+    std::map<std::string, size_t> batchStrides;
+    auto batchCount =
+        [batchSize, &batchStrides, &backend](const std::string &name, size_t count)
+        {
+            batchStrides.emplace(backend.getDeviceVarPrefix() + name, count);
+            return count * batchSize;
+        };
 
     allVarStreams << "// ------------------------------------------------------------------------" << std::endl;
     allVarStreams << "// local neuron groups" << std::endl;
@@ -675,10 +1025,10 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         const size_t numNeuronDelaySlots = (size_t)n.second.getNumNeurons() * (size_t)n.second.getNumDelaySlots();
         const size_t numSpikeCounts = n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1;
         const size_t numSpikes = n.second.isTrueSpikeRequired() ? numNeuronDelaySlots : n.second.getNumNeurons();
-        mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), numSpikeCounts);
-        mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), numSpikes);
+        mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), batchCount("glbSpkCnt" + n.first, numSpikeCounts), checkpointVars);
+        mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), batchCount("glbSpk" + n.first, numSpikes), checkpointVars);
 
         // True spike push and pull functions
         genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeLocation(),
@@ -686,9 +1036,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                             [&]()
                             {
                                 backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                            "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), true, numSpikeCounts);
+                                                            "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), true, numSpikeCounts * batchSize);
                                 backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                            "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), true, numSpikes);
+                                                            "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), true, numSpikes * batchSize);
                             });
 
         // Current true spike push and pull functions
@@ -716,12 +1066,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             genSpikeMacros(definitionsVar, n.second, false);
 
             // Spike-like event variables
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    n.second.getNumDelaySlots());
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    numNeuronDelaySlots);
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeEventLocation(),
+                                        batchCount("glbSpkCntEvnt" + n.first, n.second.getNumDelaySlots()), checkpointVars);
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeEventLocation(),
+                                        batchCount("glbSpkEvnt" + n.first, numNeuronDelaySlots), checkpointVars);
 
             // Spike-like event push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeEventLocation(),
@@ -729,9 +1079,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 [&]()
                                 {
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumDelaySlots());
+                                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumDelaySlots() * batchSize);
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                                "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, numNeuronDelaySlots);
+                                                                "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, numNeuronDelaySlots * batchSize);
                                 });
 
             // Current spike-like event push and pull functions
@@ -757,14 +1107,14 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // If neuron group has axonal delays
         if (n.second.isDelayRequired()) {
             mem += genHostDeviceScalar(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                       "unsigned int", "spkQuePtr" + n.first, "0");
+                                       "unsigned int", "spkQuePtr" + n.first, "0", checkpointVars);
         }
 
         // If neuron group needs to record its spike times
         if (n.second.isSpikeTimeRequired()) {
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeLocation(),
-                                    numNeuronDelaySlots);
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeLocation(),
+                                        batchCount("sT" + n.first, numNeuronDelaySlots), checkpointVars);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeTimeLocation(),
@@ -773,15 +1123,15 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 {
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
                                                                 "sT" + n.first, n.second.getSpikeTimeLocation(), true, 
-                                                                numNeuronDelaySlots);
+                                                                numNeuronDelaySlots * batchSize);
                                 });
         }
 
         // If neuron group needs to record its previous spike times
         if (n.second.isPrevSpikeTimeRequired()) {
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    model.getTimePrecision(), "prevST" + n.first, n.second.getPrevSpikeTimeLocation(),
-                                    numNeuronDelaySlots);
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        model.getTimePrecision(), "prevST" + n.first, n.second.getPrevSpikeTimeLocation(),
+                                        batchCount("prevST" + n.first, numNeuronDelaySlots), checkpointVars);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getPrevSpikeTimeLocation(),
@@ -789,16 +1139,16 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 [&]()
                                 {
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
-                                                                "prevST" + n.first, n.second.getPrevSpikeTimeLocation(), true,
-                                                                numNeuronDelaySlots);
+                                                                "prevST" + n.first, n.second.getPrevSpikeTimeLocation(), true, 
+                                                                numNeuronDelaySlots * batchSize);
                                 });
         }
 
         // If neuron group needs to record its spike-like-event times
         if (n.second.isSpikeEventTimeRequired()) {
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    model.getTimePrecision(), "seT" + n.first, n.second.getSpikeEventTimeLocation(),
-                                    numNeuronDelaySlots);
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        model.getTimePrecision(), "seT" + n.first, n.second.getSpikeEventTimeLocation(),
+                                        batchCount("seT" + n.first, numNeuronDelaySlots), checkpointVars);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeTimeLocation(),
@@ -807,15 +1157,15 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 {
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
                                                                 "seT" + n.first, n.second.getSpikeEventTimeLocation(), true, 
-                                                                numNeuronDelaySlots);
+                                                                numNeuronDelaySlots * batchSize);
                                 });
         }
 
         // If neuron group needs to record its previous spike-like-event times
         if (n.second.isPrevSpikeEventTimeRequired()) {
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    model.getTimePrecision(), "prevSET" + n.first, n.second.getPrevSpikeEventTimeLocation(),
-                                    numNeuronDelaySlots);
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        model.getTimePrecision(), "prevSET" + n.first, n.second.getPrevSpikeEventTimeLocation(),
+                                        batchCount("prevSET" + n.first, numNeuronDelaySlots), checkpointVars);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getPrevSpikeEventTimeLocation(),
@@ -824,7 +1174,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 {
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
                                                                 "prevSET" + n.first, n.second.getPrevSpikeEventTimeLocation(), true, 
-                                                                numNeuronDelaySlots);
+                                                                numNeuronDelaySlots * batchSize);
                                 });
         }
 
@@ -843,7 +1193,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             const bool autoInitialized = !varInitSnippet->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                runnerPushFunc, runnerPullFunc, vars[i].type, vars[i].name + n.first,
-                               n.second.getVarLocation(i), autoInitialized, count, neuronStatePushPullFunctions);
+                               n.second.getVarLocation(i), autoInitialized, batchCount(vars[i].name + n.first, count),
+                               neuronStatePushPullFunctions, checkpointVars);
 
             // Current variable push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getVarLocation(i),
@@ -874,7 +1225,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar, 
                                     runnerVarDecl, runnerExtraGlobalParamFunc, 
                                     extraGlobalParams[e].type, extraGlobalParams[e].name + vars[i].name + n.first,
-                                    true, VarLocation::HOST_DEVICE);
+                                    true, VarLocation::HOST_DEVICE, checkpointVars);
             }
         }
 
@@ -890,7 +1241,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                 runnerVarDecl, runnerExtraGlobalParamFunc, 
                                 extraGlobalParams[i].type, extraGlobalParams[i].name + n.first,
-                                true, n.second.getExtraGlobalParamLocation(i));
+                                true, n.second.getExtraGlobalParamLocation(i), checkpointVars);
         }
 
         if(!n.second.getCurrentSources().empty()) {
@@ -906,7 +1257,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 const bool autoInitialized = !varInitSnippet->getCode().empty();
                 mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                    runnerPushFunc, runnerPullFunc, csVars[i].type, csVars[i].name + cs->getName(),
-                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons(), currentSourceStatePushPullFunctions);
+                                   cs->getVarLocation(i), autoInitialized, batchCount(csVars[i].name + cs->getName(), n.second.getNumNeurons()),
+                                   currentSourceStatePushPullFunctions, checkpointVars);
 
                 // Loop through EGPs required to initialize current source variable
                 const auto extraGlobalParams = varInitSnippet->getExtraGlobalParams();
@@ -914,7 +1266,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                     genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                         runnerVarDecl, runnerExtraGlobalParamFunc, 
                                         extraGlobalParams[e].type, extraGlobalParams[e].name + vars[i].name + cs->getName(),
-                                        true, VarLocation::HOST_DEVICE);
+                                        true, VarLocation::HOST_DEVICE, checkpointVars);
                 }
             }
 
@@ -930,7 +1282,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                     runnerVarDecl, runnerExtraGlobalParamFunc, 
                                     csExtraGlobalParams[i].type, csExtraGlobalParams[i].name + cs->getName(),
-                                    true, cs->getExtraGlobalParamLocation(i));
+                                    true, cs->getExtraGlobalParamLocation(i), checkpointVars);
             }
         }
     }
@@ -943,24 +1295,25 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // Loop through merged incoming synaptic populations
         // **NOTE** because of merging we need to loop through postsynaptic models in this
         for(const auto *sg : n.second.getMergedInSyn()) {
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    model.getPrecision(), "inSyn" + sg->getPSModelTargetName(), sg->getInSynLocation(),
-                                    sg->getTrgNeuronGroup()->getNumNeurons());
+            mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        model.getPrecision(), "inSyn" + sg->getPSModelTargetName(), sg->getInSynLocation(),
+                                        batchCount("inSyn" + sg->getPSModelTargetName(), sg->getTrgNeuronGroup()->getNumNeurons()), checkpointVars);
 
             if (sg->isDendriticDelayRequired()) {
-                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                        model.getPrecision(), "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
-                                        (size_t)sg->getMaxDendriticDelayTimesteps() * (size_t)sg->getTrgNeuronGroup()->getNumNeurons());
+                mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            model.getPrecision(), "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
+                                            batchCount("denDelay" + sg->getPSModelTargetName(), (size_t)sg->getMaxDendriticDelayTimesteps() * (size_t)sg->getTrgNeuronGroup()->getNumNeurons()),
+                                            checkpointVars);
                 mem += genHostDeviceScalar(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                           "unsigned int", "denDelayPtr" + sg->getPSModelTargetName(), "0");
+                                           "unsigned int", "denDelayPtr" + sg->getPSModelTargetName(), "0", checkpointVars);
             }
 
             if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
                 const auto psmVars = sg->getPSModel()->getVars();
                 for(size_t v = 0; v < psmVars.size(); v++) {
-                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                            psmVars[v].type, psmVars[v].name + sg->getPSModelTargetName(), sg->getPSVarLocation(v),
-                                            sg->getTrgNeuronGroup()->getNumNeurons());
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                psmVars[v].type, psmVars[v].name + sg->getPSModelTargetName(), sg->getPSVarLocation(v),
+                                                batchCount(psmVars[v].name + sg->getPSModelTargetName(), sg->getTrgNeuronGroup()->getNumNeurons()), checkpointVars);
 
                     // Loop through EGPs required to initialize PSM variable
                     const auto extraGlobalParams = sg->getPSVarInitialisers()[v].getSnippet()->getExtraGlobalParams();
@@ -968,7 +1321,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                         genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                             runnerVarDecl, runnerExtraGlobalParamFunc, 
                                             extraGlobalParams[e].type, extraGlobalParams[e].name + psmVars[v].name + sg->getPSModelTargetName(),
-                                            true, VarLocation::HOST_DEVICE);
+                                            true, VarLocation::HOST_DEVICE, checkpointVars);
                     }
                 }
             }
@@ -988,8 +1341,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
             if(s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
                 const size_t gpSize = ceilDivide((size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second), 32);
-                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                        "uint32_t", "gp" + s.second.getName(), s.second.getSparseConnectivityLocation(), gpSize);
+                mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "uint32_t", "gp" + s.second.getName(), s.second.getSparseConnectivityLocation(), gpSize, checkpointVars, &s.second);
 
                 // Generate push and pull functions for bitmask
                 genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, s.second.getSparseConnectivityLocation(),
@@ -1003,26 +1356,33 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             }
             else if(s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                 const VarLocation varLoc = s.second.getSparseConnectivityLocation();
-                const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
+                const bool compact = backend.isCompactSparse(s.second);
+                const size_t size = compact ? s.second.getMaxTotalConnections() : s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
 
                 // Maximum row length constant
                 definitionsVar << "EXPORT_VAR const unsigned int maxRowLength" << s.second.getName() << ";" << std::endl;
                 runnerVarDecl << "const unsigned int maxRowLength" << s.second.getName() << " = " << backend.getSynapticMatrixRowStride(s.second) << ";" << std::endl;
 
                 // Row lengths
-                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                        "unsigned int", "rowLength" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons());
+                mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "rowLength" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons(), checkpointVars, &s.second);
+
+                // If connectivity is compact, start of each row within target indices
+                if(compact) {
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                s.second.getSparseRowPtrType(), "rowPtr" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons() + 1, checkpointVars, &s.second);
+                }
 
                 // Target indices
-                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                        s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+                mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size, checkpointVars, &s.second);
 
                 // **TODO** remap is not always required
                 if(backend.isSynRemapRequired() && !s.second.getWUModel()->getSynapseDynamicsCode().empty()) {
                     // Allocate synRemap
                     // **THINK** this is over-allocating
-                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                            "unsigned int", "synRemap" + s.second.getName(), VarLocation::DEVICE, size + 1);
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                "unsigned int", "synRemap" + s.second.getName(), VarLocation::DEVICE, size + 1, checkpointVars, &s.second);
                 }
 
                 // **TODO** remap is not always required
@@ -1030,12 +1390,33 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                     const size_t postSize = (size_t)s.second.getTrgNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxSourceConnections();
 
                     // Allocate column lengths
-                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                            "unsigned int", "colLength" + s.second.getName(), VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons());
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                "unsigned int", "colLength" + s.second.getName(), VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons(), checkpointVars, &s.second);
 
                     // Allocate remap
-                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                            "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                backend.getSparseAddressType(s.second), "remap" + s.second.getName(), VarLocation::DEVICE, postSize, checkpointVars, &s.second);
+
+                    // Allocate presynaptic index of each remapped synapse
+                    if(backend.isRemapPreInd(s.second)) {
+                        mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                    s.second.getRemapPreIndType(), "remapPreInd" + s.second.getName(), VarLocation::DEVICE, postSize, checkpointVars, &s.second);
+                    }
+                }
+
+                if(backend.isPostsynapticTilingSupported() && s.second.getPostsynapticTileSize() > 0) {
+                    const size_t numTiles = ceilDivide(s.second.getTrgNeuronGroup()->getNumNeurons(), s.second.getPostsynapticTileSize());
+                    const size_t tileSize = (size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * (numTiles + 1);
+
+                    // Allocate start of each postsynaptic tile within each row
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                "unsigned int", "tileRowStart" + s.second.getName(), VarLocation::DEVICE, tileSize, checkpointVars, &s.second);
+                }
+
+                if(backend.isDeltaSparseInd(s.second)) {
+                    // Allocate deltas between successive target indices
+                    mem += genCheckpointedArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                                s.second.getSparseIndDeltaType(), "indDelta" + s.second.getName(), VarLocation::DEVICE, size, checkpointVars, &s.second);
                 }
 
                 // Generate push and pull functions for sparse connectivity
@@ -1047,6 +1428,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                         backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "unsigned int", "rowLength" + s.second.getName(), 
                                                                     s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons());
 
+                                        // Row starts
+                                        if(compact) {
+                                            backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, s.second.getSparseRowPtrType(), "rowPtr" + s.second.getName(),
+                                                                        s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+                                        }
+
                                         // Target indices
                                         backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "unsigned int", "ind" + s.second.getName(), 
                                                                     s.second.getSparseConnectivityLocation(), autoInitialized, size);
@@ -1068,7 +1455,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         const bool proceduralWeights = (s.second.getMatrixType() & SynapseMatrixWeight::PROCEDURAL);
         std::vector<std::string> synapseGroupStatePushPullFunctions;
         if (!s.second.isWeightSharingSlave() && (individualWeights || proceduralWeights)) {
-            const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
+            const size_t size = backend.isCompactSparse(s.second) ? s.second.getMaxTotalConnections() : s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
 
             const auto wuVars = wu->getVars();
             for(size_t i = 0; i < wuVars.size(); i++) {
@@ -1077,7 +1464,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                     const bool autoInitialized = !varInitSnippet->getCode().empty();
                     mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                        runnerPushFunc, runnerPullFunc, wuVars[i].type, wuVars[i].name + s.second.getName(),
-                                       s.second.getWUVarLocation(i), autoInitialized, size, synapseGroupStatePushPullFunctions);
+                                       s.second.getWUVarLocation(i), autoInitialized, batchCount(wuVars[i].name + s.second.getName(), size),
+                                       synapseGroupStatePushPullFunctions, checkpointVars, autoInitialized ? &s.second : nullptr);
                 }
 
                 // Loop through EGPs required to initialize WUM variable
@@ -1086,7 +1474,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                     genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                         runnerVarDecl, runnerExtraGlobalParamFunc, 
                                         extraGlobalParams[e].type, extraGlobalParams[e].name + wuVars[i].name + s.second.getName(),
-                                        true, VarLocation::HOST_DEVICE);
+                                        true, VarLocation::HOST_DEVICE, checkpointVars);
                 }
             }
         }
@@ -1101,7 +1489,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             const bool autoInitialized = !varInitSnippet->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                             runnerPushFunc, runnerPullFunc, wuPreVars[i].type, wuPreVars[i].name + s.second.getName(),
-                            s.second.getWUPreVarLocation(i), autoInitialized, preSize, synapseGroupStatePushPullFunctions);
+                            s.second.getWUPreVarLocation(i), autoInitialized, batchCount(wuPreVars[i].name + s.second.getName(), preSize),
+                            synapseGroupStatePushPullFunctions, checkpointVars);
 
             // Loop through EGPs required to initialize WUM variable
             const auto extraGlobalParams = varInitSnippet->getExtraGlobalParams();
@@ -1109,7 +1498,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                     runnerVarDecl, runnerExtraGlobalParamFunc, 
                                     extraGlobalParams[e].type, extraGlobalParams[e].name + wuPreVars[i].name + s.second.getName(),
-                                    true, VarLocation::HOST_DEVICE);
+                                    true, VarLocation::HOST_DEVICE, checkpointVars);
             }
         }
 
@@ -1123,7 +1512,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             const bool autoInitialized = !varInitSnippet->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                runnerPushFunc, runnerPullFunc, wuPostVars[i].type, wuPostVars[i].name + s.second.getName(),
-                               s.second.getWUPostVarLocation(i), autoInitialized, postSize, synapseGroupStatePushPullFunctions);
+                               s.second.getWUPostVarLocation(i), autoInitialized, batchCount(wuPostVars[i].name + s.second.getName(), postSize),
+                               synapseGroupStatePushPullFunctions, checkpointVars);
 
             // Loop through EGPs required to initialize WUM variable
             const auto extraGlobalParams = varInitSnippet->getExtraGlobalParams();
@@ -1131,7 +1521,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                     runnerVarDecl, runnerExtraGlobalParamFunc, 
                                     extraGlobalParams[e].type, extraGlobalParams[e].name + wuPostVars[i].name + s.second.getName(),
-                                    true, VarLocation::HOST_DEVICE);
+                                    true, VarLocation::HOST_DEVICE, checkpointVars);
             }
         }
 
@@ -1144,7 +1534,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 [&]()
                                 {
                                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getPrecision(), "inSyn" + s.second.getName(), s.second.getInSynLocation(),
-                                                                true, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                                true, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                                 });
 
             // If this synapse group has individual postsynaptic model variables
@@ -1157,7 +1547,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                         [&]()
                                         {
                                             backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, psmVars[i].type, psmVars[i].name + s.second.getName(), s.second.getPSVarLocation(i),
-                                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                                         });
                 }
             }
@@ -1175,7 +1565,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                 runnerVarDecl, runnerExtraGlobalParamFunc, 
                                 psmExtraGlobalParams[i].type, psmExtraGlobalParams[i].name + s.second.getName(),
-                                true, s.second.getPSExtraGlobalParamLocation(i));
+                                true, s.second.getPSExtraGlobalParamLocation(i), checkpointVars);
         }
 
         const auto wuExtraGlobalParams = wu->getExtraGlobalParams();
@@ -1183,7 +1573,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             genExtraGlobalParam(modelMerged, backend, definitionsVar, definitionsFunc, definitionsInternalVar,
                                 runnerVarDecl, runnerExtraGlobalParamFunc, 
                                 wuExtraGlobalParams[i].type, wuExtraGlobalParams[i].name + s.second.getName(),
-                                true, s.second.getWUExtraGlobalParamLocation(i));
+                                true, s.second.getWUExtraGlobalParamLocation(i), checkpointVars);
         }
 
         // If group isn't a weight sharing slave 
@@ -1194,44 +1584,134 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                     runnerVarDecl, runnerExtraGlobalParamFunc, 
                                     sparseConnExtraGlobalParams[i].type, sparseConnExtraGlobalParams[i].name + s.second.getName(),
                                     s.second.getConnectivityInitialiser().getSnippet()->getHostInitCode().empty(),
-                                    s.second.getSparseConnectivityExtraGlobalParamLocation(i));
+                                    s.second.getSparseConnectivityExtraGlobalParamLocation(i), checkpointVars);
             }
         }
     }
     allVarStreams << std::endl;
 
+    // Now all arrays have been allocated, generate merged group structures pointing into them
+    runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
+    runnerVarDecl << "// merged group arrays" << std::endl;
+    runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
+
+    definitionsInternal << "// ------------------------------------------------------------------------" << std::endl;
+    definitionsInternal << "// merged group structures" << std::endl;
+    definitionsInternal << "// ------------------------------------------------------------------------" << std::endl;
+
+    definitionsInternalVar << "// ------------------------------------------------------------------------" << std::endl;
+    definitionsInternalVar << "// merged group arrays for host initialisation" << std::endl;
+    definitionsInternalVar << "// ------------------------------------------------------------------------" << std::endl;
+
+    definitionsInternalFunc << "// ------------------------------------------------------------------------" << std::endl;
+    definitionsInternalFunc << "// copying merged group structures to device" << std::endl;
+    definitionsInternalFunc << "// ------------------------------------------------------------------------" << std::endl;
+
+    // Loop through merged synapse connectivity host initialisation groups
+    for(const auto &m : modelMerged.getMergedSynapseConnectivityHostInitGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc);
+    }
+
+    // Loop through merged synapse connectivity host init groups and generate host init code
+    // **NOTE** this is done here so valid pointers get copied straight into subsequent structures and merged EGP system isn't required
+    for(const auto &sg : modelMerged.getMergedSynapseConnectivityHostInitGroups()) {
+        genSynapseConnectivityHostInit(backend, runnerMergedStructAlloc, sg, model.getPrecision());
+    }
+
+    // Generate merged neuron initialisation groups
+    for(const auto &m : modelMerged.getMergedNeuronInitGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through merged dense synapse init groups
+    for(const auto &m : modelMerged.getMergedSynapseDenseInitGroups()) {
+         m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                          runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through merged synapse connectivity initialisation groups
+    for(const auto &m : modelMerged.getMergedSynapseConnectivityInitGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc);
+    }
+
+    // Loop through merged sparse synapse init groups
+    for(const auto &m : modelMerged.getMergedSynapseSparseInitGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through merged neuron update groups
+    for(const auto &m : modelMerged.getMergedNeuronUpdateGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through merged presynaptic update groups
+    for(const auto &m : modelMerged.getMergedPresynapticUpdateGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through merged postsynaptic update groups
+    for(const auto &m : modelMerged.getMergedPostsynapticUpdateGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through synapse dynamics groups
+    for(const auto &m : modelMerged.getMergedSynapseDynamicsGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through neuron groups whose spike queues need resetting
+    for(const auto &m : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
+        m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                         runnerVarDecl, runnerMergedStructAlloc, batchSize, batchStrides);
+    }
+
+    // Loop through synapse groups whose dendritic delay pointers need updating
+    for(const auto &m : modelMerged.getMergedSynapseDendriticDelayUpdateGroups()) {
+       m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
+                        runnerVarDecl, runnerMergedStructAlloc);
+    }
+
     // End extern C block around variable declarations
     runnerVarDecl << "}  // extern \"C\"" << std::endl;
  
     // Write variable declarations to runner
     runner << runnerVarDeclStream.str();
 
-    // Write extra global parameter functions to runner
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << "// extra global params" << std::endl;
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << runnerExtraGlobalParamFuncStream.str();
-    runner << std::endl;
-
-    // Write push function declarations to runner
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << "// copying things to device" << std::endl;
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << runnerPushFuncStream.str();
-    runner << std::endl;
-
-    // Write pull function declarations to runner
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << "// copying things from device" << std::endl;
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << runnerPullFuncStream.str();
-    runner << std::endl;
-
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << "// helper getter functions" << std::endl;
-    runner << "// ------------------------------------------------------------------------" << std::endl;
-    runner << runnerGetterFuncStream.str();
-    runner << std::endl;
+    // Write extra global parameter functions to push-pull module
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << "// extra global params" << std::endl;
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << runnerExtraGlobalParamFuncStream.str();
+    runnerPushPull << std::endl;
+
+    // Write push function definitions to push-pull module
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << "// copying things to device" << std::endl;
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << runnerPushFuncStream.str();
+    runnerPushPull << std::endl;
+
+    // Write pull function definitions to push-pull module
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << "// copying things from device" << std::endl;
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << runnerPullFuncStream.str();
+    runnerPushPull << std::endl;
+
+    // Write getter functions to push-pull module
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << "// helper getter functions" << std::endl;
+    runnerPushPull << "// ------------------------------------------------------------------------" << std::endl;
+    runnerPushPull << runnerGetterFuncStream.str();
+    runnerPushPull << std::endl;
 
     if(!backend.getPreferences().automaticCopy) {
         // ---------------------------------------------------------------------
@@ -1292,6 +1772,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
     // If model uses recording
     if(model.isRecordingInUse()) {
+        // Each instance of a batched model records into its own numWords-sized section of the recording buffers
+        const std::string numBatchWords = (batchSize > 1) ? ("numWords * " + std::to_string(batchSize)) : "numWords";
+
         runner << "void allocateRecordingBuffers(unsigned int timesteps)";
         {
             CodeStream::Scope b(runner);
@@ -1312,14 +1795,18 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 // **YUCK** maybe this should be renamed genDynamicArray
                 if(n.second.isSpikeRecordingEnabled()) {
                     CodeStream::Scope b(runner);
-                    backend.genExtraGlobalParamAllocation(runner, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE, "numWords");
+                    backend.genExtraGlobalParamAllocation(runner, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE, numBatchWords);
 
                     // Get destinations in merged structures, this EGP 
                     // needs to be copied to and call push function
                     const auto &mergedDestinations = modelMerged.getMergedEGPDestinations("recordSpk" + n.first, backend);
                     for(const auto &v : mergedDestinations) {
                         runner << "pushMerged" << v.first << v.second.mergedGroupIndex << v.second.fieldName << "ToDevice(";
-                        runner << v.second.groupIndex << ", " << backend.getDeviceVarPrefix() << "recordSpk" + n.first << ");" << std::endl;
+                        runner << v.second.groupIndex << ", " << backend.getDeviceVarPrefix() << "recordSpk" + n.first;
+                        if(batchSize > 1) {
+                            runner << " + (" << (v.second.groupIndex % batchSize) << " * numWords)";
+                        }
+                        runner << ");" << std::endl;
                     }
                 }
 
@@ -1327,14 +1814,18 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 // **YUCK** maybe this should be renamed genDynamicArray
                 if(n.second.isSpikeEventRecordingEnabled()) {
                     CodeStream::Scope b(runner);
-                    backend.genExtraGlobalParamAllocation(runner, "uint32_t*", "recordSpkEvent" + n.first, VarLocation::HOST_DEVICE, "numWords");
+                    backend.genExtraGlobalParamAllocation(runner, "uint32_t*", "recordSpkEvent" + n.first, VarLocation::HOST_DEVICE, numBatchWords);
 
                     // Get destinations in merged structures, this EGP 
                     // needs to be copied to and call push function
                     const auto &mergedDestinations = modelMerged.getMergedEGPDestinations("recordSpkEvent" + n.first, backend);
                     for(const auto &v : mergedDestinations) {
                         runner << "pushMerged" << v.first << v.second.mergedGroupIndex << v.second.fieldName << "ToDevice(";
-                        runner << v.second.groupIndex << ", " << backend.getDeviceVarPrefix() << "recordSpkEvent" + n.first << ");" << std::endl;
+                        runner << v.second.groupIndex << ", " << backend.getDeviceVarPrefix() << "recordSpkEvent" + n.first;
+                        if(batchSize > 1) {
+                            runner << " + (" << (v.second.groupIndex % batchSize) << " * numWords)";
+                        }
+                        runner << ");" << std::endl;
                     }
                 }
             }
@@ -1366,13 +1857,13 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 // **YUCK** maybe this should be renamed pullDynamicArray
                 if(n.second.isSpikeRecordingEnabled()) {
                     CodeStream::Scope b(runner);
-                    backend.genExtraGlobalParamPull(runner, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE, "numWords");
+                    backend.genExtraGlobalParamPull(runner, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE, numBatchWords);
                 }
                 // AllocaPullte spike event array if required
                 // **YUCK** maybe this should be renamed pullDynamicArray
                 if(n.second.isSpikeEventRecordingEnabled()) {
                     CodeStream::Scope b(runner);
-                    backend.genExtraGlobalParamPull(runner, "uint32_t*", "recordSpkEvent" + n.first, VarLocation::HOST_DEVICE, "numWords");
+                    backend.genExtraGlobalParamPull(runner, "uint32_t*", "recordSpkEvent" + n.first, VarLocation::HOST_DEVICE, numBatchWords);
                 }
             }
         }
@@ -1421,6 +1912,16 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     }
     runner << std::endl;
 
+    // ------------------------------------------------------------------------
+    // Functions to save and restore all state
+    if(model.isCheckpointingEnabled()) {
+        genCheckpoint(runner, modelMerged, backend, checkpointVars, backend.isGlobalHostRNGRequired(modelMerged));
+    }
+
+    // ------------------------------------------------------------------------
+    // Functions to cache results of sparse connectivity initialisation
+    genConnectivityCache(runner, modelMerged, backend, checkpointVars);
+
     // ------------------------------------------------------------------------
     // Function to free all global memory structures
     runner << "void stepTime()";
@@ -1463,6 +1964,26 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     }
     runner << std::endl;
 
+    // ------------------------------------------------------------------------
+    // Function to advance several timesteps without returning to the caller
+    runner << "void stepTimeN(unsigned long long n, void (*callback)(unsigned long long), unsigned long long interval)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "for(unsigned long long i = 1; i <= n; i++)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "stepTime();" << std::endl;
+
+            // If a callback is provided, call it with current timestep every interval steps
+            runner << "if(callback != nullptr && interval != 0 && (i % interval) == 0)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "callback(iT);" << std::endl;
+            }
+        }
+    }
+    runner << std::endl;
+
     // Write variable and function definitions to header
     definitions << definitionsVarStream.str();
     definitions << definitionsFuncStream.str();
@@ -1488,6 +2009,13 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "EXPORT_FUNC void freeMem();" << std::endl;
     definitions << "EXPORT_FUNC size_t getFreeDeviceMemBytes();" << std::endl;
     definitions << "EXPORT_FUNC void stepTime();" << std::endl;
+    definitions << "EXPORT_FUNC void stepTimeN(unsigned long long n, void (*callback)(unsigned long long) = nullptr, unsigned long long interval = 0);" << std::endl;
+    if(model.isCheckpointingEnabled()) {
+        definitions << "EXPORT_FUNC void saveCheckpoint(const char *filename);" << std::endl;
+        definitions << "EXPORT_FUNC void loadCheckpoint(const char *filename);" << std::endl;
+    }
+    definitions << "EXPORT_FUNC bool loadConnectivityCache(const char *directory);" << std::endl;
+    definitions << "EXPORT_FUNC void saveConnectivityCache(const char *directory);" << std::endl;
     definitions << std::endl;
     definitions << "// Functions generated by backend" << std::endl;
     definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t";
@@ -46,9 +46,29 @@ void applySynapseSubstitutions(CodeStream &os, std::string code, const std::stri
                                        "[" + delayedPostIdx + "]");
 
     // If weights are individual, substitute variables for values stored in global memory
+    Models::Base::VarVec reducedPrecisionVars;
     if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        synapseSubs.addVarNameSubstitution(wu->getVars(), "", "group->",
+        // Split variables into those which can be accessed directly and those stored using reduced precision types
+        Models::Base::VarVec directVars;
+        for(const auto &v : wu->getVars()) {
+            if(Utils::isTypeReducedPrecision(v.type)) {
+                reducedPrecisionVars.push_back(v);
+            }
+            else {
+                directVars.push_back(v);
+            }
+        }
+        synapseSubs.addVarNameSubstitution(directVars, "", "group->",
                                            "[" + synapseSubs["id_syn"] + "]");
+
+        // If there are any reduced precision variables, open scope and load them into local scalar variables
+        if(!reducedPrecisionVars.empty()) {
+            os << "{" << std::endl;
+            for(const auto &v : reducedPrecisionVars) {
+                os << "scalar l" << v.name << " = " << getReducedPrecisionLoad(v.type, "group->" + v.name + "[" + synapseSubs["id_syn"] + "]") << ";" << std::endl;
+            }
+            synapseSubs.addVarNameSubstitution(reducedPrecisionVars, "", "l");
+        }
     }
     // Otherwise, if weights are procedual
     else if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
@@ -140,6 +160,17 @@ void applySynapseSubstitutions(CodeStream &os, std::string code, const std::stri
     //synapseSubs.applyCheckUnreplaced(code, errorContext + " : " + sg.getName());
     code = ensureFtype(code, model.getPrecision());
     os << code;
+
+    // If there are any reduced precision variables, convert any which are read-write back and close scope
+    if(!reducedPrecisionVars.empty()) {
+        os << std::endl;
+        for(const auto &v : reducedPrecisionVars) {
+            if(v.access == VarAccess::READ_WRITE) {
+                os << "group->" << v.name << "[" << synapseSubs["id_syn"] << "] = " << getReducedPrecisionStore(v.type, "l" + v.name) << ";" << std::endl;
+            }
+        }
+        os << "}" << std::endl;
+    }
 }
 }   // Anonymous namespace
 
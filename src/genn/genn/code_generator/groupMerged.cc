@@ -76,12 +76,14 @@ void CodeGenerator::NeuronSpikeQueueUpdateGroupMerged::genMergedGroupSpikeCountR
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronGroupMergedBase::isParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getParams(); });
+    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getParams(); },
+                                     [](const NeuronGroupInternal &ng) { return ng.getBatchParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronGroupMergedBase::isDerivedParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getDerivedParams(); });
+    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getDerivedParams(); },
+                                     [](const NeuronGroupInternal &ng) { return ng.getBatchDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronGroupMergedBase::isVarInitParamHeterogeneous(size_t varIndex, size_t paramIndex) const
@@ -231,6 +233,11 @@ CodeGenerator::NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const
     addPointerField("unsigned int", "spkCnt", backend.getDeviceVarPrefix() + "glbSpkCnt");
     addPointerField("unsigned int", "spk", backend.getDeviceVarPrefix() + "glbSpk");
 
+    // If per-group timing is enabled, add pointer to this group's timers
+    if(backend.isGroupTimingEnabled()) {
+        addPointerField("double", "groupTime", init ? "neuronInitTime" : "neuronUpdateTime");
+    }
+
     if(getArchetype().isSpikeEventRequired()) {
         addPointerField("unsigned int", "spkCntEvnt", backend.getDeviceVarPrefix() + "glbSpkCntEvnt");
         addPointerField("unsigned int", "spkEvnt", backend.getDeviceVarPrefix() + "glbSpkEvnt");
@@ -298,12 +305,14 @@ CodeGenerator::NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const
         addHeterogeneousParams<NeuronGroupMergedBase>(
             getArchetype().getNeuronModel()->getParamNames(), "",
             [](const NeuronGroupInternal &ng) { return ng.getParams(); },
+            [](const NeuronGroupInternal &ng) { return ng.getBatchParams(); },
             &NeuronGroupMergedBase::isParamHeterogeneous);
 
         // Add heterogeneous neuron model derived parameters
         addHeterogeneousDerivedParams<NeuronGroupMergedBase>(
             getArchetype().getNeuronModel()->getDerivedParams(), "",
             [](const NeuronGroupInternal &ng) { return ng.getDerivedParams(); },
+            [](const NeuronGroupInternal &ng) { return ng.getBatchDerivedParams(); },
             &NeuronGroupMergedBase::isDerivedParamHeterogeneous);
     }
 
@@ -593,7 +602,8 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMParamHeterogeneous(size_t
     const auto *wum = getArchetype().getInSynWithPostCode().at(childIndex)->getWUModel();
     const std::string paramName = wum->getParamNames().at(paramIndex);
     return isChildParamValueHeterogeneous({wum->getPostSpikeCode(), wum->getPostDynamicsCode()}, paramName, childIndex, paramIndex, m_SortedInSynWithPostCode,
-                                          [](const SynapseGroupInternal *s) { return s->getWUParams(); });
+                                          [](const SynapseGroupInternal *s) { return s->getWUParams(); },
+                                          [](const SynapseGroupInternal *s) { return s->getWUBatchParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -602,7 +612,8 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMDerivedParamHeterogeneous
     const auto *wum = getArchetype().getInSynWithPostCode().at(childIndex)->getWUModel();
     const std::string derivedParamName = wum->getDerivedParams().at(paramIndex).name;
     return isChildParamValueHeterogeneous({wum->getPostSpikeCode(), wum->getPostDynamicsCode()}, derivedParamName, childIndex, paramIndex, m_SortedInSynWithPostCode,
-                                          [](const SynapseGroupInternal *s) { return s->getWUDerivedParams(); });
+                                          [](const SynapseGroupInternal *s) { return s->getWUDerivedParams(); },
+                                          [](const SynapseGroupInternal *s) { return s->getWUBatchDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -611,7 +622,8 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMParamHeterogeneous(size_
     const auto *wum = getArchetype().getOutSynWithPreCode().at(childIndex)->getWUModel();
     const std::string paramName = wum->getParamNames().at(paramIndex);
     return isChildParamValueHeterogeneous({wum->getPreSpikeCode(), wum->getPreDynamicsCode()}, paramName, childIndex, paramIndex, m_SortedOutSynWithPreCode,
-                                          [](const SynapseGroupInternal *s) { return s->getWUParams(); });
+                                          [](const SynapseGroupInternal *s) { return s->getWUParams(); },
+                                          [](const SynapseGroupInternal *s) { return s->getWUBatchParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -620,7 +632,8 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMDerivedParamHeterogeneou
     const auto *wum = getArchetype().getOutSynWithPreCode().at(childIndex)->getWUModel();
     const std::string derivedParamName = wum->getDerivedParams().at(paramIndex).name;
     return isChildParamValueHeterogeneous({wum->getPreSpikeCode(), wum->getPreDynamicsCode()}, derivedParamName, childIndex, paramIndex, m_SortedOutSynWithPreCode,
-                                          [](const SynapseGroupInternal *s) { return s->getWUDerivedParams(); });
+                                          [](const SynapseGroupInternal *s) { return s->getWUDerivedParams(); },
+                                          [](const SynapseGroupInternal *s) { return s->getWUBatchDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 void CodeGenerator::NeuronUpdateGroupMerged::generateWUVar(const BackendBase &backend,  const std::string &fieldPrefixStem, 
@@ -651,14 +664,16 @@ void CodeGenerator::NeuronUpdateGroupMerged::generateWUVar(const BackendBase &ba
         addHeterogeneousChildParams<NeuronUpdateGroupMerged>(sg->getWUModel()->getParamNames(), i, fieldPrefixStem, isParamHeterogeneous,
                                                              [&sortedSyn](size_t groupIndex, size_t childIndex, size_t paramIndex)
                                                              {
-                                                                 return sortedSyn.at(groupIndex).at(childIndex)->getWUParams().at(paramIndex);
+                                                                 const auto *sg = sortedSyn.at(groupIndex).at(childIndex);
+                                                                 return getInstanceParamValues(sg->getWUParams(), sg->getWUBatchParams(), groupIndex).at(paramIndex);
                                                              });
 
         // Add any heterogeneous derived parameters
         addHeterogeneousChildDerivedParams<NeuronUpdateGroupMerged>(sg->getWUModel()->getDerivedParams(), i, fieldPrefixStem, isDerivedParamHeterogeneous,
                                                                     [&sortedSyn](size_t groupIndex, size_t childIndex, size_t paramIndex)
                                                                     {
-                                                                        return sortedSyn.at(groupIndex).at(childIndex)->getWUDerivedParams().at(paramIndex);
+                                                                        const auto *sg = sortedSyn.at(groupIndex).at(childIndex);
+                                                                        return getInstanceParamValues(sg->getWUDerivedParams(), sg->getWUBatchDerivedParams(), groupIndex).at(paramIndex);
                                                                     });
 
         // Add EGPs
@@ -945,7 +960,8 @@ bool CodeGenerator::SynapseGroupMergedBase::isWUParamHeterogeneous(size_t paramI
     const auto *wum = getArchetype().getWUModel();
     const std::string paramName = wum->getParamNames().at(paramIndex);
     return isParamValueHeterogeneous({getArchetypeCode()}, paramName, paramIndex,
-                                     [](const SynapseGroupInternal &sg) { return sg.getWUParams(); });
+                                     [](const SynapseGroupInternal &sg) { return sg.getWUParams(); },
+                                     [](const SynapseGroupInternal &sg) { return sg.getWUBatchParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isWUDerivedParamHeterogeneous(size_t paramIndex) const
@@ -953,7 +969,8 @@ bool CodeGenerator::SynapseGroupMergedBase::isWUDerivedParamHeterogeneous(size_t
     const auto *wum = getArchetype().getWUModel();
     const std::string derivedParamName = wum->getDerivedParams().at(paramIndex).name;
     return isParamValueHeterogeneous({getArchetypeCode()}, derivedParamName, paramIndex,
-                                     [](const SynapseGroupInternal &sg) { return sg.getWUDerivedParams(); });
+                                     [](const SynapseGroupInternal &sg) { return sg.getWUDerivedParams(); },
+                                     [](const SynapseGroupInternal &sg) { return sg.getWUBatchDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isWUGlobalVarHeterogeneous(size_t varIndex) const
@@ -1036,7 +1053,8 @@ bool CodeGenerator::SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous(size_t
     const auto *neuronModel = getArchetype().getSrcNeuronGroup()->getNeuronModel();
     const std::string paramName = neuronModel->getParamNames().at(paramIndex) + "_pre";
     return isParamValueHeterogeneous({getArchetypeCode()}, paramName, paramIndex,
-                                     [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); });
+                                     [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); },
+                                     [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getBatchParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous(size_t paramIndex) const
@@ -1044,7 +1062,8 @@ bool CodeGenerator::SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous
     const auto *neuronModel = getArchetype().getSrcNeuronGroup()->getNeuronModel();
     const std::string derivedParamName = neuronModel->getDerivedParams().at(paramIndex).name + "_pre";
     return isParamValueHeterogeneous({getArchetypeCode()}, derivedParamName, paramIndex,
-                                     [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getDerivedParams(); });
+                                     [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getDerivedParams(); },
+                                     [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getBatchDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous(size_t paramIndex) const
@@ -1052,7 +1071,8 @@ bool CodeGenerator::SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous(size_t
     const auto *neuronModel = getArchetype().getTrgNeuronGroup()->getNeuronModel();
     const std::string paramName = neuronModel->getParamNames().at(paramIndex) + "_post";
     return isParamValueHeterogeneous({getArchetypeCode()}, paramName, paramIndex,
-                                     [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); });
+                                     [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); },
+                                     [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getBatchParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous(size_t paramIndex) const
@@ -1060,7 +1080,8 @@ bool CodeGenerator::SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous
     const auto *neuronModel = getArchetype().getTrgNeuronGroup()->getNeuronModel();
     const std::string derivedParamName = neuronModel->getDerivedParams().at(paramIndex).name + "_post";
     return isParamValueHeterogeneous({getArchetypeCode()}, derivedParamName, paramIndex,
-                                     [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getDerivedParams(); });
+                                     [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getDerivedParams(); },
+                                     [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getBatchDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isKernelSizeHeterogeneous(size_t dimensionIndex) const
@@ -1097,6 +1118,24 @@ CodeGenerator::SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, cons
     addField("unsigned int", "numTrgNeurons",
              [](const SynapseGroupInternal &sg, size_t) { return std::to_string(sg.getTrgNeuronGroup()->getNumNeurons()); });
 
+    // If per-group timing is enabled, add pointer to this group's timers for this role
+    if(backend.isGroupTimingEnabled()) {
+        if(role == Role::PresynapticUpdate) {
+            addPointerField("double", "groupTime", "presynapticUpdateTime");
+            addPointerField("unsigned long long", "numPresynapticEvents", "numPresynapticEvents");
+            addPointerField("unsigned long long", "numSynapticEvents", "numSynapticEvents");
+        }
+        else if(role == Role::PostsynapticUpdate) {
+            addPointerField("double", "groupTime", "postsynapticUpdateTime");
+        }
+        else if(role == Role::SynapseDynamics) {
+            addPointerField("double", "groupTime", "synapseDynamicsTime");
+        }
+        else {
+            addPointerField("double", "groupTime", "synapseInitTime");
+        }
+    }
+
     // If this role is one where postsynaptic input can be provided
     if(role == Role::PresynapticUpdate || role == Role::SynapseDynamics) {
         if(getArchetype().isDendriticDelayRequired()) {
@@ -1140,24 +1179,28 @@ CodeGenerator::SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, cons
         addHeterogeneousParams<SynapseGroupMergedBase>(
             getArchetype().getSrcNeuronGroup()->getNeuronModel()->getParamNames(), "Pre",
             [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); },
+            [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getBatchParams(); },
             &SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous);
 
         // Add heterogeneous presynaptic neuron model derived parameters
         addHeterogeneousDerivedParams<SynapseGroupMergedBase>(
             getArchetype().getSrcNeuronGroup()->getNeuronModel()->getDerivedParams(), "Pre",
             [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getDerivedParams(); },
+            [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getBatchDerivedParams(); },
             &SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous);
 
         // Add heterogeneous postsynaptic neuron model parameters
         addHeterogeneousParams<SynapseGroupMergedBase>(
             getArchetype().getTrgNeuronGroup()->getNeuronModel()->getParamNames(), "Post",
             [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); },
+            [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getBatchParams(); },
             &SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous);
 
         // Add heterogeneous postsynaptic neuron model derived parameters
         addHeterogeneousDerivedParams<SynapseGroupMergedBase>(
             getArchetype().getTrgNeuronGroup()->getNeuronModel()->getDerivedParams(), "Post",
             [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getDerivedParams(); },
+            [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getBatchDerivedParams(); },
             &SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous);
 
         // Get correct code string
@@ -1228,12 +1271,14 @@ CodeGenerator::SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, cons
         addHeterogeneousParams<SynapseGroupMergedBase>(
             wum->getParamNames(), "",
             [](const SynapseGroupInternal &sg) { return sg.getWUParams(); },
+            [](const SynapseGroupInternal &sg) { return sg.getWUBatchParams(); },
             &SynapseGroupMergedBase::isWUParamHeterogeneous);
 
         // Add heterogeneous weight update model derived parameters
         addHeterogeneousDerivedParams<SynapseGroupMergedBase>(
             wum->getDerivedParams(), "",
             [](const SynapseGroupInternal &sg) { return sg.getWUDerivedParams(); },
+            [](const SynapseGroupInternal &sg) { return sg.getWUBatchDerivedParams(); },
             &SynapseGroupMergedBase::isWUDerivedParamHeterogeneous);
 
         // Add pre and postsynaptic variables to struct
@@ -1249,12 +1294,39 @@ CodeGenerator::SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, cons
         addWeightSharingPointerField("unsigned int", "rowLength", backend.getDeviceVarPrefix() + "rowLength");
         addWeightSharingPointerField(getArchetype().getSparseIndType(), "ind", backend.getDeviceVarPrefix() + "ind");
 
+        // Add additional structure for locating rows of compact connectivity
+        if(backend.isCompactSparse(getArchetype())) {
+            addWeightSharingPointerField(getArchetype().getSparseRowPtrType(), "rowPtr", backend.getDeviceVarPrefix() + "rowPtr");
+
+            // Add capacity to check connectivity being built against
+            if(role == Role::ConnectivityInit) {
+                addField(getArchetype().getSparseRowPtrType(), "maxTotalConnections",
+                         [](const SynapseGroupInternal &sg, size_t) { return std::to_string(sg.getMaxTotalConnections()); });
+            }
+        }
+
         // Add additional structure for postsynaptic access
         if(backend.isPostsynapticRemapRequired() && !wum->getLearnPostCode().empty()
            && (role == Role::PostsynapticUpdate || role == Role::SparseInit))
         {
             addWeightSharingPointerField("unsigned int", "colLength", backend.getDeviceVarPrefix() + "colLength");
-            addWeightSharingPointerField("unsigned int", "remap", backend.getDeviceVarPrefix() + "remap");
+            addWeightSharingPointerField(backend.getSparseAddressType(getArchetype()), "remap", backend.getDeviceVarPrefix() + "remap");
+
+            if(backend.isRemapPreInd(getArchetype())) {
+                addWeightSharingPointerField(getArchetype().getRemapPreIndType(), "remapPreInd", backend.getDeviceVarPrefix() + "remapPreInd");
+            }
+        }
+
+        // Add additional structure for processing connectivity in postsynaptic tiles
+        if(backend.isPostsynapticTilingSupported() && getArchetype().getPostsynapticTileSize() > 0
+           && (role == Role::PresynapticUpdate || role == Role::SparseInit))
+        {
+            addWeightSharingPointerField("unsigned int", "tileRowStart", backend.getDeviceVarPrefix() + "tileRowStart");
+        }
+
+        // Add additional structure for reading delta-encoded connectivity
+        if(backend.isDeltaSparseInd(getArchetype()) && (role == Role::PresynapticUpdate || role == Role::SparseInit)) {
+            addWeightSharingPointerField(getArchetype().getSparseIndDeltaType(), "indDelta", backend.getDeviceVarPrefix() + "indDelta");
         }
 
         // Add additional structure for synapse dynamics access
@@ -1,6 +1,7 @@
 #include "code_generator/modelSpecMerged.h"
 
 // GeNN includes
+#include "gennUtils.h"
 #include "logging.h"
 #include "modelSpecInternal.h"
 
@@ -20,27 +21,32 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     LOGD_CODE_GEN << "Merging neuron update groups:";
     createMergedGroups(model, backend, model.getNeuronGroups(), m_MergedNeuronUpdateGroups,
                        [](const NeuronGroupInternal &){ return true; },
-                       [](const NeuronGroupInternal &a, const NeuronGroupInternal &b){ return a.canBeMerged(b); });
+                       [](const NeuronGroupInternal &ng){ return ng.getHashDigest(); },
+                       [](const NeuronGroupInternal &a, const NeuronGroupInternal &b){ return a.canBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging presynaptic update groups:";
     createMergedGroups(model, backend, model.getSynapseGroups(), m_MergedPresynapticUpdateGroups,
                        [](const SynapseGroupInternal &sg){ return (sg.isSpikeEventRequired() || sg.isTrueSpikeRequired()); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); });
+                       [](const SynapseGroupInternal &sg){ return sg.getWUHashDigest(); },
+                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging postsynaptic update groups:";
     createMergedGroups(model, backend, model.getSynapseGroups(), m_MergedPostsynapticUpdateGroups,
                        [](const SynapseGroupInternal &sg){ return !sg.getWUModel()->getLearnPostCode().empty(); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); });
+                       [](const SynapseGroupInternal &sg){ return sg.getWUHashDigest(); },
+                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging synapse dynamics update groups:";
     createMergedGroups(model, backend, model.getSynapseGroups(), m_MergedSynapseDynamicsGroups,
                        [](const SynapseGroupInternal &sg){ return !sg.getWUModel()->getSynapseDynamicsCode().empty(); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); });
+                       [](const SynapseGroupInternal &sg){ return sg.getWUHashDigest(); },
+                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging neuron initialization groups:";
     createMergedGroups(model, backend, model.getNeuronGroups(), m_MergedNeuronInitGroups,
                        [](const NeuronGroupInternal &){ return true; },
-                       [](const NeuronGroupInternal &a, const NeuronGroupInternal &b){ return a.canInitBeMerged(b); });
+                       [](const NeuronGroupInternal &ng){ return ng.getInitHashDigest(); },
+                       [](const NeuronGroupInternal &a, const NeuronGroupInternal &b){ return a.canInitBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging synapse dense initialization groups:";
     createMergedGroups(model, backend, model.getSynapseGroups(), m_MergedSynapseDenseInitGroups,
@@ -48,11 +54,13 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
                        {
                            return ((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE) && sg.isWUVarInitRequired());
                        },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); });
+                       [](const SynapseGroupInternal &sg){ return sg.getWUInitHashDigest(); },
+                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging synapse connectivity initialisation groups:";
     createMergedGroups(model, backend, model.getSynapseGroups(), m_MergedSynapseConnectivityInitGroups,
                        [](const SynapseGroupInternal &sg){ return sg.isSparseConnectivityInitRequired(); },
+                       [](const SynapseGroupInternal &sg){ return sg.getConnectivityInitHashDigest(); },
                        [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canConnectivityInitBeMerged(b); });
 
     LOGD_CODE_GEN << "Merging synapse sparse initialization groups:";
@@ -62,13 +70,26 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
                            return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && 
                                    (sg.isWUVarInitRequired()
                                     || (backend.isSynRemapRequired() && !sg.getWUModel()->getSynapseDynamicsCode().empty())
-                                    || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())));
+                                    || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())
+                                    || (backend.isPostsynapticTilingSupported() && sg.getPostsynapticTileSize() > 0 && !sg.isWeightSharingSlave())
+                                    || (backend.isDeltaSparseInd(sg) && !sg.isWeightSharingSlave())));
                        },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); });
+                       [](const SynapseGroupInternal &sg){ return sg.getWUInitHashDigest(); },
+                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); }, true);
 
     LOGD_CODE_GEN << "Merging neuron groups which require their spike queues updating:";
     createMergedGroups(model, backend, model.getNeuronGroups(), m_MergedNeuronSpikeQueueUpdateGroups,
                        [](const NeuronGroupInternal &){ return true; },
+                       [](const NeuronGroupInternal &ng)
+                       {
+                           uint64_t hash = Utils::hashOffsetBasis;
+                           Utils::updateHash(ng.getNumDelaySlots(), hash);
+                           Utils::updateHash(ng.isSpikeEventRequired(), hash);
+                           Utils::updateHash(ng.isTrueSpikeRequired(), hash);
+                           Utils::updateHash(ng.isPrevSpikeTimeRequired(), hash);
+                           Utils::updateHash(ng.isPrevSpikeEventTimeRequired(), hash);
+                           return hash;
+                       },
                        [](const NeuronGroupInternal &a, const NeuronGroupInternal &b)
                        {
                            return ((a.getNumDelaySlots() == b.getNumDelaySlots())
@@ -76,7 +97,7 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
                                    && (a.isTrueSpikeRequired() == b.isTrueSpikeRequired())
                                    && (a.isPrevSpikeTimeRequired() == b.isPrevSpikeTimeRequired())
                                    && (a.isPrevSpikeEventTimeRequired() == b.isPrevSpikeEventTimeRequired()));
-                       });
+                       }, true);
 
     // Build vector of merged synapse groups which require dendritic delay
     std::vector<std::reference_wrapper<const SynapseGroupInternal>> synapseGroupsWithDendriticDelay;
@@ -89,6 +110,12 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     }
     LOGD_CODE_GEN << "Merging synapse groups which require their dendritic delay updating:";
     createMergedGroups(model, backend, synapseGroupsWithDendriticDelay, m_MergedSynapseDendriticDelayUpdateGroups,
+                       [](const SynapseGroupInternal &sg)
+                       {
+                           uint64_t hash = Utils::hashOffsetBasis;
+                           Utils::updateHash(sg.getMaxDendriticDelayTimesteps(), hash);
+                           return hash;
+                       },
                        [](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
                        {
                            return (a.getMaxDendriticDelayTimesteps() == b.getMaxDendriticDelayTimesteps());
@@ -100,6 +127,7 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
                        { 
                            return (!sg.isWeightSharingSlave() && !sg.getConnectivityInitialiser().getSnippet()->getHostInitCode().empty()); 
                        },
+                       [](const SynapseGroupInternal &sg){ return sg.getConnectivityHostInitHashDigest(); },
                        [](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
                        { 
                            return a.canConnectivityHostInitBeMerged(b); 
@@ -62,10 +62,11 @@ const std::string &CodeGenerator::Substitutions::getVarSubstitution(const std::s
 //--------------------------------------------------------------------------
 void CodeGenerator::Substitutions::apply(std::string &code) const
 {
-    // Apply function and variable substitutions
-    // **NOTE** functions may contain variables so evaluate ALL functions first
-    applyFuncs(code);
-    applyVars(code);
+    // Apply function and variable substitutions in a single pass over code
+    std::string output;
+    output.reserve(code.size());
+    applyTo(code, output);
+    code = std::move(output);
 }
 //--------------------------------------------------------------------------
 void CodeGenerator::Substitutions::applyCheckUnreplaced(std::string &code, const std::string &context) const
@@ -74,29 +75,101 @@ void CodeGenerator::Substitutions::applyCheckUnreplaced(std::string &code, const
     checkUnreplacedVariables(code, context);
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::Substitutions::applyFuncs(std::string &code) const
+void CodeGenerator::Substitutions::applyTo(const std::string &code, std::string &output) const
 {
-    // Apply function substitutions
-    for(const auto &f : m_FuncSubstitutions) {
-        functionSubstitute(code, f.first, f.second.first, f.second.second);
+    size_t copyStart = 0;
+    size_t start = code.find("$(");
+    while(start != std::string::npos) {
+        // Find end of name following opening GeNN wrapper
+        const size_t nameStart = start + 2;
+        const size_t nameEnd = code.find_first_of("(),$", nameStart);
+        if(nameEnd == std::string::npos) {
+            break;
+        }
+        const std::string name = code.substr(nameStart, nameEnd - nameStart);
+
+        // If name is followed by a comma, it may be a function call with parameters
+        if(code[nameEnd] == ',') {
+            const auto *func = findFuncSubstitution(name);
+            if(func && func->first > 0) {
+                // Parse parameters
+                std::vector<std::string> params;
+                const size_t end = parseFunctionParameters(code, nameEnd + 1, params);
+                if(params.size() != func->first) {
+                    throw std::runtime_error("Function '" + name + "' called with " + std::to_string(params.size())
+                                             + " parameters but it expects " + std::to_string(func->first));
+                }
+
+                // Copy preceding code to output followed by function template, with parameters and any
+                // functions and variables they contain substituted (by scanning expanded template)
+                output.append(code, copyStart, start - copyStart);
+                applyTo(expandFunctionTemplate(func->second, params), output);
+
+                // Continue after closing bracket
+                copyStart = end + 1;
+                start = code.find("$(", copyStart);
+                continue;
+            }
+        }
+        // Otherwise, if name is followed by a closing bracket
+        else if(code[nameEnd] == ')') {
+            // **NOTE** functions without parameters take precedence over variables
+            const auto *func = findFuncSubstitution(name);
+            const Substitutions *owner = this;
+            const std::string *replacement = (func && func->first == 0) ? &func->second : findVarSubstitution(name, owner);
+            if(replacement) {
+                LOGD_CODE_GEN << "Substituting '$(" << name << ")' for '" << *replacement << "'";
+
+                // Copy preceding code to output followed by replacement, substituting any variables
+                // it contains using the Substitutions which provided it (and their parents)
+                output.append(code, copyStart, start - copyStart);
+                if(replacement->find("$(") == std::string::npos) {
+                    output += *replacement;
+                }
+                else {
+                    owner->applyTo(*replacement, output);
+                }
+
+                // Continue after closing bracket
+                copyStart = nameEnd + 1;
+                start = code.find("$(", copyStart);
+                continue;
+            }
+        }
+
+        // Nothing to substitute so search for next opening GeNN wrapper
+        start = code.find("$(", nameStart);
     }
 
-    // If we have a parent, apply their function substitutions too
-    if(m_Parent) {
-        m_Parent->applyFuncs(code);
+    // Copy remaining code to output
+    output.append(code, copyStart, std::string::npos);
+}
+//--------------------------------------------------------------------------
+const std::string *CodeGenerator::Substitutions::findVarSubstitution(const std::string &source, const Substitutions *&owner) const
+{
+    auto var = m_VarSubstitutions.find(source);
+    if(var != m_VarSubstitutions.end()) {
+        owner = this;
+        return &var->second;
+    }
+    else if(m_Parent) {
+        return m_Parent->findVarSubstitution(source, owner);
+    }
+    else {
+        return nullptr;
     }
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::Substitutions::applyVars(std::string &code) const
+const std::pair<unsigned int, std::string> *CodeGenerator::Substitutions::findFuncSubstitution(const std::string &source) const
 {
-    // Apply variable substitutions
-    for(const auto &v : m_VarSubstitutions) {
-        LOGD_CODE_GEN << "Substituting '$(" << v.first << ")' for '" << v.second << "'";
-        substitute(code, "$(" + v.first + ")", v.second);
+    auto func = m_FuncSubstitutions.find(source);
+    if(func != m_FuncSubstitutions.end()) {
+        return &func->second;
     }
-
-    // If we have a parent, apply their variable substitutions too
-    if(m_Parent) {
-        m_Parent->applyVars(code);
+    else if(m_Parent) {
+        return m_Parent->findFuncSubstitution(source);
     }
-}
\ No newline at end of file
+    else {
+        return nullptr;
+    }
+}
@@ -94,3 +94,16 @@ bool CurrentSource::canInitBeMerged(const CurrentSource &other) const
         return false;
     }
 }
+//----------------------------------------------------------------------------
+uint64_t CurrentSource::getHashDigest() const
+{
+    return getCurrentSourceModel()->getHashDigest();
+}
+//----------------------------------------------------------------------------
+uint64_t CurrentSource::getInitHashDigest() const
+{
+    // **NOTE** updating hash with vector includes number of variables
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getVarInitialisers(), hash);
+    return hash;
+}
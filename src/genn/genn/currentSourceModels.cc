@@ -13,3 +13,12 @@ bool CurrentSourceModels::Base::canBeMerged(const Base *other) const
     return (Models::Base::canBeMerged(other)
             && (getInjectionCode() == other->getInjectionCode()));
 }
+//----------------------------------------------------------------------------
+uint64_t CurrentSourceModels::Base::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getInjectionCode(), hash);
+    return hash;
+}
@@ -73,6 +73,11 @@ bool isTypePointer(const std::string &type)
     return (type.back() == '*');
 }
 //--------------------------------------------------------------------------
+bool isTypeReducedPrecision(const std::string &type)
+{
+    return (type == "half" || type == "bfloat16");
+}
+//--------------------------------------------------------------------------
 bool isTypePointerToPointer(const std::string &type)
 {
     const size_t len = type.length();
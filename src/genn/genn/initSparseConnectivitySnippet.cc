@@ -22,3 +22,16 @@ bool InitSparseConnectivitySnippet::Base::canBeMerged(const Base *other) const
             && (getColBuildStateVars() == other->getColBuildStateVars())
             && (getHostInitCode() == other->getHostInitCode()));
 }
+//----------------------------------------------------------------------------
+uint64_t InitSparseConnectivitySnippet::Base::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Snippet::Base::updateHash(hash);
+    Utils::updateHash(getRowBuildCode(), hash);
+    Utils::updateHash(getRowBuildStateVars(), hash);
+    Utils::updateHash(getColBuildCode(), hash);
+    Utils::updateHash(getColBuildStateVars(), hash);
+    Utils::updateHash(getHostInitCode(), hash);
+    return hash;
+}
@@ -20,6 +20,15 @@ bool InitVarSnippet::Base::canBeMerged(const Base *other) const
             && (getCode() == other->getCode()));
 }
 //----------------------------------------------------------------------------
+uint64_t InitVarSnippet::Base::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Snippet::Base::updateHash(hash);
+    Utils::updateHash(getCode(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
 bool InitVarSnippet::Base::requiresKernel() const
 {
     return (getCode().find("$(id_kernel)") != std::string::npos);
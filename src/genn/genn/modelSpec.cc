@@ -29,15 +29,27 @@
 #include "code_generator/codeGenUtils.h"
 #include "code_generator/substitutions.h"
 
+// ------------------------------------------------------------------------
+// Anonymous namespace
+// ------------------------------------------------------------------------
+namespace
+{
+bool isReducedPrecisionRequired(const Models::Base::VarVec &vars)
+{
+    return std::any_of(vars.cbegin(), vars.cend(),
+                       [](const Models::Base::Var &v){ return Utils::isTypeReducedPrecision(v.type); });
+}
+}   // Anonymous namespace
+
 // ------------------------------------------------------------------------
 // ModelSpec
 // ------------------------------------------------------------------------
 // class ModelSpec for specifying a neuronal network model
 ModelSpec::ModelSpec()
-:   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_Seed(0),
+:   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_CheckpointingEnabled(false), m_Seed(0),
     m_DefaultVarLocation(VarLocation::HOST_DEVICE), m_DefaultExtraGlobalParamLocation(VarLocation::HOST_DEVICE),
     m_DefaultSparseConnectivityLocation(VarLocation::HOST_DEVICE), m_DefaultNarrowSparseIndEnabled(false),
-    m_ShouldMergePostsynapticModels(false)
+    m_ShouldMergePostsynapticModels(false), m_BatchSize(1)
 {
     setPrecision(GENN_FLOAT);
 }
@@ -122,13 +134,25 @@ void ModelSpec::setPrecision(FloatType floattype /**<  */)
     }
 }
 
+void ModelSpec::setBatchSize(unsigned int batchSize)
+{
+    if(batchSize == 0) {
+        throw std::runtime_error("Batch size must be at least 1.");
+    }
+    m_BatchSize = batchSize;
+}
 
 void ModelSpec::finalize()
 {
     // NEURON GROUPS
     for(auto &n : m_LocalNeuronGroups) {
         // Initialize derived parameters
-        n.second.initDerivedParams(m_DT);
+        n.second.initDerivedParams(m_DT, m_BatchSize);
+
+        // Only per-synapse variables can be stored using reduced precision types
+        if(isReducedPrecisionRequired(n.second.getNeuronModel()->getVars())) {
+            throw std::runtime_error("Neuron group '" + n.first + "' has variables with reduced precision types which are only supported for weight update model variables");
+        }
     }
 
     // SYNAPSE groups
@@ -136,7 +160,26 @@ void ModelSpec::finalize()
         const auto *wu = s.second.getWUModel();
 
         // Initialize derived parameters
-        s.second.initDerivedParams(m_DT);
+        s.second.initDerivedParams(m_DT, m_BatchSize);
+
+        // Only per-synapse variables, stored individually for each synapse, can be stored using reduced precision types
+        if(isReducedPrecisionRequired(wu->getPreVars()) || isReducedPrecisionRequired(wu->getPostVars())
+           || isReducedPrecisionRequired(s.second.getPSModel()->getVars()))
+        {
+            throw std::runtime_error("Synapse group '" + s.first + "' has presynaptic, postsynaptic or postsynaptic model variables with reduced precision types which are only supported for weight update model variables");
+        }
+        if(isReducedPrecisionRequired(wu->getVars()) && !(s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+            throw std::runtime_error("Synapse group '" + s.first + "' has weight update model variables with reduced precision types which are only supported with INDIVIDUAL weights");
+        }
+
+        // Variables initialised alongside sparse connectivity using kernels are only initialised once so can't be batched
+        const auto &wuVarInitialisers = s.second.getWUVarInitialisers();
+        if(m_BatchSize > 1 && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)
+           && std::any_of(wuVarInitialisers.cbegin(), wuVarInitialisers.cend(),
+                          [](const Models::VarInit &v){ return v.getSnippet()->requiresKernel(); }))
+        {
+            throw std::runtime_error("Synapse group '" + s.first + "' has weight update model variables initialised using kernels which are not supported with a batch size greater than 1");
+        }
 
         // Mark any pre or postsyaptic neuron variables referenced in sim code as requiring queues
         if (!wu->getSimCode().empty()) {
@@ -167,6 +210,11 @@ void ModelSpec::finalize()
     for(auto &cs : m_LocalCurrentSources) {
         // Initialize derived parameters
         cs.second.initDerivedParams(m_DT);
+
+        // Only per-synapse variables can be stored using reduced precision types
+        if(isReducedPrecisionRequired(cs.second.getCurrentSourceModel()->getVars())) {
+            throw std::runtime_error("Current source '" + cs.first + "' has variables with reduced precision types which are only supported for weight update model variables");
+        }
     }
 
     // Merge incoming postsynaptic models
@@ -251,6 +299,13 @@ bool ModelSpec::isRecordingInUse() const
                        [](const NeuronGroupValueType &n) { return n.second.isRecordingEnabled(); });
 }
 
+bool ModelSpec::isReducedPrecisionInUse() const
+{
+    // **NOTE** only weight update model variables can be stored using reduced precision types
+    return std::any_of(m_LocalSynapseGroups.cbegin(), m_LocalSynapseGroups.cend(),
+                       [](const SynapseGroupValueType &s) { return isReducedPrecisionRequired(s.second.getWUModel()->getVars()); });
+}
+
 NeuronGroupInternal *ModelSpec::findNeuronGroupInternal(const std::string &name)
 {
     // If a matching local neuron group is found, return it
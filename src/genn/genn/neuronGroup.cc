@@ -3,6 +3,7 @@
 // Standard includes
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 
 // GeNN includes
 #include "currentSourceInternal.h"
@@ -44,6 +45,18 @@ bool checkCompatibleUnordered(const std::vector<T> &ours, std::vector<T> &others
         return false;
     }
 }
+//----------------------------------------------------------------------------
+template<typename T, typename D>
+void updateHashUnordered(const std::vector<T> &groups, uint64_t &hash, D getHashDigest)
+{
+    // Sort digests of groups so, like checkCompatibleUnordered, the result doesn't depend on their order
+    std::vector<uint64_t> digests;
+    digests.reserve(groups.size());
+    std::transform(groups.cbegin(), groups.cend(), std::back_inserter(digests), getHashDigest);
+    std::sort(digests.begin(), digests.end());
+
+    Utils::updateHash(digests, hash);
+}
 }   // Anonymous namespace
 
 // ------------------------------------------------------------------------
@@ -54,6 +67,16 @@ void NeuronGroup::setVarLocation(const std::string &varName, VarLocation loc)
     m_VarLocation.at(getNeuronModel()->getVarIndex(varName)) = loc;
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::setBatchParamValues(const std::string &paramName, const std::vector<double> &values)
+{
+    const auto paramNames = getNeuronModel()->getParamNames();
+    const auto param = std::find(paramNames.cbegin(), paramNames.cend(), paramName);
+    if(param == paramNames.cend()) {
+        throw std::runtime_error("Neuron group '" + getName() + "' has no parameter '" + paramName + "'");
+    }
+    m_BatchParamValues[std::distance(paramNames.cbegin(), param)] = values;
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc)
 {
     const size_t extraGlobalParamIndex = getNeuronModel()->getExtraGlobalParamIndex(paramName);
@@ -268,7 +291,7 @@ void NeuronGroup::updatePostVarQueues(const std::string &code)
     updateVarQueues(code, "_post");
 }
 //----------------------------------------------------------------------------
-void NeuronGroup::initDerivedParams(double dt)
+void NeuronGroup::initDerivedParams(double dt, unsigned int batchSize)
 {
     auto derivedParams = getNeuronModel()->getDerivedParams();
 
@@ -280,6 +303,28 @@ void NeuronGroup::initDerivedParams(double dt)
         m_DerivedParams.push_back(d.func(m_Params, dt));
     }
 
+    // If any parameters have per-instance values, build parameters of each instance
+    if(!m_BatchParamValues.empty()) {
+        m_BatchParams.assign(batchSize, m_Params);
+        for(const auto &p : m_BatchParamValues) {
+            if(p.second.size() != batchSize) {
+                throw std::runtime_error("Neuron group '" + getName() + "' has " + std::to_string(p.second.size()) + " values for parameter '"
+                                         + getNeuronModel()->getParamNames()[p.first] + "' but batch size is " + std::to_string(batchSize));
+            }
+            for(unsigned int b = 0; b < batchSize; b++) {
+                m_BatchParams[b][p.first] = p.second[b];
+            }
+        }
+
+        // Calculate derived parameters of each instance
+        m_BatchDerivedParams.resize(batchSize);
+        for(unsigned int b = 0; b < batchSize; b++) {
+            for(const auto &d : derivedParams) {
+                m_BatchDerivedParams[b].push_back(d.func(m_BatchParams[b], dt));
+            }
+        }
+    }
+
     // Initialise derived parameters for variable initialisers
     for(auto &v : m_VarInitialisers) {
         v.initDerivedParams(dt);
@@ -546,6 +591,61 @@ bool NeuronGroup::canInitBeMerged(const NeuronGroup &other) const
     return false;
 }
 //----------------------------------------------------------------------------
+uint64_t NeuronGroup::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getNeuronModel()->getHashDigest(), hash);
+    Utils::updateHash(isSpikeTimeRequired(), hash);
+    Utils::updateHash(isPrevSpikeTimeRequired(), hash);
+    Utils::updateHash(isSpikeEventRequired(), hash);
+    Utils::updateHash(isSpikeRecordingEnabled(), hash);
+    Utils::updateHash(isSpikeEventRecordingEnabled(), hash);
+    Utils::updateHash(getNumDelaySlots(), hash);
+    Utils::updateHash(m_VarQueueRequired, hash);
+
+    // **NOTE** spike event conditions are compared in set order using only their code strings
+    Utils::updateHash(getSpikeEventCondition().size(), hash);
+    for(const auto &s : getSpikeEventCondition()) {
+        Utils::updateHash(s.eventThresholdCode, hash);
+        Utils::updateHash(s.supportCode, hash);
+    }
+
+    updateHashUnordered(getCurrentSources(), hash,
+                        [](const CurrentSourceInternal *cs){ return cs->getHashDigest(); });
+    updateHashUnordered(getInSynWithPostCode(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPostHashDigest(); });
+    updateHashUnordered(getOutSynWithPreCode(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPreHashDigest(); });
+    updateHashUnordered(getMergedInSyn(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getPSHashDigest(); });
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t NeuronGroup::getInitHashDigest() const
+{
+    // Hash everything canInitBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(isSpikeTimeRequired(), hash);
+    Utils::updateHash(isPrevSpikeTimeRequired(), hash);
+    Utils::updateHash(isSpikeEventRequired(), hash);
+    Utils::updateHash(isSimRNGRequired(), hash);
+    Utils::updateHash(getNumDelaySlots(), hash);
+    Utils::updateHash(m_VarQueueRequired, hash);
+    Utils::updateHash(getNeuronModel()->getVars(), hash);
+    Utils::updateHash(getVarInitialisers(), hash);
+
+    updateHashUnordered(getCurrentSources(), hash,
+                        [](const CurrentSourceInternal *cs){ return cs->getInitHashDigest(); });
+    updateHashUnordered(getInSynWithPostVars(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPostInitHashDigest(); });
+    updateHashUnordered(getOutSynWithPreVars(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPreInitHashDigest(); });
+    updateHashUnordered(getMergedInSyn(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getPSInitHashDigest(); });
+    return hash;
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::updateVarQueues(const std::string &code, const std::string &suffix)
 {
     // Loop through variables
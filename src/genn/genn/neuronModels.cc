@@ -27,3 +27,17 @@ bool NeuronModels::Base::canBeMerged(const Base *other) const
             && (isAutoRefractoryRequired() == other->isAutoRefractoryRequired())
             && (getAdditionalInputVars() == other->getAdditionalInputVars()));
 }
+//----------------------------------------------------------------------------
+uint64_t NeuronModels::Base::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getSimCode(), hash);
+    Utils::updateHash(getThresholdConditionCode(), hash);
+    Utils::updateHash(getResetCode(), hash);
+    Utils::updateHash(getSupportCode(), hash);
+    Utils::updateHash(isAutoRefractoryRequired(), hash);
+    Utils::updateHash(getAdditionalInputVars(), hash);
+    return hash;
+}
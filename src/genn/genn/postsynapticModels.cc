@@ -16,3 +16,14 @@ bool PostsynapticModels::Base::canBeMerged(const Base *other) const
             && (getApplyInputCode() == other->getApplyInputCode())
             && (getSupportCode() == other->getSupportCode()));
 }
+//----------------------------------------------------------------------------
+uint64_t PostsynapticModels::Base::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getDecayCode(), hash);
+    Utils::updateHash(getApplyInputCode(), hash);
+    Utils::updateHash(getSupportCode(), hash);
+    return hash;
+}
@@ -61,6 +61,19 @@ void SynapseGroup::setWUPostVarLocation(const std::string &varName, VarLocation
     m_WUPostVarLocation[getWUModel()->getPostVarIndex(varName)] = loc;
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setWUBatchParamValues(const std::string &paramName, const std::vector<double> &values)
+{
+    const auto paramNames = getWUModel()->getParamNames();
+    const auto param = std::find(paramNames.cbegin(), paramNames.cend(), paramName);
+    if(param == paramNames.cend()) {
+        throw std::runtime_error("Synapse group '" + getName() + "' has no weight update model parameter '" + paramName + "'");
+    }
+    if(getWUModel()->getEventThresholdConditionCode().find("$(" + paramName + ")") != std::string::npos) {
+        throw std::runtime_error("Synapse group '" + getName() + "' weight update model parameter '" + paramName + "' is used in event threshold condition so can't be set per-instance");
+    }
+    m_WUBatchParamValues[std::distance(paramNames.cbegin(), param)] = values;
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setWUExtraGlobalParamLocation(const std::string &paramName, VarLocation loc)
 {
     const size_t extraGlobalParamIndex = getWUModel()->getExtraGlobalParamIndex(paramName);
@@ -172,6 +185,21 @@ void SynapseGroup::setNumThreadsPerSpike(unsigned int numThreadsPerSpike)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setPostsynapticTileSize(unsigned int postsynapticTileSize)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setPostsynapticTileSize: Synapse group is a weight sharing slave. Postsynaptic tile size can only be set on the master.");
+    }
+    else {
+        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            m_PostsynapticTileSize = postsynapticTileSize;
+        }
+        else {
+            throw std::runtime_error("setPostsynapticTileSize: This function can only be used on synapse groups with sparse connectivity.");
+        }
+    }
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setBackPropDelaySteps(unsigned int timesteps)
 {
     m_BackPropDelaySteps = timesteps;
@@ -194,6 +222,54 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setCompactSparseEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setCompactSparseEnabled: Synapse group is a weight sharing slave. Sparse connectivity layout can only be set on the master.");
+    }
+    else if(!(getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+        throw std::runtime_error("setCompactSparseEnabled: This function can only be used on synapse groups with sparse connectivity.");
+    }
+    else {
+        // **NOTE** row start offsets are built alongside connectivity so it must be initialised on device
+        const auto *snippet = m_ConnectivityInitialiser.getSnippet();
+        if(enabled && snippet->getRowBuildCode().empty() && snippet->getColBuildCode().empty()) {
+            throw std::runtime_error("setCompactSparseEnabled: Compact sparse connectivity must be initialised using a sparse connectivity initialisation snippet.");
+        }
+        m_CompactSparseEnabled = enabled;
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setDeltaSparseIndEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setDeltaSparseIndEnabled: Synapse group is a weight sharing slave. Sparse connectivity index encoding can only be set on the master.");
+    }
+    else {
+        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            m_DeltaSparseIndEnabled = enabled;
+        }
+        else {
+            throw std::runtime_error("setDeltaSparseIndEnabled: This function can only be used on synapse groups with sparse connectivity.");
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setRemapPreIndEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setRemapPreIndEnabled: Synapse group is a weight sharing slave. Postsynaptic remapping can only be set on the master.");
+    }
+    else {
+        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            m_RemapPreIndEnabled = enabled;
+        }
+        else {
+            throw std::runtime_error("setRemapPreIndEnabled: This function can only be used on synapse groups with sparse connectivity.");
+        }
+    }
+}
+//----------------------------------------------------------------------------
 unsigned int SynapseGroup::getMaxConnections() const
 { 
     // **NOTE** these get retrived from weight sharing master 
@@ -201,6 +277,11 @@ unsigned int SynapseGroup::getMaxConnections() const
     return isWeightSharingSlave() ? getWeightSharingMaster()->getMaxConnections() : m_MaxConnections; 
 }
 //----------------------------------------------------------------------------
+unsigned int SynapseGroup::getPostsynapticTileSize() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->getPostsynapticTileSize() : m_PostsynapticTileSize;
+}
+//----------------------------------------------------------------------------
 unsigned int SynapseGroup::getMaxSourceConnections() const
 { 
     // **NOTE** these get retrived from weight sharing master 
@@ -208,6 +289,28 @@ unsigned int SynapseGroup::getMaxSourceConnections() const
     return isWeightSharingSlave() ? getWeightSharingMaster()->getMaxSourceConnections() : m_MaxSourceConnections;
 }
 //----------------------------------------------------------------------------
+size_t SynapseGroup::getMaxTotalConnections() const
+{
+    if(isWeightSharingSlave()) {
+        return getWeightSharingMaster()->getMaxTotalConnections();
+    }
+    else {
+        // **NOTE** this is calculated on demand as max connections can be set AFTER creation of synapse group
+        const size_t paddedSize = (size_t)getSrcNeuronGroup()->getNumNeurons() * (size_t)getMaxConnections();
+
+        // If connectivity initialisation snippet provides a function to calculate total length, call it
+        auto calcMaxTotalLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxTotalLengthFunc();
+        if(calcMaxTotalLengthFunc) {
+            return std::min(paddedSize, calcMaxTotalLengthFunc(getSrcNeuronGroup()->getNumNeurons(), getTrgNeuronGroup()->getNumNeurons(),
+                                                               m_ConnectivityInitialiser.getParams()));
+        }
+        // Otherwise, no more synapses than padded connectivity can be created
+        else {
+            return paddedSize;
+        }
+    }
+}
+//----------------------------------------------------------------------------
 VarLocation SynapseGroup::getSparseConnectivityLocation() const
 { 
     return isWeightSharingSlave() ? getWeightSharingMaster()->getSparseConnectivityLocation() : m_SparseConnectivityLocation;
@@ -427,9 +530,9 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
                            const InitSparseConnectivitySnippet::Init &connectivityInitialiser,
                            VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation,
                            VarLocation defaultSparseConnectivityLocation, bool defaultNarrowSparseIndEnabled)
-    :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
+    :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_PostsynapticTileSize(0), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
         m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup), m_WeightSharingMaster(weightSharingMaster),
-        m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
+        m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled), m_CompactSparseEnabled(false), m_DeltaSparseIndEnabled(false), m_RemapPreIndEnabled(false),
         m_InSynLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
         m_WUModel(wu), m_WUParams(wuParams), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
         m_PSModel(ps), m_PSParams(psParams), m_PSVarInitialisers(psVarInitialisers),
@@ -519,7 +622,7 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
     srcNeuronGroup->checkNumDelaySlots(delaySteps);
 }
 //----------------------------------------------------------------------------
-void SynapseGroup::initDerivedParams(double dt)
+void SynapseGroup::initDerivedParams(double dt, unsigned int batchSize)
 {
     auto wuDerivedParams = getWUModel()->getDerivedParams();
     auto psDerivedParams = getPSModel()->getDerivedParams();
@@ -538,6 +641,39 @@ void SynapseGroup::initDerivedParams(double dt)
         m_PSDerivedParams.push_back(d.func(m_PSParams, dt));
     }
 
+    // If any WU parameters have per-instance values, build WU parameters of each instance
+    if(!m_WUBatchParamValues.empty()) {
+        m_WUBatchParams.assign(batchSize, m_WUParams);
+        for(const auto &p : m_WUBatchParamValues) {
+            if(p.second.size() != batchSize) {
+                throw std::runtime_error("Synapse group '" + getName() + "' has " + std::to_string(p.second.size()) + " values for weight update model parameter '"
+                                         + getWUModel()->getParamNames()[p.first] + "' but batch size is " + std::to_string(batchSize));
+            }
+            for(unsigned int b = 0; b < batchSize; b++) {
+                m_WUBatchParams[b][p.first] = p.second[b];
+            }
+        }
+
+        // Calculate WU derived parameters of each instance
+        m_WUBatchDerivedParams.resize(batchSize);
+        for(unsigned int b = 0; b < batchSize; b++) {
+            for(const auto &d : wuDerivedParams) {
+                m_WUBatchDerivedParams[b].push_back(d.func(m_WUBatchParams[b], dt));
+            }
+        }
+
+        // Event threshold conditions are used to merge groups so can't use derived parameters which differ between instances
+        const std::string eventThresholdCode = getWUModel()->getEventThresholdConditionCode();
+        for(size_t d = 0; d < wuDerivedParams.size(); d++) {
+            if(eventThresholdCode.find("$(" + wuDerivedParams[d].name + ")") != std::string::npos
+               && std::any_of(m_WUBatchDerivedParams.cbegin(), m_WUBatchDerivedParams.cend(),
+                              [d, this](const std::vector<double> &b){ return (b[d] != m_WUDerivedParams[d]); }))
+            {
+                throw std::runtime_error("Synapse group '" + getName() + "' weight update model derived parameter '" + wuDerivedParams[d].name + "' is used in event threshold condition so can't differ between instances");
+            }
+        }
+    }
+
     // Initialise derived parameters for WU variable initialisers
     for(auto &v : m_WUVarInitialisers) {
         v.initDerivedParams(dt);
@@ -582,6 +718,59 @@ std::string SynapseGroup::getSparseIndType() const
 
 }
 //----------------------------------------------------------------------------
+bool SynapseGroup::isCompactSparseEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isCompactSparseEnabled() : m_CompactSparseEnabled;
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isDeltaSparseIndEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isDeltaSparseIndEnabled() : m_DeltaSparseIndEnabled;
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isRemapPreIndEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isRemapPreIndEnabled() : m_RemapPreIndEnabled;
+}
+//----------------------------------------------------------------------------
+std::string SynapseGroup::getSparseIndDeltaType() const
+{
+    // If, on average, postsynaptic indices in a full row are close enough together that
+    // few deltas will exceed the range of a uint8 (which is reserved for escapes), use this type
+    const unsigned int maxConnections = std::max(1u, getMaxConnections());
+    if((getTrgNeuronGroup()->getNumNeurons() / maxConnections) < 64) {
+        return "uint8_t";
+    }
+    // Otherwise, use uint16
+    else {
+        return "uint16_t";
+    }
+}
+//----------------------------------------------------------------------------
+std::string SynapseGroup::getRemapPreIndType() const
+{
+    // If narrow sparse inds are enabled and number of source neurons can be represented using a uint16, use this type
+    if(m_NarrowSparseIndEnabled && getSrcNeuronGroup()->getNumNeurons() <= std::numeric_limits<uint16_t>::max()) {
+        return "uint16_t";
+    }
+    // Otherwise, use 32-bit int
+    else {
+        return "uint32_t";
+    }
+}
+//----------------------------------------------------------------------------
+std::string SynapseGroup::getSparseRowPtrType() const
+{
+    // If compact sparse connectivity is enabled and there may be too many synapses to address with 32-bit offsets, use 64-bit
+    if(isCompactSparseEnabled() && getMaxTotalConnections() > std::numeric_limits<uint32_t>::max()) {
+        return "uint64_t";
+    }
+    // Otherwise, use unsigned int like other sparse data structures
+    else {
+        return "unsigned int";
+    }
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::canWUBeMerged(const SynapseGroup &other) const
 {
     if(getWUModel()->canBeMerged(other.getWUModel())
@@ -592,6 +781,13 @@ bool SynapseGroup::canWUBeMerged(const SynapseGroup &other) const
        && (getNumThreadsPerSpike() == other.getNumThreadsPerSpike())
        && (isEventThresholdReTestRequired() == other.isEventThresholdReTestRequired())
        && (getSpanType() == other.getSpanType())
+       && (getPostsynapticTileSize() == other.getPostsynapticTileSize())
+       && (isCompactSparseEnabled() == other.isCompactSparseEnabled())
+       && (getSparseRowPtrType() == other.getSparseRowPtrType())
+       && (isDeltaSparseIndEnabled() == other.isDeltaSparseIndEnabled())
+       && (getSparseIndDeltaType() == other.getSparseIndDeltaType())
+       && (isRemapPreIndEnabled() == other.isRemapPreIndEnabled())
+       && (getRemapPreIndType() == other.getRemapPreIndType())
        && (isPSModelMerged() == other.isPSModelMerged())
        && (getSrcNeuronGroup()->getNumDelaySlots() == other.getSrcNeuronGroup()->getNumDelaySlots())
        && (getTrgNeuronGroup()->getNumDelaySlots() == other.getTrgNeuronGroup()->getNumDelaySlots())
@@ -665,6 +861,13 @@ bool SynapseGroup::canWUInitBeMerged(const SynapseGroup &other) const
 {
     if((getMatrixType() == other.getMatrixType())
        && (getSparseIndType() == other.getSparseIndType())
+       && (getPostsynapticTileSize() == other.getPostsynapticTileSize())
+       && (isCompactSparseEnabled() == other.isCompactSparseEnabled())
+       && (getSparseRowPtrType() == other.getSparseRowPtrType())
+       && (isDeltaSparseIndEnabled() == other.isDeltaSparseIndEnabled())
+       && (getSparseIndDeltaType() == other.getSparseIndDeltaType())
+       && (isRemapPreIndEnabled() == other.isRemapPreIndEnabled())
+       && (getRemapPreIndType() == other.getRemapPreIndType())
        && (getWUModel()->getVars() == other.getWUModel()->getVars()))
     {
         // if any of the variable's initialisers can't be merged, return false
@@ -732,7 +935,9 @@ bool SynapseGroup::canConnectivityInitBeMerged(const SynapseGroup &other) const
     // Connectivity initialization can be merged if the type of connectivity is the same and the initialisers can be merged
     return (getConnectivityInitialiser().canBeMerged(other.getConnectivityInitialiser())
             && (getSynapseMatrixConnectivity(getMatrixType()) == getSynapseMatrixConnectivity(other.getMatrixType()))
-            && (getSparseIndType() == other.getSparseIndType()));
+            && (getSparseIndType() == other.getSparseIndType())
+            && (isCompactSparseEnabled() == other.isCompactSparseEnabled())
+            && (getSparseRowPtrType() == other.getSparseRowPtrType()));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canConnectivityHostInitBeMerged(const SynapseGroup &other) const
@@ -740,3 +945,130 @@ bool SynapseGroup::canConnectivityHostInitBeMerged(const SynapseGroup &other) co
     // Connectivity host initialization can be merged if the initialisers 
     return getConnectivityInitialiser().canBeMerged(other.getConnectivityInitialiser());
 }
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getWUHashDigest() const
+{
+    // Hash everything canWUBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getWUModel()->getHashDigest(), hash);
+    Utils::updateHash(getDelaySteps(), hash);
+    Utils::updateHash(getBackPropDelaySteps(), hash);
+    Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(getNumThreadsPerSpike(), hash);
+    Utils::updateHash(isEventThresholdReTestRequired(), hash);
+    Utils::updateHash(getSpanType(), hash);
+    Utils::updateHash(getPostsynapticTileSize(), hash);
+    Utils::updateHash(isCompactSparseEnabled(), hash);
+    Utils::updateHash(getSparseRowPtrType(), hash);
+    Utils::updateHash(isDeltaSparseIndEnabled(), hash);
+    Utils::updateHash(getSparseIndDeltaType(), hash);
+    Utils::updateHash(isRemapPreIndEnabled(), hash);
+    Utils::updateHash(getRemapPreIndType(), hash);
+    Utils::updateHash(isPSModelMerged(), hash);
+    Utils::updateHash(getSrcNeuronGroup()->getNumDelaySlots(), hash);
+    Utils::updateHash(getTrgNeuronGroup()->getNumDelaySlots(), hash);
+    Utils::updateHash(getMatrixType(), hash);
+
+    // If weights are procedural, include variable initialisers
+    if(getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
+        Utils::updateHash(getWUVarInitialisers(), hash);
+    }
+
+    // If connectivity is procedural, include connectivity initialiser
+    if(getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
+        Utils::updateHash(getConnectivityInitialiser().getHashDigest(), hash);
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getWUPreHashDigest() const
+{
+    // Hash everything canWUPreBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getWUModel()->getHashDigest(), hash);
+    Utils::updateHash((getDelaySteps() != 0), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getWUPostHashDigest() const
+{
+    // Hash everything canWUPostBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getWUModel()->getHashDigest(), hash);
+    Utils::updateHash((getDelaySteps() != 0), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getPSHashDigest() const
+{
+    // Hash everything canPSBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getPSModel()->getHashDigest(), hash);
+    Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(static_cast<bool>(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getWUInitHashDigest() const
+{
+    // Hash everything canWUInitBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getMatrixType(), hash);
+    Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(getPostsynapticTileSize(), hash);
+    Utils::updateHash(isCompactSparseEnabled(), hash);
+    Utils::updateHash(getSparseRowPtrType(), hash);
+    Utils::updateHash(isDeltaSparseIndEnabled(), hash);
+    Utils::updateHash(getSparseIndDeltaType(), hash);
+    Utils::updateHash(isRemapPreIndEnabled(), hash);
+    Utils::updateHash(getRemapPreIndType(), hash);
+    Utils::updateHash(getWUModel()->getVars(), hash);
+    Utils::updateHash(getWUVarInitialisers(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getWUPreInitHashDigest() const
+{
+    // Hash everything canWUPreInitBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getWUModel()->getPreVars(), hash);
+    Utils::updateHash(getWUPreVarInitialisers(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getWUPostInitHashDigest() const
+{
+    // Hash everything canWUPostInitBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getWUModel()->getPostVars(), hash);
+    Utils::updateHash(getWUPostVarInitialisers(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getPSInitHashDigest() const
+{
+    // Hash everything canPSInitBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getPSModel()->getVars(), hash);
+    Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(getPSVarInitialisers(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getConnectivityInitHashDigest() const
+{
+    // Hash everything canConnectivityInitBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Utils::updateHash(getConnectivityInitialiser().getHashDigest(), hash);
+    Utils::updateHash(getSynapseMatrixConnectivity(getMatrixType()), hash);
+    Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isCompactSparseEnabled(), hash);
+    Utils::updateHash(getSparseRowPtrType(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+uint64_t SynapseGroup::getConnectivityHostInitHashDigest() const
+{
+    return getConnectivityInitialiser().getHashDigest();
+}
@@ -30,3 +30,29 @@ bool WeightUpdateModels::Base::canBeMerged(const Base *other) const
             && (isPrevPostSpikeTimeRequired() == other->isPrevPostSpikeTimeRequired())
             && (isPrevPreSpikeEventTimeRequired() == other->isPrevPreSpikeEventTimeRequired()));
 }
+//----------------------------------------------------------------------------
+uint64_t WeightUpdateModels::Base::getHashDigest() const
+{
+    // Hash everything canBeMerged compares
+    uint64_t hash = Utils::hashOffsetBasis;
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getSimCode(), hash);
+    Utils::updateHash(getEventCode(), hash);
+    Utils::updateHash(getLearnPostCode(), hash);
+    Utils::updateHash(getSynapseDynamicsCode(), hash);
+    Utils::updateHash(getEventThresholdConditionCode(), hash);
+    Utils::updateHash(getSimSupportCode(), hash);
+    Utils::updateHash(getLearnPostSupportCode(), hash);
+    Utils::updateHash(getSynapseDynamicsSuppportCode(), hash);
+    Utils::updateHash(getPreSpikeCode(), hash);
+    Utils::updateHash(getPostSpikeCode(), hash);
+    Utils::updateHash(getPreVars(), hash);
+    Utils::updateHash(getPostVars(), hash);
+    Utils::updateHash(isPreSpikeTimeRequired(), hash);
+    Utils::updateHash(isPostSpikeTimeRequired(), hash);
+    Utils::updateHash(isPreSpikeEventTimeRequired(), hash);
+    Utils::updateHash(isPrevPreSpikeTimeRequired(), hash);
+    Utils::updateHash(isPrevPostSpikeTimeRequired(), hash);
+    Utils::updateHash(isPrevPreSpikeEventTimeRequired(), hash);
+    return hash;
+}
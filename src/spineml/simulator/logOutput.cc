@@ -15,6 +15,9 @@
 // pugixml includes
 #include "pugixml/pugixml.hpp"
 
+// GeNN userproject includes
+#include "binaryRecording.h"
+
 // SpineML common includes
 #include "spineMLLogging.h"
 #include "spineMLUtils.h"
@@ -181,6 +184,59 @@ void SpineMLSimulator::LogOutput::AnalogueFile::record(double, unsigned long lon
     }
 }
 
+//----------------------------------------------------------------------------
+// SpineMLSimulator::LogOutput::AnalogueBinaryFile
+//----------------------------------------------------------------------------
+SpineMLSimulator::LogOutput::AnalogueBinaryFile::AnalogueBinaryFile(const pugi::xml_node &node, double dt, unsigned int popSize,
+                                                                    const filesystem::path &logPath,
+                                                                    const ModelProperty::Base *modelProperty)
+    : AnalogueBase(node, dt, modelProperty)
+{
+    // If indices are specified, allocate output buffer to match indices
+    if(!getIndices().empty()) {
+        m_OutputBuffer.resize(getIndices().size());
+    }
+
+    // Combine node target and logger names to get file title
+    const std::string target = node.attribute("target").value();
+    const std::string fileTitle = target + "_" + std::string(node.attribute("port").value());
+    const std::string absoluteFilename = (logPath / (fileTitle + "_log.gennrec")).str();
+
+    LOGD_SPINEML << "\tAnalogue binary recording log:" << absoluteFilename;
+
+    // Create writer, recording indices as column table if required
+    const unsigned int numColumns = getIndices().empty() ? popSize : (unsigned int)getIndices().size();
+    m_Writer.reset(new BinaryRecording::Writer(absoluteFilename, target, BinaryRecording::getAnalogueEncoding<scalar>(),
+                                               popSize, dt, getStartTimestep(), numColumns, getIndices()));
+}
+//----------------------------------------------------------------------------
+SpineMLSimulator::LogOutput::AnalogueBinaryFile::~AnalogueBinaryFile()
+{
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogOutput::AnalogueBinaryFile::record(double, unsigned long long timestep)
+{
+    // If we should be recording this timestep
+    if(shouldRecord(timestep)) {
+        // Pull state variable from device
+        pullModelPropertyFromDevice();
+
+        // If no indices are specified, directly write out data from model property
+        if(getIndices().empty()) {
+            m_Writer->writeAnalogue(getStateVarBegin());
+        }
+        // Otherwise, transform indexed variables into output buffer and write that
+        else {
+            std::transform(getIndices().begin(), getIndices().end(), m_OutputBuffer.begin(),
+                           [this](unsigned int i)
+                           {
+                               return getStateVarBegin()[i];
+                           });
+            m_Writer->writeAnalogue(m_OutputBuffer.data());
+        }
+    }
+}
+
 //----------------------------------------------------------------------------
 // SpineMLSimulator::LogOutput::AnalogueExternal
 //----------------------------------------------------------------------------
@@ -393,3 +449,64 @@ void SpineMLSimulator::LogOutput::Event::record(double dt, unsigned long long ti
         }
     }
 }
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::LogOutput::EventBinaryFile
+//----------------------------------------------------------------------------
+SpineMLSimulator::LogOutput::EventBinaryFile::EventBinaryFile(const pugi::xml_node &node, double dt, unsigned int popSize,
+                                                              const filesystem::path &logPath, unsigned int *spikeQueuePtr,
+                                                              unsigned int *hostSpikeCount, unsigned int *hostSpikes,
+                                                              void (*pullCurrentSpikesFunc)(void))
+    : Base(node, dt), m_PopSize(popSize), m_SpikeQueuePtr(spikeQueuePtr),
+      m_HostSpikeCount(hostSpikeCount), m_HostSpikes(hostSpikes), m_PullCurrentSpikesFunc(pullCurrentSpikesFunc)
+{
+    // If indices are specified
+    auto indices = node.attribute("indices");
+    if(indices) {
+        // Read indices into set
+        SpineMLCommon::SpineMLUtils::readCSVIndices(indices.value(),
+                                                    std::inserter(m_Indices, m_Indices.end()));
+
+        LOGD_SPINEML << "\tRecording " << m_Indices.size() << " values";
+    }
+
+    // Combine node target and logger names to get file title
+    const std::string target = node.attribute("target").value();
+    const std::string fileTitle = target + "_" + std::string(node.attribute("port").value());
+    const std::string absoluteFilename = (logPath / (fileTitle + "_log.gennrec")).str();
+
+    LOGD_SPINEML << "\tEvent binary recording log:" << absoluteFilename;
+
+    m_Writer.reset(new BinaryRecording::Writer(absoluteFilename, target, BinaryRecording::Encoding::SpikeList,
+                                               popSize, dt, getStartTimestep()));
+}
+//----------------------------------------------------------------------------
+SpineMLSimulator::LogOutput::EventBinaryFile::~EventBinaryFile()
+{
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogOutput::EventBinaryFile::record(double, unsigned long long timestep)
+{
+    // If we should be recording this timestep
+    if(shouldRecord(timestep)) {
+        // Determine current spike queue
+        const unsigned int spikeQueueIndex = (m_SpikeQueuePtr == nullptr) ? 0 : *m_SpikeQueuePtr;
+        const unsigned int spikeOffset = m_PopSize * spikeQueueIndex;
+
+        // Pull current spikes from device
+        m_PullCurrentSpikesFunc();
+
+        // If no indices are specified, directly write out spikes
+        const unsigned int spikeCount = m_HostSpikeCount[spikeQueueIndex];
+        if(m_Indices.empty()) {
+            m_Writer->writeSpikes(timestep, spikeCount, &m_HostSpikes[spikeOffset]);
+        }
+        // Otherwise, copy spikes from indexed neurons into output buffer and write that
+        else {
+            m_OutputBuffer.clear();
+            std::copy_if(&m_HostSpikes[spikeOffset], &m_HostSpikes[spikeOffset + spikeCount], std::back_inserter(m_OutputBuffer),
+                         [this](unsigned int i){ return (m_Indices.find(i) != m_Indices.end()); });
+            m_Writer->writeSpikes(timestep, (unsigned int)m_OutputBuffer.size(), m_OutputBuffer.data());
+        }
+    }
+}
@@ -56,15 +56,16 @@ namespace SpineMLSimulator
 {
 Simulator::Simulator(plog::Severity logLevel)
 :   m_ModelLibrary(nullptr), m_StepTime(nullptr), m_SimulationTime(nullptr), m_SimulationTimestep(nullptr),
-    m_DT(0.0), m_DurationMs(0.0), m_InputMs(0.0), m_SimulateMs(0.0), m_LogMs(0.0)
+    m_DT(0.0), m_DurationMs(0.0), m_BinaryLogs(false), m_InputMs(0.0), m_SimulateMs(0.0), m_LogMs(0.0)
 {
     SpineMLLogging::init(logLevel, &m_ConsoleAppender);
 }
 //----------------------------------------------------------------------------
-Simulator::Simulator(const std::string &experimentXML, const std::string &overrideOutputPath, plog::Severity logLevel)
+Simulator::Simulator(const std::string &experimentXML, const std::string &overrideOutputPath, plog::Severity logLevel,
+                     bool binaryLogs)
 : Simulator(logLevel)
 {
-    load(experimentXML, overrideOutputPath);
+    load(experimentXML, overrideOutputPath, binaryLogs);
 }
 //----------------------------------------------------------------------------
 Simulator::~Simulator()
@@ -79,8 +80,10 @@ Simulator::~Simulator()
     }
 }
 //----------------------------------------------------------------------------
-void Simulator::load(const std::string &experimentXML, const std::string &overrideOutputPath)
+void Simulator::load(const std::string &experimentXML, const std::string &overrideOutputPath, bool binaryLogs)
 {
+    m_BinaryLogs = binaryLogs;
+
     // Use filesystem library to get parent path of the network XML file
     const auto experimentPath = filesystem::path(experimentXML).make_absolute();
     const auto basePath = experimentPath.parent_path();
@@ -680,9 +683,16 @@ std::unique_ptr<LogOutput::Base> Simulator::createLogOutput(const pugi::xml_node
         std::tie(hostSpikeCount, hostSpikes, spikeQueuePtr, pushFunc, pullFunc) = getNeuronPopSpikeVars(SpineMLUtils::getSafeName(target));
 
         // Create event logger
-        return std::unique_ptr<LogOutput::Base>(new LogOutput::Event(node, getDT(), numTimeSteps, port, targetSize->second,
-                                                                     logPath, spikeQueuePtr,
-                                                                     hostSpikeCount, hostSpikes, pullFunc));
+        if(m_BinaryLogs) {
+            return std::unique_ptr<LogOutput::Base>(new LogOutput::EventBinaryFile(node, getDT(), targetSize->second,
+                                                                                   logPath, spikeQueuePtr,
+                                                                                   hostSpikeCount, hostSpikes, pullFunc));
+        }
+        else {
+            return std::unique_ptr<LogOutput::Base>(new LogOutput::Event(node, getDT(), numTimeSteps, port, targetSize->second,
+                                                                         logPath, spikeQueuePtr,
+                                                                         hostSpikeCount, hostSpikes, pullFunc));
+        }
     }
     // Otherwise we assume it's an analogue send port
     else {
@@ -692,7 +702,11 @@ std::unique_ptr<LogOutput::Base> Simulator::createLogOutput(const pugi::xml_node
             // If there is a model property object for this port return an analogue log output to read it
             auto portProperty = targetProperties->second.find(port);
             if(portProperty != targetProperties->second.end()) {
-                if(shouldLogToFile) {
+                if(shouldLogToFile && m_BinaryLogs) {
+                    return std::unique_ptr<LogOutput::Base>(new LogOutput::AnalogueBinaryFile(node, getDT(), targetSize->second,
+                                                                                              logPath, portProperty->second.get()));
+                }
+                else if(shouldLogToFile) {
                     return std::unique_ptr<LogOutput::Base>(new LogOutput::AnalogueFile(node, getDT(), numTimeSteps, port, targetSize->second,
                                                                                         logPath, portProperty->second.get()));
                 }
@@ -15,9 +15,11 @@ int main(int argc, char *argv[])
         std::string experimentFilename;
         std::string outputDirectory;
         unsigned int logLevel = plog::info;
+        bool binaryLogs = false;
 
         app.add_option("experiment,-e,--experiment", experimentFilename, "Experiment xml file")->required();
         app.add_option("output,-o,--output", outputDirectory, "Output directory for generated code");
+        app.add_flag("--binary-logs", binaryLogs, "Write logs in memory-mappable GeNN binary recording format");
         app.add_flag("--log-error{2},--log-warning{3},--log-info{4},--log-debug{5}", logLevel, "Verbosity of logging to show");
 
         CLI11_PARSE(app, argc, argv);
@@ -32,7 +34,7 @@ int main(int argc, char *argv[])
 #endif  // _WIN32
 
         // Create simulator
-        Simulator simulator(experimentFilename, outputDirectory, (plog::Severity)logLevel);
+        Simulator simulator(experimentFilename, outputDirectory, (plog::Severity)logLevel, binaryLogs);
 
         const unsigned long long numTimeSteps = simulator.calcNumTimesteps();
         LOGI_SPINEML << "Simulating for " << numTimeSteps << " " << simulator.getDT() << "ms timesteps";
@@ -87,10 +87,22 @@ void modelDefinition(NNmodel &model)
     // Enable spike recording
 	//poisson->setSpikeRecordingEnabled(true);
 
+#ifdef SPARSE
+    auto *pp = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "PP", SynapseMatrixType::SPARSE_GLOBALG, Parameters::delayTimesteps,
+        "P", "P",
+        {}, excitatoryStaticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProb));
+#ifdef DELTA_SPARSE_IND
+    pp->setDeltaSparseIndEnabled(true);
+#endif
+#else
     model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
         "PP", SynapseMatrixType::PROCEDURAL_GLOBALG, Parameters::delayTimesteps,
         "P", "P",
         {}, excitatoryStaticSynapseInit,
         {}, {},
         initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProb));
+#endif
 }
\ No newline at end of file
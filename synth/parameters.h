@@ -7,6 +7,10 @@
 // Toggle STDP
 //#define STDP
 
+// Toggle storing connectivity as SPARSE rather than PROCEDURAL and, if so, delta-encoding its indices
+//#define SPARSE
+//#define DELTA_SPARSE_IND
+
 //------------------------------------------------------------------------
 // Parameters
 //------------------------------------------------------------------------
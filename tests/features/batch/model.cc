@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------
+/*! \file batch/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes once at a per-instance time
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_VARS({{"spikeTime", "scalar", VarAccess::READ_ONLY}});
+
+    SET_THRESHOLD_CONDITION_CODE("fabs($(t) - $(spikeTime)) < 1e-5");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+//! Neuron which accumulates its input and spikes whenever it receives any
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_VARS({{"x", "scalar"}});
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+    SET_THRESHOLD_CONDITION_CODE("$(Isyn) > 0.0");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+//! Static synapse which counts postsynaptic spikes
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 0, 2, 0, 0);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"c", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+    SET_LEARN_POST_CODE("$(c) += 1.0;\n");
+};
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("batch");
+    model.setBatchSize(4);
+
+    Pre::VarValues preInit(
+        uninitialisedVar());    // 0 - spikeTime
+    Post::VarValues postInit(
+        0.0);                   // 0 - x
+    WeightUpdateModel::VarValues wumInit(
+        uninitialisedVar(),     // 0 - g
+        0.0);                   // 1 - c
+
+    model.addNeuronPopulation<Pre>("Pre", 10, {}, preInit);
+    auto *post = model.addNeuronPopulation<Post>("Post", 10, {}, postInit);
+    post->setSpikeRecordingEnabled(true);
+
+    // Connectivity is shared between instances but weights are set per-instance
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, wumInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
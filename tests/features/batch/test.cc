@@ -0,0 +1,80 @@
+//--------------------------------------------------------------------------
+/*! \file batch/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //------------------------------------------------------------------------
+    virtual void Init() override
+    {
+        // Allocate spike recording buffers
+        allocateRecordingBuffers(20);
+
+        // Loop through instances
+        for(unsigned int b = 0; b < 4; b++) {
+            // Configure each presynaptic neuron to spike at a different time in each instance
+            for(unsigned int i = 0; i < 10; i++) {
+                spikeTimePre[(b * 10) + i] = (scalar)(i + b);
+            }
+
+            // Give each instance a different weight
+            // **NOTE** one-to-one connectivity has one synapse per row
+            std::fill_n(&gSyn[b * 10], 10, (scalar)(b + 1));
+        }
+        pushPreStateToDevice();
+        pushSynStateToDevice();
+    }
+};
+
+TEST_F(SimTest, Batch)
+{
+    // Simulate 20 timesteps
+    while(iT < 20) {
+        StepGeNN();
+    }
+
+    // Copy recording data from device
+    pullRecordingBuffersFromDevice();
+
+    // Loop through instances
+    for(unsigned int b = 0; b < 4; b++) {
+        for(unsigned int i = 0; i < 10; i++) {
+            // Check postsynaptic neuron received exactly one input with this instance's weight
+            ASSERT_FLOAT_EQ(xPost[(b * 10) + i], (scalar)(b + 1));
+
+            // Check synapse has counted the single postsynaptic spike this caused
+            ASSERT_FLOAT_EQ(cSyn[(b * 10) + i], 1.0f);
+        }
+
+        // Loop through timesteps
+        for(unsigned int t = 0; t < 20; t++) {
+            // Postsynaptic neuron i spikes the timestep after presynaptic neuron i
+            uint32_t correct = 0;
+            if(t > b && t <= (b + 10)) {
+                correct |= (1 << (t - b - 1));
+            }
+
+            // Check that this matches this instance's section of the recording
+            EXPECT_EQ(recordSpkPost[(b * 20) + t], correct);
+        }
+    }
+}
@@ -0,0 +1,212 @@
+//--------------------------------------------------------------------------
+/*! \file batch_connectivity/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes and emits events on the timesteps set in per-instance bitmasks
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 4);
+
+    SET_VARS({{"spikeMask", "unsigned int", VarAccess::READ_ONLY},
+              {"eventMaskA", "unsigned int", VarAccess::READ_ONLY},
+              {"eventMaskB", "unsigned int", VarAccess::READ_ONLY},
+              {"step", "unsigned int"}});
+
+    // **NOTE** event thresholds are retested during the following timestep's synapse update so are based on this
+    SET_SIM_CODE("$(step) = (unsigned int)$(t);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("($(spikeMask) >> (unsigned int)$(t)) & 1");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+//! Neuron which accumulates its input and spikes whenever it receives any
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_VARS({{"x", "scalar"}});
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+    SET_THRESHOLD_CONDITION_CODE("$(Isyn) > 0.0");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+//! Static synapse which counts postsynaptic spikes
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 0, 2, 0, 0);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"c", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+    SET_LEARN_POST_CODE("$(c) += 1.0;\n");
+};
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// EventA
+//----------------------------------------------------------------------------
+//! Synapse driven by spike-like events on the timesteps set in eventMaskA
+class EventA : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(EventA, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}});
+
+    SET_EVENT_THRESHOLD_CONDITION_CODE("($(eventMaskA_pre) >> $(step_pre)) & 1");
+    SET_EVENT_CODE("$(addToInSyn, $(g));\n");
+};
+IMPLEMENT_MODEL(EventA);
+
+//----------------------------------------------------------------------------
+// EventB
+//----------------------------------------------------------------------------
+//! Synapse driven by spike-like events on the timesteps set in eventMaskB
+class EventB : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(EventB, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}});
+
+    SET_EVENT_THRESHOLD_CONDITION_CODE("($(eventMaskB_pre) >> $(step_pre)) & 1");
+    SET_EVENT_CODE("$(addToInSyn, $(g));\n");
+};
+IMPLEMENT_MODEL(EventB);
+
+//----------------------------------------------------------------------------
+// Continuous
+//----------------------------------------------------------------------------
+//! Synapse which adds its weight to the postsynaptic input every timestep
+class Continuous : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(Continuous, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(g));\n");
+};
+IMPLEMENT_MODEL(Continuous);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("batch_connectivity");
+    model.setBatchSize(4);
+
+    Pre::VarValues preInit(
+        uninitialisedVar(),     // 0 - spikeMask
+        uninitialisedVar(),     // 1 - eventMaskA
+        uninitialisedVar(),     // 2 - eventMaskB
+        0);                     // 3 - step
+    Post::VarValues postInit(
+        0.0);                   // 0 - x
+    WeightUpdateModel::VarValues wumInit(
+        uninitialisedVar(),     // 0 - g
+        0.0);                   // 1 - c
+    WeightUpdateModels::StaticPulse::VarValues staticInit(
+        1.0);                   // 0 - g
+    EventA::VarValues individualInit(
+        uninitialisedVar());    // 0 - g
+
+    model.addNeuronPopulation<Pre>("Pre", 16, {}, preInit);
+    model.addNeuronPopulation<Pre>("PreDelay", 16, {}, preInit);
+
+    // Give each synapse group its own postsynaptic population so inputs can be checked independently
+    for(const char *name : {"Sparse", "Dense", "Bitmask", "Procedural", "Tiled", "EventA", "EventB", "Continuous", "Delay"}) {
+        model.addNeuronPopulation<Post>(std::string("Post") + name, 16, {}, postInit);
+    }
+
+    // Sparse connectivity with per-instance weights and postsynaptic learning
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostSparse",
+        {}, wumInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    // Dense connectivity with per-instance diagonal weights
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostDense",
+        {}, individualInit,
+        {}, {});
+
+    // Bitmask and procedural connectivity with global weights
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Bitmask", SynapseMatrixType::BITMASK_GLOBALG, NO_DELAY, "Pre", "PostBitmask",
+        {}, staticInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Procedural", SynapseMatrixType::PROCEDURAL_GLOBALG, NO_DELAY, "Pre", "PostProcedural",
+        {}, staticInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    // Sparse connectivity processed in tiles of postsynaptic neurons
+    auto *tiled = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Tiled", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre", "PostTiled",
+        {}, staticInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    tiled->setPostsynapticTileSize(4);
+
+    // Spike-like events with different thresholds so each group has to retest the events of the other
+    model.addSynapsePopulation<EventA, PostsynapticModels::DeltaCurr>(
+        "EventA", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostEventA",
+        {}, individualInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    model.addSynapsePopulation<EventB, PostsynapticModels::DeltaCurr>(
+        "EventB", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostEventB",
+        {}, individualInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    // Synapse dynamics with per-instance weights
+    model.addSynapsePopulation<Continuous, PostsynapticModels::DeltaCurr>(
+        "Continuous", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostContinuous",
+        {}, individualInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    // Axonal delay, reading spikes from a delay queue shared by all instances
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Delay", SynapseMatrixType::SPARSE_INDIVIDUALG, 3, "PreDelay", "PostDelay",
+        {}, individualInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
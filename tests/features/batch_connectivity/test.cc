@@ -0,0 +1,131 @@
+//--------------------------------------------------------------------------
+/*! \file batch_connectivity/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_connectivity_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+constexpr unsigned int numInstances = 4;
+constexpr unsigned int numNeurons = 16;
+constexpr unsigned int numTimesteps = 32;
+
+// Generate a bitmask of the first 24 timesteps which partially overlaps those of other instances
+unsigned int getMask(unsigned int seed, unsigned int b, unsigned int i)
+{
+    unsigned int hash = (seed * 2654435761u) ^ (i * 40503u) ^ (b * 0x9E3779B9u);
+    hash ^= (hash >> 15);
+    hash *= 0x2C1B3C6Du;
+    hash ^= (hash >> 12);
+
+    // Silence one instance of each neuron so some rows are only processed for a subset of instances
+    return (b == (i % numInstances)) ? 0 : (hash & 0xFFFFFF);
+}
+
+unsigned int popCount(unsigned int mask)
+{
+    unsigned int count = 0;
+    for(; mask != 0; mask >>= 1) {
+        count += (mask & 1);
+    }
+    return count;
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //------------------------------------------------------------------------
+    virtual void Init() override
+    {
+        // Loop through instances
+        for(unsigned int b = 0; b < numInstances; b++) {
+            const unsigned int offset = b * numNeurons;
+            for(unsigned int i = 0; i < numNeurons; i++) {
+                spikeMaskPre[offset + i] = getMask(0, b, i);
+                eventMaskAPre[offset + i] = getMask(1, b, i);
+                eventMaskBPre[offset + i] = getMask(2, b, i);
+                spikeMaskPreDelay[offset + i] = getMask(3, b, i);
+                eventMaskAPreDelay[offset + i] = 0;
+                eventMaskBPreDelay[offset + i] = 0;
+            }
+
+            // Give each instance a different weight
+            // **NOTE** one-to-one connectivity has one synapse per row
+            const scalar weight = (scalar)(b + 1);
+            std::fill_n(&gSparse[offset], numNeurons, weight);
+            std::fill_n(&gEventA[offset], numNeurons, weight);
+            std::fill_n(&gEventB[offset], numNeurons, weight);
+            std::fill_n(&gContinuous[offset], numNeurons, weight);
+            std::fill_n(&gDelay[offset], numNeurons, weight);
+
+            // Only connect the diagonal of the dense matrix
+            scalar *gDenseInstance = &gDense[b * numNeurons * numNeurons];
+            std::fill_n(gDenseInstance, numNeurons * numNeurons, 0.0f);
+            for(unsigned int i = 0; i < numNeurons; i++) {
+                gDenseInstance[(i * numNeurons) + i] = weight;
+            }
+        }
+        pushPreStateToDevice();
+        pushPreDelayStateToDevice();
+        pushSparseStateToDevice();
+        pushDenseStateToDevice();
+        pushEventAStateToDevice();
+        pushEventBStateToDevice();
+        pushContinuousStateToDevice();
+        pushDelayStateToDevice();
+    }
+};
+
+TEST_F(SimTest, BatchConnectivity)
+{
+    // Simulate for long enough that every delayed spike arrives and every postsynaptic spike is learnt from
+    while(iT < numTimesteps) {
+        StepGeNN();
+    }
+
+    // Loop through instances
+    for(unsigned int b = 0; b < numInstances; b++) {
+        const scalar weight = (scalar)(b + 1);
+        for(unsigned int i = 0; i < numNeurons; i++) {
+            const unsigned int idx = (b * numNeurons) + i;
+            const unsigned int numSpikes = popCount(getMask(0, b, i));
+
+            // Check each postsynaptic neuron received exactly this instance's input from its presynaptic neuron
+            ASSERT_FLOAT_EQ(xPostSparse[idx], weight * numSpikes);
+            ASSERT_FLOAT_EQ(xPostDense[idx], weight * numSpikes);
+            ASSERT_FLOAT_EQ(xPostBitmask[idx], (scalar)numSpikes);
+            ASSERT_FLOAT_EQ(xPostProcedural[idx], (scalar)numSpikes);
+            ASSERT_FLOAT_EQ(xPostTiled[idx], (scalar)numSpikes);
+            ASSERT_FLOAT_EQ(xPostEventA[idx], weight * popCount(getMask(1, b, i)));
+            ASSERT_FLOAT_EQ(xPostEventB[idx], weight * popCount(getMask(2, b, i)));
+            ASSERT_FLOAT_EQ(xPostContinuous[idx], weight * numTimesteps);
+            ASSERT_FLOAT_EQ(xPostDelay[idx], weight * popCount(getMask(3, b, i)));
+
+            // Check synapse has counted each postsynaptic spike in this instance
+            ASSERT_FLOAT_EQ(cSparse[idx], (scalar)numSpikes);
+        }
+    }
+}
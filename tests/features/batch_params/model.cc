@@ -0,0 +1,123 @@
+//--------------------------------------------------------------------------
+/*! \file batch_params/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes with a parameterised period and accumulates a parameterised input
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 3, 1);
+
+    SET_PARAM_NAMES({"period", "offset", "scale"});
+    SET_DERIVED_PARAMS({{"scaleSq", [](const std::vector<double> &pars, double){ return pars[2] * pars[2]; }}});
+    SET_VARS({{"x", "scalar"}});
+
+    SET_SIM_CODE("$(x) += $(offset) + $(scaleSq);\n");
+
+    // **NOTE** only spike during the first 24 timesteps so every spike is delivered and learnt from
+    SET_THRESHOLD_CONDITION_CODE("$(t) < 24.0 && ((unsigned int)$(t) % (unsigned int)$(period)) == 0");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+//! Neuron which accumulates its input and spikes whenever it receives any
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_VARS({{"x", "scalar"}});
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+    SET_THRESHOLD_CONDITION_CODE("$(Isyn) > 0.0");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+//! Synapse which scales its weight by the presynaptic neuron's scale parameter and counts postsynaptic spikes
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 2, 1, 0, 0);
+
+    SET_PARAM_NAMES({"w", "a"});
+    SET_VARS({{"c", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(w) * $(scale_pre));\n");
+    SET_LEARN_POST_CODE("$(c) += $(a);\n");
+};
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("batch_params");
+    model.setBatchSize(4);
+
+    Pre::ParamValues preParams(
+        2.0,    // 0 - period
+        0.0,    // 1 - offset
+        3.0);   // 2 - scale
+    Pre::VarValues preInit(
+        0.0);   // 0 - x
+    Post::VarValues postInit(
+        0.0);   // 0 - x
+    WeightUpdateModel::ParamValues wumParams(
+        2.0,    // 0 - w
+        1.0);   // 1 - a
+    WeightUpdateModel::VarValues wumInit(
+        0.0);   // 0 - c
+
+    // Two groups which will be merged, one with every parameter set per-instance and one with only some
+    auto *pre = model.addNeuronPopulation<Pre>("Pre", 16, preParams, preInit);
+    pre->setBatchParamValues("period", {1.0, 2.0, 3.0, 4.0});
+    pre->setBatchParamValues("offset", {0.0, 1.0, 2.0, 3.0});
+    pre->setBatchParamValues("scale", {1.0, 2.0, 3.0, 4.0});
+    auto *preB = model.addNeuronPopulation<Pre>("PreB", 16, preParams, preInit);
+    preB->setBatchParamValues("offset", {4.0, 5.0, 6.0, 7.0});
+
+    model.addNeuronPopulation<Post>("Post", 16, {}, postInit);
+    model.addNeuronPopulation<Post>("PostB", 16, {}, postInit);
+
+    // Two synapse groups which will be merged, with per-instance weight update model parameters
+    auto *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        wumParams, wumInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    syn->setWUBatchParamValues("w", {0.5, 1.0, 1.5, 2.0});
+    syn->setWUBatchParamValues("a", {2.0, 3.0, 4.0, 5.0});
+    auto *synB = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "SynB", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "PreB", "PostB",
+        wumParams, wumInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    synB->setWUBatchParamValues("a", {6.0, 7.0, 8.0, 9.0});
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,73 @@
+//--------------------------------------------------------------------------
+/*! \file batch_params/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_params_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+constexpr unsigned int numInstances = 4;
+constexpr unsigned int numNeurons = 16;
+constexpr unsigned int numTimesteps = 32;
+
+// Count the spikes emitted by a neuron with the given period during the first 24 timesteps
+unsigned int getNumSpikes(unsigned int period)
+{
+    return (24 + period - 1) / period;
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, BatchParams)
+{
+    while(iT < numTimesteps) {
+        StepGeNN();
+    }
+
+    // Loop through instances
+    for(unsigned int b = 0; b < numInstances; b++) {
+        // Parameters of each instance, matching those set in model
+        const scalar offset = (scalar)b;
+        const scalar scale = (scalar)(b + 1);
+        const scalar w = 0.5f * (scalar)(b + 1);
+        const scalar a = (scalar)(b + 2);
+        const unsigned int numSpikes = getNumSpikes(b + 1);
+        const unsigned int numSpikesB = getNumSpikes(2);
+
+        for(unsigned int i = 0; i < numNeurons; i++) {
+            const unsigned int idx = (b * numNeurons) + i;
+
+            // Check neurons accumulated their instance's parameter and derived parameter
+            ASSERT_FLOAT_EQ(xPre[idx], (offset + (scale * scale)) * numTimesteps);
+            ASSERT_FLOAT_EQ(xPreB[idx], (offset + 4.0f + 9.0f) * numTimesteps);
+
+            // Check postsynaptic neurons received input scaled by their instance's parameters
+            ASSERT_FLOAT_EQ(xPost[idx], w * scale * numSpikes);
+            ASSERT_FLOAT_EQ(xPostB[idx], 2.0f * 3.0f * numSpikesB);
+
+            // Check synapses learnt using their instance's parameters
+            ASSERT_FLOAT_EQ(cSyn[idx], a * numSpikes);
+            ASSERT_FLOAT_EQ(cSynB[idx], (a + 4.0f) * numSpikesB);
+        }
+    }
+}
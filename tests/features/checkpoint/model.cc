@@ -0,0 +1,86 @@
+//--------------------------------------------------------------------------
+/*! \file checkpoint/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// STDPAdditive
+//----------------------------------------------------------------------------
+class STDPAdditive : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(STDPAdditive, 0, 2, 0, 0);
+
+    SET_VARS({{"g", "scalar"}, {"d", "uint8_t"}});
+    SET_EXTRA_GLOBAL_PARAMS({{"depression", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addToInSynDelay, $(g), $(d));\n"
+        "$(g) = fmax(0.0, $(g) - $(depression));\n");
+    SET_LEARN_POST_CODE("$(g) += 0.001;\n");
+
+    SET_NEEDS_PRE_SPIKE_TIME(true);
+    SET_NEEDS_POST_SPIKE_TIME(true);
+};
+IMPLEMENT_MODEL(STDPAdditive);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(0.1);
+    model.setName("checkpoint");
+    model.setCheckpointingEnabled(true);
+
+    NeuronModels::PoissonNew::ParamValues poissonParams(
+        100.0);     // 0 - rate (Hz)
+    NeuronModels::PoissonNew::VarValues poissonInit(
+        0.0);       // 0 - timeStepToSpike
+
+    NeuronModels::LIF::ParamValues lifParams(
+        0.25,   // 0 - C
+        10.0,   // 1 - TauM
+        -65.0,  // 2 - Vrest
+        -65.0,  // 3 - Vreset
+        -50.0,  // 4 - Vthresh
+        0.0,    // 5 - Ioffset
+        2.0);   // 6 - TauRefrac
+    NeuronModels::LIF::VarValues lifInit(
+        initVar<InitVarSnippet::Uniform>({-65.0, -50.0}),   // 0 - V
+        0.0);                                               // 1 - RefracTime
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1); // 0 - prob
+    STDPAdditive::VarValues stdpInit(
+        initVar<InitVarSnippet::Uniform>({0.5, 1.0}),   // 0 - g
+        3);                                             // 1 - d
+
+    PostsynapticModels::ExpCurr::ParamValues expCurrParams(
+        5.0);   // 0 - tau
+
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Pre", 100, poissonParams, poissonInit);
+    model.addNeuronPopulation<NeuronModels::LIF>("Post", 100, lifParams, lifInit);
+
+    // Synapses with both axonal and dendritic delays so spike queues and dendritic delay buffers are required
+    auto *syn = model.addSynapsePopulation<STDPAdditive, PostsynapticModels::ExpCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, 5, "Pre", "Post",
+        {}, stdpInit,
+        expCurrParams, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+    syn->setBackPropDelaySteps(2);
+    syn->setMaxDendriticDelayTimesteps(5);
+
+    model.setPrecision(GENN_FLOAT);
+}
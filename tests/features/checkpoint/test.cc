@@ -0,0 +1,90 @@
+//--------------------------------------------------------------------------
+/*! \file checkpoint/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "checkpoint_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    void Simulate(std::vector<scalar> &v, std::vector<scalar> &g, unsigned int &numSpikes)
+    {
+        numSpikes = 0;
+        for(unsigned int i = 0; i < 500; i++) {
+            StepGeNN();
+            numSpikes += spikeCount_Post;
+        }
+        pullSynStateFromDevice();
+
+        v.assign(&VPost[0], &VPost[100]);
+        g.clear();
+        for(unsigned int i = 0; i < 100; i++) {
+            g.insert(g.end(), &gSyn[i * maxRowLengthSyn], &gSyn[(i * maxRowLengthSyn) + rowLengthSyn[i]]);
+        }
+    }
+};
+
+TEST_F(SimTest, Checkpoint)
+{
+    const std::string filename = ::testing::TempDir() + "checkpoint.bin";
+
+    // Simulate for a while and save checkpoint
+    depressionSyn = 0.001f;
+    for(unsigned int i = 0; i < 500; i++) {
+        StepGeNN();
+    }
+    saveCheckpoint(filename.c_str());
+
+    // Continue simulation, recording state
+    std::vector<scalar> vReference;
+    std::vector<scalar> gReference;
+    unsigned int numSpikesReference;
+    Simulate(vReference, gReference, numSpikesReference);
+    ASSERT_GT(numSpikesReference, 0);
+
+    // Re-initialise model, restore checkpoint and check time and scalar extra global parameter are restored
+    depressionSyn = 0.0f;
+    initialize();
+    initializeSparse();
+    loadCheckpoint(filename.c_str());
+    std::remove(filename.c_str());
+    ASSERT_EQ(iT, 500);
+    ASSERT_EQ(depressionSyn, 0.001f);
+
+    // Continue simulation again and check identical results are obtained
+    std::vector<scalar> v;
+    std::vector<scalar> g;
+    unsigned int numSpikes;
+    Simulate(v, g, numSpikes);
+    ASSERT_EQ(iT, 1000);
+    ASSERT_EQ(numSpikes, numSpikesReference);
+    ASSERT_EQ(v, vReference);
+    ASSERT_EQ(g, gReference);
+}
+
+TEST_F(SimTest, CheckpointMissing)
+{
+    EXPECT_THROW(loadCheckpoint((::testing::TempDir() + "missing_checkpoint.bin").c_str()), std::runtime_error);
+}
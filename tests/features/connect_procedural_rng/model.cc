@@ -0,0 +1,73 @@
+//--------------------------------------------------------------------------
+/*! \file connect_procedural_rng/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// AlwaysSpike
+//----------------------------------------------------------------------------
+class AlwaysSpike : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(AlwaysSpike, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(AlwaysSpike);
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(0.1);
+    model.setName("connect_procedural_rng");
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1); // 0 - prob
+    InitVarSnippet::Uniform::ParamValues uniformParams(
+        1.0,    // 0 - min
+        2.0);   // 1 - max
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(
+        initVar<InitVarSnippet::Uniform>(uniformParams));   // 0 - Wij (nA)
+
+    model.addNeuronPopulation<AlwaysSpike>("Pre", 100, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 1000, {}, Neuron::VarValues(0.0));
+
+    // Both connectivity and weights are regenerated using the RNG every time a presynaptic neuron spikes
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::PROCEDURAL_PROCEDURALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,52 @@
+//--------------------------------------------------------------------------
+/*! \file connect_procedural_rng/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "connect_procedural_rng_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, ConnectProceduralRNG)
+{
+    // Spikes emitted in the first timestep are delivered in the second
+    StepGeNN();
+    StepGeNN();
+    const std::vector<scalar> firstInput(&xPost[0], &xPost[1000]);
+
+    // Every postsynaptic neuron receives input from ~10 presynaptic neurons with weights uniformly
+    // distributed between 1 and 2 so the mean input should be approximately 100 * 0.1 * 1.5
+    const double meanInput = std::accumulate(firstInput.cbegin(), firstInput.cend(), 0.0) / 1000.0;
+    EXPECT_NEAR(meanInput, 15.0, 1.0);
+    EXPECT_TRUE(std::all_of(firstInput.cbegin(), firstInput.cend(),
+                            [](scalar x) { return x >= 0.0f && x < 200.0f; }));
+
+    // As all presynaptic neurons spike every timestep and rows are regenerated
+    // identically each time, every postsynaptic neuron should receive the same input
+    for(unsigned int t = 0; t < 10; t++) {
+        StepGeNN();
+        for(unsigned int j = 0; j < 1000; j++) {
+            ASSERT_EQ(xPost[j], firstInput[j]);
+        }
+    }
+}
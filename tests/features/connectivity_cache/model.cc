@@ -0,0 +1,87 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_cache/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// STDPAdditive
+//----------------------------------------------------------------------------
+class STDPAdditive : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(STDPAdditive, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+    SET_LEARN_POST_CODE("$(g) += 0.001;\n");
+};
+IMPLEMENT_MODEL(STDPAdditive);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(0.1);
+    model.setName("connectivity_cache");
+    model.setSeed(1234);
+
+    NeuronModels::PoissonNew::ParamValues poissonParams(
+        100.0);     // 0 - rate (Hz)
+    NeuronModels::PoissonNew::VarValues poissonInit(
+        0.0);       // 0 - timeStepToSpike
+
+    NeuronModels::LIF::ParamValues lifParams(
+        0.25,   // 0 - C
+        10.0,   // 1 - TauM
+        -65.0,  // 2 - Vrest
+        -65.0,  // 3 - Vreset
+        -50.0,  // 4 - Vthresh
+        0.0,    // 5 - Ioffset
+        2.0);   // 6 - TauRefrac
+    NeuronModels::LIF::VarValues lifInit(
+        initVar<InitVarSnippet::Uniform>({-65.0, -50.0}),   // 0 - V
+        0.0);                                               // 1 - RefracTime
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1); // 0 - prob
+    STDPAdditive::VarValues stdpInit(
+        initVar<InitVarSnippet::Uniform>({0.5, 1.0}));  // 0 - g
+
+    PostsynapticModels::ExpCurr::ParamValues expCurrParams(
+        5.0);   // 0 - tau
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(
+        0.1);   // 0 - Wij (nA)
+
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Pre", 100, poissonParams, poissonInit);
+    model.addNeuronPopulation<NeuronModels::LIF>("Post", 100, lifParams, lifInit);
+
+    // Sparse synapses with randomly initialised weights and postsynaptic learning so column lengths and remapping are built
+    model.addSynapsePopulation<STDPAdditive, PostsynapticModels::ExpCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, stdpInit,
+        expCurrParams, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+    // Bitmask synapses
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynBitmask", SynapseMatrixType::BITMASK_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,182 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_cache/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+
+// Platform includes
+#ifdef _WIN32
+#include <direct.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "connectivity_cache_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //--------------------------------------------------------------------------
+    virtual void Init() override
+    {
+        // Create empty directory for cache
+        m_CacheDirectory = ::testing::TempDir() + "connectivity_cache_test";
+        RemoveCacheDirectory();
+#ifdef _WIN32
+        _mkdir(m_CacheDirectory.c_str());
+#else
+        mkdir(m_CacheDirectory.c_str(), S_IRWXU);
+#endif
+    }
+
+    virtual void TearDown() override
+    {
+        RemoveCacheDirectory();
+        SimulationTest::TearDown();
+    }
+
+    // Delete any cache files from cache directory and then the directory itself
+    void RemoveCacheDirectory()
+    {
+#ifdef _WIN32
+        WIN32_FIND_DATAA findData;
+        HANDLE find = FindFirstFileA((m_CacheDirectory + "\\*.gennconn*").c_str(), &findData);
+        if(find != INVALID_HANDLE_VALUE) {
+            do {
+                std::remove((m_CacheDirectory + "\\" + findData.cFileName).c_str());
+            } while(FindNextFileA(find, &findData));
+            FindClose(find);
+        }
+        _rmdir(m_CacheDirectory.c_str());
+#else
+        DIR *dir = opendir(m_CacheDirectory.c_str());
+        if(dir != nullptr) {
+            while(const dirent *entry = readdir(dir)) {
+                const std::string name = entry->d_name;
+                if(name != "." && name != "..") {
+                    std::remove((m_CacheDirectory + "/" + name).c_str());
+                }
+            }
+            closedir(dir);
+        }
+        rmdir(m_CacheDirectory.c_str());
+#endif
+    }
+
+    void GetState(std::vector<unsigned int> &ind, std::vector<scalar> &g, std::vector<uint32_t> &gp)
+    {
+        pullSynConnectivityFromDevice();
+        pullSynStateFromDevice();
+        pullSynBitmaskConnectivityFromDevice();
+
+        ind.clear();
+        g.clear();
+        for(unsigned int i = 0; i < 100; i++) {
+            ind.push_back(rowLengthSyn[i]);
+            ind.insert(ind.end(), &indSyn[i * maxRowLengthSyn], &indSyn[(i * maxRowLengthSyn) + rowLengthSyn[i]]);
+            g.insert(g.end(), &gSyn[i * maxRowLengthSyn], &gSyn[(i * maxRowLengthSyn) + rowLengthSyn[i]]);
+        }
+
+        // **NOTE** bitmask contains at least 100 rows of 100 bits
+        gp.assign(&gpSynBitmask[0], &gpSynBitmask[(100 * 100) / 32]);
+    }
+
+    void Simulate(std::vector<scalar> &g)
+    {
+        iT = 0;
+        t = 0.0f;
+        for(unsigned int i = 0; i < 200; i++) {
+            StepGeNN();
+        }
+
+        std::vector<unsigned int> ind;
+        std::vector<uint32_t> gp;
+        GetState(ind, g, gp);
+    }
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    std::string m_CacheDirectory;
+};
+
+TEST_F(SimTest, ConnectivityCache)
+{
+    // Get initialised connectivity and save it to cache
+    std::vector<unsigned int> indReference;
+    std::vector<scalar> gReference;
+    std::vector<uint32_t> gpReference;
+    GetState(indReference, gReference, gpReference);
+    saveConnectivityCache(m_CacheDirectory.c_str());
+
+    // Simulate, recording learnt weights
+    std::vector<scalar> gLearntReference;
+    Simulate(gLearntReference);
+    ASSERT_NE(gLearntReference, gReference);
+
+    // Clear connectivity and load cache
+    std::fill_n(rowLengthSyn, 100, 0);
+    std::fill_n(gpSynBitmask, (100 * 100) / 32, 0);
+    ASSERT_TRUE(loadConnectivityCache(m_CacheDirectory.c_str()));
+
+    // Modify a weight - if initialisation is correctly skipped, this will not be overwritten
+    gSyn[0] = 100.0f;
+
+    // Re-initialise model and check cached connectivity is used
+    initialize();
+    initializeSparse();
+    std::vector<unsigned int> ind;
+    std::vector<scalar> g;
+    std::vector<uint32_t> gp;
+    GetState(ind, g, gp);
+    ASSERT_EQ(ind, indReference);
+    ASSERT_EQ(gp, gpReference);
+    ASSERT_EQ(gSyn[0], 100.0f);
+
+    // Re-initialise model again and check weights are regenerated identically
+    initialize();
+    initializeSparse();
+    GetState(ind, g, gp);
+    ASSERT_EQ(ind, indReference);
+    ASSERT_EQ(g, gReference);
+    ASSERT_EQ(gp, gpReference);
+
+    // Re-initialise model from cache and check that simulating, which uses
+    // the cached postsynaptic remapping for learning, gives the same result
+    ASSERT_TRUE(loadConnectivityCache(m_CacheDirectory.c_str()));
+    initialize();
+    initializeSparse();
+    std::vector<scalar> gLearnt;
+    Simulate(gLearnt);
+    ASSERT_EQ(gLearnt, gLearntReference);
+}
+
+TEST_F(SimTest, ConnectivityCacheMissing)
+{
+    EXPECT_FALSE(loadConnectivityCache("missing_directory"));
+}
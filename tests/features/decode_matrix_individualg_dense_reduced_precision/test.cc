@@ -0,0 +1,107 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_individualg_dense_reduced_precision/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Standard C++ includes
+#include <type_traits>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_individualg_dense_reduced_precision_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Loop through presynaptic neurons
+        unsigned int c = 0;
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            // Set start index for this presynaptic neuron's weight matrix row
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add 1.0 otherwise 0.0
+                gSyn[c++] = floatToHalf((((i + 1) & j_value) != 0) ? 1.0f : 0.0f);
+
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, DecodeMatrixIndividualgDenseReducedPrecision)
+{
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+}
+
+TEST_F(SimTest, ReducedPrecisionConversion)
+{
+    // Check that values which can be represented exactly round-trip
+    for(float v : {0.0f, 1.0f, -2.5f, 0.333251953125f, 65504.0f, 6.103515625e-05f, 5.9604644775390625e-08f}) {
+        EXPECT_EQ(halfToFloat(floatToHalf(v)), v);
+    }
+    for(float v : {0.0f, 1.0f, -2.5f, 0.333984375f, 3.3895313892515355e+38f}) {
+        EXPECT_EQ(bfloat16ToFloat(floatToBfloat16(v)), v);
+    }
+
+    // Check rounding to nearest even
+    EXPECT_EQ(floatToHalf(1.0f + (1.0f / 2048.0f)).bits, 0x3C00);
+    EXPECT_EQ(floatToHalf(1.0f + (3.0f / 2048.0f)).bits, 0x3C02);
+    EXPECT_EQ(floatToBfloat16(1.0f + (1.0f / 256.0f)).bits, 0x3F80);
+    EXPECT_EQ(floatToBfloat16(1.0f + (3.0f / 256.0f)).bits, 0x3F82);
+
+    // Check overflow saturates to infinity
+    EXPECT_EQ(floatToHalf(65520.0f).bits, 0x7C00);
+    EXPECT_EQ(floatToHalf(-1.0e6f).bits, 0xFC00);
+
+    // Check reduced precision types can't be implicitly converted to or from float
+    static_assert(!std::is_convertible<float, half>::value, "float should not convert to half");
+    static_assert(!std::is_convertible<half, float>::value, "half should not convert to float");
+    static_assert(!std::is_convertible<float, bfloat16>::value, "float should not convert to bfloat16");
+    static_assert(!std::is_convertible<bfloat16, float>::value, "bfloat16 should not convert to float");
+}
+
+TEST_F(SimTest, ReducedPrecisionPushPull)
+{
+    // Set every weight from the host and push them
+    for(unsigned int i = 0; i < (10 * 4); i++) {
+        gSyn[i] = floatToHalf(0.5f);
+    }
+    pushgSynToDevice();
+
+    // Pull weights back and check they have been stored correctly
+    pullgSynFromDevice();
+    for(unsigned int i = 0; i < (10 * 4); i++) {
+        EXPECT_EQ(halfToFloat(gSyn[i]), 0.5f);
+    }
+
+    // Spike first presynaptic neuron and check pushed weights reach every postsynaptic neuron
+    glbSpkCntPre[0] = 1;
+    glbSpkPre[0] = 0;
+    pushPreSpikesToDevice();
+    StepGeNN();
+    for(unsigned int j = 0; j < 4; j++) {
+        EXPECT_EQ(xPost[j], 0.5f);
+    }
+}
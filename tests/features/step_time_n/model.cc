@@ -0,0 +1,47 @@
+//--------------------------------------------------------------------------
+/*! \file step_time_n/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+//! Neuron which counts the timesteps it has been simulated for
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_VARS({{"x", "scalar"}});
+
+    SET_SIM_CODE("$(x) += 1.0;\n");
+};
+IMPLEMENT_MODEL(Neuron);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("step_time_n");
+
+    Neuron::VarValues init(
+        0.0);   // 0 - x
+
+    model.addNeuronPopulation<Neuron>("Neuron", 10, {}, init);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,60 @@
+//--------------------------------------------------------------------------
+/*! \file step_time_n/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "step_time_n_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+// Timesteps and counts seen by callback
+std::vector<unsigned long long> callbackTimesteps;
+std::vector<scalar> callbackCounts;
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, StepTimeN)
+{
+    // Simulate 10 timesteps, recording state every 3 timesteps
+    stepTimeN(10,
+              [](unsigned long long timestep)
+              {
+                  pullNeuronStateFromDevice();
+                  callbackTimesteps.push_back(timestep);
+                  callbackCounts.push_back(xNeuron[0]);
+              },
+              3);
+
+    // Check callback was called after the correct timesteps and saw the state at that point
+    const std::vector<unsigned long long> correctTimesteps{3, 6, 9};
+    const std::vector<scalar> correctCounts{3.0f, 6.0f, 9.0f};
+    ASSERT_EQ(callbackTimesteps, correctTimesteps);
+    ASSERT_EQ(callbackCounts, correctCounts);
+
+    // Simulate 5 more timesteps without a callback
+    stepTimeN(5);
+    ASSERT_EQ(iT, 15);
+    ASSERT_FLOAT_EQ(t, 15.0f);
+
+    // Check every neuron was simulated for every timestep
+    pullNeuronStateFromDevice();
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_FLOAT_EQ(xNeuron[i], 15.0f);
+    }
+}
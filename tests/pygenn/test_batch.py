@@ -0,0 +1,91 @@
+import numpy as np
+import pytest
+
+from pygenn.genn_model import (GeNNModel, create_custom_neuron_class,
+                               create_custom_weight_update_class)
+
+BATCH_SIZE = 3
+NUM_NEURONS = 4
+NUM_TIMESTEPS = NUM_NEURONS + 1
+
+# Neuron which increments its state by a parameter and where neuron i spikes at timestep i
+pre_model = create_custom_neuron_class(
+    "pre",
+    param_names=["inc"],
+    var_name_types=[("x", "scalar")],
+    sim_code="$(x) += $(inc);",
+    threshold_condition_code="$(id) == (unsigned int)$(t)",
+    is_auto_refractory_required=False)
+
+# Neuron which accumulates its input
+post_model = create_custom_neuron_class(
+    "post",
+    var_name_types=[("x", "scalar")],
+    sim_code="$(x) += $(Isyn);",
+    is_auto_refractory_required=False)
+
+# Synapse which scales its weight by a parameter
+wum_model = create_custom_weight_update_class(
+    "wum",
+    param_names=["scale"],
+    var_name_types=[("g", "scalar")],
+    sim_code="$(addToInSyn, $(g) * $(scale));")
+
+
+@pytest.mark.parametrize("backend", ["SingleThreadedCPU", "MultiThreadedCPU"])
+def test_batch(tmpdir, backend):
+    model = GeNNModel("float", "test_batch", backend=backend,
+                      batch_size=BATCH_SIZE)
+    model.dT = 1.0
+    assert model.batch_size == BATCH_SIZE
+
+    pre_x = np.arange(NUM_NEURONS, dtype=np.float32)
+    pre = model.add_neuron_population("Pre", NUM_NEURONS, pre_model,
+                                      {"inc": 1.0}, {"x": pre_x})
+    pre.set_batch_param_values("inc", [1.0, 2.0, 3.0])
+    post = model.add_neuron_population("Post", NUM_NEURONS, post_model,
+                                       {}, {"x": 0.0})
+
+    # Give each instance different weights
+    weights = np.arange(BATCH_SIZE * NUM_NEURONS,
+                        dtype=np.float32).reshape((BATCH_SIZE, NUM_NEURONS))
+    syn = model.add_synapse_population(
+        "Syn", "SPARSE_INDIVIDUALG", 0, pre, post,
+        wum_model, {"scale": 1.0}, {"g": weights}, {}, {},
+        "DeltaCurr", {}, {})
+    syn.set_wu_batch_param_values("scale", [1.0, 10.0, 100.0])
+    syn.set_sparse_connections(np.arange(NUM_NEURONS), np.arange(NUM_NEURONS))
+
+    model.build(str(tmpdir))
+    model.load(str(tmpdir))
+
+    # Views of per-instance state have a row per instance
+    assert pre.vars["x"].view.shape == (BATCH_SIZE, NUM_NEURONS)
+    assert syn.vars["g"].view.shape == (BATCH_SIZE, NUM_NEURONS)
+
+    while model.timestep < NUM_TIMESTEPS:
+        model.step_time()
+
+        # Every instance of neuron i spikes at timestep i
+        pre.pull_current_spikes_from_device()
+        current_spikes = pre.current_spikes
+        assert len(current_spikes) == BATCH_SIZE
+        t = model.timestep - 1
+        for s in current_spikes:
+            np.testing.assert_array_equal(s, [t] if t < NUM_NEURONS else [])
+
+    # Check each instance of the neurons used its own parameter
+    # and that initial values were copied to every instance
+    pre.pull_var_from_device("x")
+    inc = np.asarray([1.0, 2.0, 3.0])
+    np.testing.assert_allclose(pre.vars["x"].view,
+                               pre_x + (NUM_TIMESTEPS * inc[:, np.newaxis]))
+
+    # Check each instance of the synapses used its own weights and parameter
+    post.pull_var_from_device("x")
+    scale = np.asarray([1.0, 10.0, 100.0])
+    np.testing.assert_allclose(post.vars["x"].view,
+                               weights * scale[:, np.newaxis])
+
+    syn.pull_var_from_device("g")
+    np.testing.assert_array_equal(syn.get_var_values("g"), weights)
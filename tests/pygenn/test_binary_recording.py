@@ -0,0 +1,157 @@
+import os
+import shutil
+import subprocess
+
+import numpy as np
+import pytest
+
+from pygenn import binary_recording
+
+# Program which uses the C++ writer to write one recording in each encoding
+WRITER_SOURCE = """
+#include "binaryRecording.h"
+
+int main(int, char *argv[])
+{
+    const std::string directory = argv[1];
+    {
+        BinaryRecording::Writer writer(directory + "/spike_list.bin", "Pop", BinaryRecording::Encoding::SpikeList, 100, 0.5, 10);
+        const unsigned int spikes10[] = {3, 7, 99};
+        const unsigned int spikes13[] = {0};
+        writer.writeSpikes(10, 3, spikes10);
+        writer.writeSpikes(13, 1, spikes13);
+    }
+    {
+        BinaryRecording::Writer writer(directory + "/spike_bitmask.bin", "Neurons", BinaryRecording::Encoding::SpikeBitmask, 70, 0.1);
+        const uint32_t words[6] = {0x80000001, 0x1, 0x20, 0, 0, 0x1};
+        writer.writeSpikeBitmask(words, 2);
+    }
+    {
+        BinaryRecording::Writer writer(directory + "/analogue.bin", "V", BinaryRecording::Encoding::AnalogueFloat, 100, 1.0, 5, 0, {4, 2});
+        const float values0[] = {1.0f, 2.0f};
+        const float values1[] = {3.0f, 4.0f};
+        writer.writeAnalogue(values0);
+        writer.writeAnalogue(values1);
+    }
+    {
+        BinaryRecording::Writer writer(directory + "/analogue_double.bin", "V", BinaryRecording::Encoding::AnalogueDouble, 3, 1.0, 0, 4);
+        const double values[] = {0.5, 1.5, 2.5, 3.5};
+        writer.writeAnalogue(values);
+    }
+    {
+        BinaryRecording::Writer writer(directory + "/empty.bin", "", BinaryRecording::Encoding::SpikeList, 10, 1.0);
+    }
+    return 0;
+}
+"""
+
+INCLUDE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           "..", "..", "userproject", "include")
+
+
+@pytest.fixture(scope="module")
+def recordings(tmpdir_factory):
+    compiler = os.environ.get("CXX", "c++")
+    if shutil.which(compiler) is None:
+        pytest.skip("C++ compiler required to write recordings")
+
+    # Build and run writer
+    tmpdir = tmpdir_factory.mktemp("binary_recording")
+    source = tmpdir.join("writer.cc")
+    source.write(WRITER_SOURCE)
+    writer = str(tmpdir.join("writer"))
+    subprocess.check_call([compiler, "-std=c++11", "-I", INCLUDE_DIR,
+                           str(source), "-o", writer])
+    subprocess.check_call([writer, str(tmpdir)])
+    return tmpdir
+
+
+def test_spike_list(recordings):
+    filename = str(recordings.join("spike_list.bin"))
+    rec = binary_recording.load_recording(filename)
+    assert rec.name == "Pop"
+    assert rec.encoding == binary_recording.SPIKE_LIST
+    assert rec.pop_size == 100
+    assert rec.dt == 0.5
+    assert rec.start_timestep == 10
+    assert rec.num_timesteps == 4
+    np.testing.assert_array_equal(rec.index, [0, 3, 3, 3, 4])
+    np.testing.assert_array_equal(rec.data, [3, 7, 99, 0])
+
+    times, ids = binary_recording.load_spikes(filename)
+    np.testing.assert_array_equal(times, [5.0, 5.0, 5.0, 6.5])
+    np.testing.assert_array_equal(ids, [3, 7, 99, 0])
+
+
+def test_spike_bitmask(recordings):
+    filename = str(recordings.join("spike_bitmask.bin"))
+    rec = binary_recording.load_recording(filename)
+    assert rec.name == "Neurons"
+    assert rec.encoding == binary_recording.SPIKE_BITMASK
+    assert rec.pop_size == 70
+    assert rec.num_timesteps == 2
+    assert rec.data.shape == (2, 3)
+
+    times, ids = binary_recording.load_spikes(filename)
+    np.testing.assert_allclose(times, [0.0, 0.0, 0.0, 0.0, 0.1])
+    np.testing.assert_array_equal(ids, [0, 31, 32, 69, 64])
+
+
+def test_analogue(recordings):
+    rec = binary_recording.load_recording(str(recordings.join("analogue.bin")))
+    assert rec.encoding == binary_recording.ANALOGUE_FLOAT
+    assert rec.start_timestep == 5
+    assert rec.data.dtype == np.float32
+    np.testing.assert_array_equal(rec.columns, [4, 2])
+    np.testing.assert_array_equal(rec.data, [[1.0, 2.0], [3.0, 4.0]])
+
+    rec = binary_recording.load_recording(
+        str(recordings.join("analogue_double.bin")))
+    assert rec.encoding == binary_recording.ANALOGUE_DOUBLE
+    assert rec.data.dtype == np.float64
+    np.testing.assert_array_equal(rec.columns, [0, 1, 2, 0])
+    np.testing.assert_array_equal(rec.data, [[0.5, 1.5, 2.5, 3.5]])
+
+    with pytest.raises(Exception):
+        binary_recording.load_spikes(str(recordings.join("analogue.bin")))
+
+
+def test_empty(recordings):
+    rec = binary_recording.load_recording(str(recordings.join("empty.bin")))
+    assert rec.name == ""
+    assert rec.num_timesteps == 0
+
+    times, ids = binary_recording.load_spikes(str(recordings.join("empty.bin")))
+    assert len(times) == 0
+    assert len(ids) == 0
+
+
+def test_invalid(recordings, tmpdir):
+    data = recordings.join("spike_list.bin").read_binary()
+
+    # Unsupported version
+    version_offset = binary_recording.HEADER_DTYPE.fields["version"][1]
+    filename = tmpdir.join("version.bin")
+    filename.write_binary(data[:version_offset] + b"\x02\x00\x00\x00"
+                          + data[version_offset + 4:])
+    with pytest.raises(Exception):
+        binary_recording.load_recording(str(filename))
+
+    # Not a recording
+    filename = tmpdir.join("magic.bin")
+    filename.write_binary(b"X" + data[1:])
+    with pytest.raises(Exception):
+        binary_recording.load_recording(str(filename))
+
+    # Shorter than header
+    filename = tmpdir.join("header.bin")
+    filename.write_binary(data[:binary_recording.HEADER_DTYPE.itemsize - 1])
+    with pytest.raises(Exception):
+        binary_recording.load_recording(str(filename))
+
+    # Data section truncated
+    data = recordings.join("spike_bitmask.bin").read_binary()
+    filename = tmpdir.join("truncated.bin")
+    filename.write_binary(data[:-4])
+    with pytest.raises(Exception):
+        binary_recording.load_recording(str(filename))
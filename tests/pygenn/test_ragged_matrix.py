@@ -0,0 +1,113 @@
+import numpy as np
+import pytest
+
+from pygenn.genn_wrapper import SharedLibraryModelNumpy as slm
+
+# Prime number of rows so they never divide evenly between threads
+NUM_ROWS = 37
+MAX_ROW_LENGTH = 20
+
+# Thread counts which don't divide rows evenly, including more threads than rows
+NUM_THREADS = [2, 3, 8, 64]
+
+
+def _random_row_lengths(rng):
+    row_lengths = rng.randint(0, MAX_ROW_LENGTH + 1, NUM_ROWS).astype(np.uint32)
+    row_lengths[::5] = 0
+    return row_lengths
+
+
+@pytest.mark.parametrize("num_threads", NUM_THREADS)
+@pytest.mark.parametrize("dtype", [np.uint8, np.float16, np.float32, np.float64])
+def test_compact_expand_ragged_var(num_threads, dtype):
+    rng = np.random.RandomState(1234)
+    row_lengths = _random_row_lengths(rng)
+    padded = (rng.uniform(size=NUM_ROWS * MAX_ROW_LENGTH) * 100).astype(dtype)
+    item_size = padded.dtype.itemsize
+
+    # Compact padded array using one and multiple threads
+    num_synapses = int(np.sum(row_lengths))
+    single = np.empty(num_synapses, dtype=dtype)
+    slm.compact_ragged_var(row_lengths, padded.view(np.uint8),
+                           single.view(np.uint8), MAX_ROW_LENGTH, item_size, 1)
+    multi = np.empty(num_synapses, dtype=dtype)
+    slm.compact_ragged_var(row_lengths, padded.view(np.uint8),
+                           multi.view(np.uint8), MAX_ROW_LENGTH, item_size,
+                           num_threads)
+    np.testing.assert_array_equal(multi, single)
+
+    # Check against the valid elements of each padded row
+    padded_rows = padded.reshape(NUM_ROWS, MAX_ROW_LENGTH)
+    np.testing.assert_array_equal(
+        single, np.concatenate([r[:l] for r, l in zip(padded_rows, row_lengths)]))
+
+    # Expanding compact array should restore the valid elements of each row
+    expanded = np.zeros_like(padded)
+    slm.expand_ragged_var(row_lengths, multi.view(np.uint8),
+                          expanded.view(np.uint8), MAX_ROW_LENGTH, item_size,
+                          num_threads)
+    expanded_rows = expanded.reshape(NUM_ROWS, MAX_ROW_LENGTH)
+    for r, e, l in zip(padded_rows, expanded_rows, row_lengths):
+        np.testing.assert_array_equal(e[:l], r[:l])
+        np.testing.assert_array_equal(e[l:], 0)
+
+
+@pytest.mark.parametrize("num_threads", NUM_THREADS)
+def test_get_sparse_pre_inds(num_threads):
+    rng = np.random.RandomState(1234)
+    row_lengths = _random_row_lengths(rng)
+
+    num_synapses = int(np.sum(row_lengths))
+    single = np.empty(num_synapses, dtype=np.uint32)
+    slm.get_sparse_pre_inds(row_lengths, single, 1)
+    multi = np.empty(num_synapses, dtype=np.uint32)
+    slm.get_sparse_pre_inds(row_lengths, multi, num_threads)
+
+    np.testing.assert_array_equal(multi, single)
+    np.testing.assert_array_equal(single, np.repeat(np.arange(NUM_ROWS),
+                                                    row_lengths))
+
+
+@pytest.mark.parametrize("num_threads", NUM_THREADS)
+@pytest.mark.parametrize("num_synapses", [0, 1, 1001])
+def test_sort_synapses(num_threads, num_synapses):
+    rng = np.random.RandomState(1234)
+    pre_inds = rng.randint(0, NUM_ROWS, num_synapses).astype(np.uint32)
+    post_inds = rng.randint(0, 100, num_synapses).astype(np.uint32)
+
+    # Count row lengths using one and multiple threads
+    single_row_lengths = np.empty(NUM_ROWS, dtype=np.uint32)
+    slm.count_row_lengths(pre_inds, single_row_lengths, 1)
+    multi_row_lengths = np.empty(NUM_ROWS, dtype=np.uint32)
+    slm.count_row_lengths(pre_inds, multi_row_lengths, num_threads)
+    np.testing.assert_array_equal(multi_row_lengths, single_row_lengths)
+    np.testing.assert_array_equal(
+        single_row_lengths, np.bincount(pre_inds, minlength=NUM_ROWS))
+
+    # Sort synapses using one and multiple threads
+    single_order = np.empty(num_synapses, dtype=np.uint64)
+    slm.sort_synapses(pre_inds, post_inds, single_order, NUM_ROWS, 1)
+    multi_order = np.empty(num_synapses, dtype=np.uint64)
+    slm.sort_synapses(pre_inds, post_inds, multi_order, NUM_ROWS,
+                      num_threads)
+    np.testing.assert_array_equal(multi_order, single_order)
+
+    # Order should be stable sort by pre and then postsynaptic index
+    np.testing.assert_array_equal(single_order,
+                                  np.lexsort((post_inds, pre_inds)))
+
+    # Gather values into compact and padded arrays using multiple threads
+    values = np.arange(num_synapses, dtype=np.float32)
+    compact = np.empty(num_synapses, dtype=np.float32)
+    slm.sort_ragged_var(multi_row_lengths, multi_order, values.view(np.uint8),
+                        compact.view(np.uint8), 0, 4, num_threads)
+    np.testing.assert_array_equal(compact, values[single_order])
+
+    row_stride = int(np.amax(multi_row_lengths)) if num_synapses > 0 else 0
+    padded = np.zeros(NUM_ROWS * row_stride, dtype=np.float32)
+    slm.sort_ragged_var(multi_row_lengths, multi_order, values.view(np.uint8),
+                        padded.view(np.uint8), row_stride, 4, num_threads)
+    padded_rows = padded.reshape(NUM_ROWS, row_stride)
+    np.testing.assert_array_equal(
+        np.concatenate([r[:l] for r, l in zip(padded_rows, multi_row_lengths)]),
+        compact)
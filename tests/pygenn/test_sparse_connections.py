@@ -0,0 +1,125 @@
+import numpy as np
+import pytest
+
+from pygenn.genn_model import GeNNModel
+
+NUM_PRE = 50
+NUM_POST = 100
+
+
+def _build_model(backend, name):
+    model = GeNNModel("float", name, backend=backend)
+    model.dT = 1.0
+
+    pre = model.add_neuron_population("Pre", NUM_PRE, "SpikeSource", {}, {})
+    post = model.add_neuron_population("Post", NUM_POST, "SpikeSource", {}, {})
+
+    syn = model.add_synapse_population(
+        "Syn", "SPARSE_INDIVIDUALG", 0, pre, post,
+        "StaticPulse", {}, {"g": 0.0}, {}, {},
+        "DeltaCurr", {}, {})
+    return model, syn
+
+
+def _load_model(model, tmpdir):
+    model.build(str(tmpdir))
+    model.load(str(tmpdir))
+
+
+@pytest.mark.parametrize("backend", ["SingleThreadedCPU", "MultiThreadedCPU"])
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_set_sparse_connections(tmpdir, backend, num_threads):
+    model, syn = _build_model(backend, "test_set_sparse_connections")
+
+    # Generate unsorted connections, including some duplicates
+    rng = np.random.RandomState(1234)
+    num_synapses = 2000
+    pre_inds = rng.randint(0, NUM_PRE, num_synapses)
+    post_inds = rng.randint(0, NUM_POST, num_synapses)
+    weights = np.arange(num_synapses, dtype=np.float32)
+
+    syn.set_sparse_connections(pre_inds, post_inds, num_threads=num_threads)
+    syn.vars["g"].set_values(weights)
+    _load_model(model, tmpdir)
+
+    # Connections should be sorted by pre and then postsynaptic index
+    order = np.lexsort((post_inds, pre_inds))
+    np.testing.assert_array_equal(syn.get_sparse_pre_inds(num_threads),
+                                  pre_inds[order])
+    np.testing.assert_array_equal(syn.get_sparse_post_inds(num_threads),
+                                  post_inds[order])
+
+    # Weights should have been moved with their connections
+    syn.pull_var_from_device("g")
+    np.testing.assert_array_equal(syn.get_var_values("g", num_threads),
+                                  weights[order])
+
+
+@pytest.mark.parametrize("backend", ["SingleThreadedCPU", "MultiThreadedCPU"])
+def test_set_sparse_connections_csr(tmpdir, backend):
+    model, syn = _build_model(backend, "test_set_sparse_connections_csr")
+
+    # Build sorted CSR connectivity with empty rows
+    rng = np.random.RandomState(1234)
+    row_lengths = rng.randint(0, 20, NUM_PRE)
+    row_lengths[::7] = 0
+    row_ptr = np.concatenate(([0], np.cumsum(row_lengths)))
+    post_inds = np.concatenate([np.sort(rng.choice(NUM_POST, l, replace=False))
+                                for l in row_lengths])
+    weights = rng.uniform(size=len(post_inds)).astype(np.float32)
+
+    syn.set_sparse_connections_csr(row_ptr, post_inds, num_threads=4)
+    syn.vars["g"].set_values(weights)
+    _load_model(model, tmpdir)
+
+    # Connectivity and weights should be returned as specified
+    np.testing.assert_array_equal(syn.get_sparse_pre_inds(),
+                                  np.repeat(np.arange(NUM_PRE), row_lengths))
+    np.testing.assert_array_equal(syn.get_sparse_post_inds(), post_inds)
+
+    syn.pull_var_from_device("g")
+    np.testing.assert_array_equal(syn.get_var_values("g"), weights)
+
+
+def test_set_sparse_connections_invalid():
+    model, syn = _build_model("SingleThreadedCPU",
+                              "test_set_sparse_connections_invalid")
+
+    # Out of range indices, including negative ones which would wrap
+    with pytest.raises(Exception):
+        syn.set_sparse_connections([0, NUM_PRE], [0, 1])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections([0, 1], [0, NUM_POST])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections([0, -1], [0, 1])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections([0, 1], [0, -1])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections([0, 1], [0, 2 ** 32])
+
+    # Mismatched lengths
+    with pytest.raises(Exception):
+        syn.set_sparse_connections([0, 1], [0])
+
+    # row_ptr of the wrong length, not starting at zero,
+    # decreasing or not ending at the number of synapses
+    row_ptr = np.zeros(NUM_PRE + 1, dtype=np.int64)
+    with pytest.raises(Exception):
+        syn.set_sparse_connections_csr(row_ptr[:-1], [])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections_csr(row_ptr + 1, [])
+
+    row_ptr[1] = 2
+    row_ptr[2:] = 1
+    with pytest.raises(Exception):
+        syn.set_sparse_connections_csr(row_ptr, [0])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections_csr(row_ptr, [0, 1])
+
+    # Out of range postsynaptic indices
+    row_ptr[:] = 0
+    row_ptr[-1] = 1
+    with pytest.raises(Exception):
+        syn.set_sparse_connections_csr(row_ptr, [NUM_POST])
+    with pytest.raises(Exception):
+        syn.set_sparse_connections_csr(row_ptr, [-1])
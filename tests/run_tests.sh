@@ -1,10 +1,11 @@
 #!/bin/bash
 # By default no flags are passed to genn-buildmodel.sh
-BACKENDS="SingleThreadedCPU"
+BACKENDS="SingleThreadedCPU MultiThreadedCPU"
 REPORT=0
 
 # Variables containing build flags corresponding to various backends
 BUILD_FLAGS_SingleThreadedCPU=-c
+BUILD_FLAGS_MultiThreadedCPU=-p
 BUILD_FLAGS_OpenCL=-l
 
 # Parse command line arguments
@@ -0,0 +1,276 @@
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Userproject includes
+#include "../../userproject/include/binaryRecording.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+std::string getTempFilename(const std::string &name)
+{
+    return ::testing::TempDir() + name;
+}
+
+std::vector<char> readFile(const std::string &filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string &filename, const std::vector<char> &data)
+{
+    std::ofstream stream(filename, std::ios::binary);
+    stream.write(data.data(), data.size());
+}
+
+std::vector<uint32_t> getSpikes(const BinaryRecording::Reader &reader, uint64_t i)
+{
+    const auto spikes = reader.getSpikes(i);
+    return std::vector<uint32_t>(spikes.begin(), spikes.end());
+}
+
+// Write spike list recording with 4 timesteps, starting at timestep 10, where timestep 12 is skipped
+void writeSpikeList(const std::string &filename)
+{
+    BinaryRecording::Writer writer(filename, "Pop", BinaryRecording::Encoding::SpikeList, 100, 0.5, 10);
+    const unsigned int spikes10[] = {3, 7, 99};
+    const unsigned int spikes13[] = {0};
+    writer.writeSpikes(10, 3, spikes10);
+    writer.writeSpikes(11, 0, nullptr);
+    writer.writeSpikes(13, 1, spikes13);
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(BinaryRecording, SpikeList)
+{
+    const std::string filename = getTempFilename("spike_list.bin");
+    writeSpikeList(filename);
+    {
+        BinaryRecording::Reader reader(filename);
+        ASSERT_EQ(reader.getName(), "Pop");
+        ASSERT_EQ(reader.getEncoding(), BinaryRecording::Encoding::SpikeList);
+        ASSERT_EQ(reader.getPopSize(), 100u);
+        ASSERT_EQ(reader.getNumColumns(), 0u);
+        ASSERT_EQ(reader.getDT(), 0.5);
+        ASSERT_EQ(reader.getStartTimestep(), 10u);
+        ASSERT_EQ(reader.getNumTimesteps(), 4u);
+        ASSERT_EQ(reader.getTime(1), 5.5);
+        ASSERT_EQ(reader.getHeader().dataOffset % BinaryRecording::dataAlignment, 0u);
+
+        ASSERT_EQ(getSpikes(reader, 0), std::vector<uint32_t>({3, 7, 99}));
+        ASSERT_TRUE(getSpikes(reader, 1).empty());
+        ASSERT_TRUE(getSpikes(reader, 2).empty());
+        ASSERT_EQ(getSpikes(reader, 3), std::vector<uint32_t>({0}));
+        ASSERT_TRUE(reader.isSpike(0, 99));
+        ASSERT_FALSE(reader.isSpike(0, 98));
+
+        // Data should be mapped directly from file
+        const std::vector<char> file = readFile(filename);
+        const uint32_t *data = reader.getData<uint32_t>();
+        ASSERT_EQ(std::memcmp(data, &file[reader.getHeader().dataOffset], 4 * sizeof(uint32_t)), 0);
+        ASSERT_THROW(reader.getData<float>(), std::runtime_error);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, SpikeListEmpty)
+{
+    const std::string filename = getTempFilename("spike_list_empty.bin");
+    {
+        BinaryRecording::Writer writer(filename, "", BinaryRecording::Encoding::SpikeList, 10, 1.0);
+    }
+    {
+        BinaryRecording::Reader reader(filename);
+        ASSERT_EQ(reader.getName(), "");
+        ASSERT_EQ(reader.getNumTimesteps(), 0u);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, SpikeBitmask)
+{
+    // Generate 3 timesteps of bitmask data for 70 neurons
+    const std::vector<std::vector<uint32_t>> spikes{{0, 31, 32, 69}, {}, {5, 64}};
+    std::vector<uint32_t> words(3 * 3, 0);
+    for(size_t t = 0; t < spikes.size(); t++) {
+        for(uint32_t i : spikes[t]) {
+            words[(t * 3) + (i / 32)] |= (1u << (i % 32));
+        }
+    }
+
+    const std::string filename = getTempFilename("spike_bitmask.bin");
+    {
+        // Write first timestep then the remaining two
+        BinaryRecording::Writer writer(filename, "Neurons", BinaryRecording::Encoding::SpikeBitmask, 70, 0.1);
+        writer.writeSpikeBitmask(&words[0], 1);
+        writer.writeSpikeBitmask(&words[3], 2);
+        ASSERT_THROW(writer.writeSpikes(3, 0, nullptr), std::runtime_error);
+    }
+    {
+        BinaryRecording::Reader reader(filename);
+        ASSERT_EQ(reader.getName(), "Neurons");
+        ASSERT_EQ(reader.getNumColumns(), 3u);
+        ASSERT_EQ(reader.getNumTimesteps(), 3u);
+        for(size_t t = 0; t < spikes.size(); t++) {
+            ASSERT_EQ(getSpikes(reader, t), spikes[t]);
+        }
+        ASSERT_TRUE(reader.isSpike(0, 69));
+        ASSERT_FALSE(reader.isSpike(1, 69));
+        ASSERT_TRUE(std::equal(words.cbegin(), words.cend(), reader.getData<uint32_t>()));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, AnalogueColumns)
+{
+    const std::string filename = getTempFilename("analogue_columns.bin");
+    {
+        BinaryRecording::Writer writer(filename, "V", BinaryRecording::Encoding::AnalogueFloat, 100, 1.0, 0, 0, {4, 2});
+        const float values0[] = {1.0f, 2.0f};
+        const float values1[] = {3.0f, 4.0f};
+        writer.writeAnalogue(values0);
+        writer.writeAnalogue(values1);
+        const double valuesDouble[] = {1.0, 2.0};
+        ASSERT_THROW(writer.writeAnalogue(valuesDouble), std::runtime_error);
+    }
+    {
+        BinaryRecording::Reader reader(filename);
+        ASSERT_EQ(reader.getNumColumns(), 2u);
+        ASSERT_EQ(reader.getColumnNeuron(0), 4u);
+        ASSERT_EQ(reader.getColumnNeuron(1), 2u);
+
+        const auto values = reader.getValues<float>(1);
+        ASSERT_EQ(std::vector<float>(values.begin(), values.end()), std::vector<float>({3.0f, 4.0f}));
+        const auto column = reader.getColumnValues<float>(1);
+        ASSERT_EQ(std::vector<float>(column.begin(), column.end()), std::vector<float>({2.0f, 4.0f}));
+        ASSERT_THROW(reader.getValues<double>(0), std::runtime_error);
+        ASSERT_THROW(reader.getSpikes(0), std::runtime_error);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, AnalogueDouble)
+{
+    const std::string filename = getTempFilename("analogue_double.bin");
+    {
+        // Record 4 columns from population of 3 so default column table wraps
+        BinaryRecording::Writer writer(filename, "V", BinaryRecording::Encoding::AnalogueDouble, 3, 1.0, 0, 4);
+        const double values[] = {0.5, 1.5, 2.5, 3.5};
+        writer.writeAnalogue(values);
+    }
+    {
+        BinaryRecording::Reader reader(filename);
+        ASSERT_EQ(reader.getHeader().columnsOffset, 0u);
+        ASSERT_EQ(reader.getColumnNeuron(3), 0u);
+        const auto values = reader.getValues<double>(0);
+        ASSERT_EQ(std::vector<double>(values.begin(), values.end()), std::vector<double>({0.5, 1.5, 2.5, 3.5}));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, OutOfOrder)
+{
+    const std::string filename = getTempFilename("out_of_order.bin");
+    {
+        BinaryRecording::Writer writer(filename, "Pop", BinaryRecording::Encoding::SpikeList, 10, 1.0, 5);
+        ASSERT_THROW(writer.writeSpikes(4, 0, nullptr), std::runtime_error);
+        writer.writeSpikes(5, 0, nullptr);
+        ASSERT_THROW(writer.writeSpikes(5, 0, nullptr), std::runtime_error);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, Version)
+{
+    const std::string filename = getTempFilename("version.bin");
+    writeSpikeList(filename);
+
+    // Overwrite version in header
+    std::vector<char> file = readFile(filename);
+    const uint32_t version = BinaryRecording::version + 1;
+    std::memcpy(&file[offsetof(BinaryRecording::Header, version)], &version, sizeof(uint32_t));
+    writeFile(filename, file);
+    ASSERT_THROW(BinaryRecording::Reader reader(filename), std::runtime_error);
+
+    // Overwrite magic
+    file[0] = 'X';
+    writeFile(filename, file);
+    ASSERT_THROW(BinaryRecording::Reader reader(filename), std::runtime_error);
+
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, Missing)
+{
+    ASSERT_THROW(BinaryRecording::Reader reader(getTempFilename("missing.bin")), std::runtime_error);
+}
+
+TEST(BinaryRecording, Truncated)
+{
+    const std::string filename = getTempFilename("truncated.bin");
+    writeSpikeList(filename);
+    const std::vector<char> file = readFile(filename);
+    BinaryRecording::Header header;
+    std::memcpy(&header, file.data(), sizeof(BinaryRecording::Header));
+
+    // Shorter than header, missing the end of the index table and missing the whole index table
+    for(size_t size : {sizeof(BinaryRecording::Header) - 1, file.size() - 1, (size_t)header.indexOffset}) {
+        writeFile(filename, std::vector<char>(file.cbegin(), file.cbegin() + size));
+        ASSERT_THROW(BinaryRecording::Reader reader(filename), std::runtime_error);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, TruncatedAnalogue)
+{
+    const std::string filename = getTempFilename("truncated_analogue.bin");
+    {
+        BinaryRecording::Writer writer(filename, "V", BinaryRecording::Encoding::AnalogueFloat, 4, 1.0);
+        const float values[] = {0.0f, 1.0f, 2.0f, 3.0f};
+        writer.writeAnalogue(values);
+        writer.writeAnalogue(values);
+    }
+
+    // Missing last value of data section
+    std::vector<char> file = readFile(filename);
+    file.resize(file.size() - sizeof(float));
+    writeFile(filename, file);
+    ASSERT_THROW(BinaryRecording::Reader reader(filename), std::runtime_error);
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryRecording, Unfinalised)
+{
+    const std::string filename = getTempFilename("unfinalised.bin");
+    writeSpikeList(filename);
+
+    // Restore header to state it is written in before writer is closed so file looks like writer crashed
+    std::vector<char> file = readFile(filename);
+    BinaryRecording::Header header;
+    std::memcpy(&header, file.data(), sizeof(BinaryRecording::Header));
+    header.numTimesteps = 0;
+    header.indexOffset = 0;
+    std::memcpy(file.data(), &header, sizeof(BinaryRecording::Header));
+    writeFile(filename, file);
+    ASSERT_THROW(BinaryRecording::Reader reader(filename), std::runtime_error);
+    std::remove(filename.c_str());
+}
@@ -67,6 +67,71 @@ TEST(EnsureMathFunctionFtype, supportCodeFunc) {
     ASSERT_EQ(substitutedCode, "TestNamespace_supportCodeFunc(x);");
 }
 
+// Check that only function calls get replaced
+TEST(EnsureMathFunctionFtype, expfNotCalled) {
+    const std::string code = "const scalar expf = 2.0; $(x) = expf (expf * 2.0);";
+
+    const std::string substitutedCode = ensureFtype(code, "float");
+    ASSERT_EQ(substitutedCode, "const scalar expf = 2.0f; $(x) = exp (expf * 2.0f);");
+}
+
+// Check that repeated variables separated by a single character are all replaced
+TEST(VarSubstitute, Repeated) {
+    std::string code = "a*a+a";
+
+    ASSERT_TRUE(regexVarSubstitute(code, "a", "b"));
+    ASSERT_EQ(code, "b*b+b");
+}
+
+// Check that function names are only replaced when called
+TEST(FuncSubstitute, OnlyCalls) {
+    std::string code = "foo(foo) + foo\n(2)";
+
+    ASSERT_TRUE(regexFuncSubstitute(code, "foo", "bar"));
+    ASSERT_EQ(code, "bar(foo) + bar\n(2)");
+}
+
+// Check that variables are substituted from innermost Substitutions and within replacements
+TEST(Substitutions, Nested) {
+    Substitutions parent;
+    parent.addVarSubstitution("id", "i");
+    parent.addVarSubstitution("x", "group->x[$(id)]");
+
+    Substitutions child(&parent);
+    child.addVarSubstitution("y", "$(x) * $(z)");
+    child.addVarSubstitution("z", "lz");
+    child.addVarSubstitution("id", "j");
+
+    std::string code = "$(y) + $(x) + $(unknown)";
+    child.apply(code);
+    ASSERT_EQ(code, "group->x[i] * lz + group->x[i] + $(unknown)");
+}
+
+// Check that function parameters are substituted and can themselves contain function calls
+TEST(Substitutions, Functions) {
+    Substitutions parent;
+    parent.addFuncSubstitution("gennrand_uniform", 0, "uniform(rng)");
+    parent.addFuncSubstitution("addToInSyn", 1, "inSyn[$(id)] += $(0)");
+    parent.addFuncSubstitution("addToInSynDelay", 2, "denDelay[$(1) + $(id)] += $(0)");
+    parent.addVarSubstitution("id", "i");
+
+    Substitutions child(&parent);
+    child.addVarSubstitution("g", "lg");
+
+    std::string code = "$(addToInSyn, $(g) * fmod($(gennrand_uniform), 1.0)); $(addToInSynDelay, $(g), 2)";
+    child.applyCheckUnreplaced(code, "test");
+    ASSERT_EQ(code, "inSyn[i] += lg*fmod(uniform(rng), 1.0); denDelay[2 + i] += lg");
+}
+
+// Check that unreplaced variables are reported
+TEST(Substitutions, Unreplaced) {
+    Substitutions subs;
+    subs.addVarSubstitution("x", "lx");
+
+    std::string code = "$(x) + $(y)";
+    ASSERT_THROW(subs.applyCheckUnreplaced(code, "test"), std::runtime_error);
+}
+
 //--------------------------------------------------------------------------
 // SingleValueSubstitutionTest
 //--------------------------------------------------------------------------
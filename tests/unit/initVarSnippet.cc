@@ -25,12 +25,15 @@ TEST(InitVarSnippet, CompareBuiltIn)
     ASSERT_TRUE(InitVarSnippet::Constant::getInstance()->canBeMerged(InitVarSnippet::Constant::getInstance()));
     ASSERT_FALSE(InitVarSnippet::Uniform::getInstance()->canBeMerged(InitVarSnippet::Normal::getInstance()));
     ASSERT_FALSE(InitVarSnippet::Exponential::getInstance()->canBeMerged(InitVarSnippet::Gamma::getInstance()));
+    ASSERT_NE(InitVarSnippet::Uniform::getInstance()->getHashDigest(), InitVarSnippet::Normal::getInstance()->getHashDigest());
+    ASSERT_NE(InitVarSnippet::Exponential::getInstance()->getHashDigest(), InitVarSnippet::Gamma::getInstance()->getHashDigest());
 }
 
 TEST(InitVarSnippet, CompareCopyPasted)
 {
     UniformCopy uniformCopy;
     ASSERT_TRUE(InitVarSnippet::Uniform::getInstance()->canBeMerged(&uniformCopy));
+    ASSERT_EQ(InitVarSnippet::Uniform::getInstance()->getHashDigest(), uniformCopy.getHashDigest());
 }
 
 TEST(InitVarSnippet, CompareVarInitParameters)
@@ -44,4 +47,5 @@ TEST(InitVarSnippet, CompareVarInitParameters)
 
     ASSERT_TRUE(varInit0.canBeMerged(varInit1));
     ASSERT_TRUE(varInit0.canBeMerged(varInit2));
+    ASSERT_EQ(varInit0.getHashDigest(), varInit2.getHashDigest());
 }
@@ -223,6 +223,14 @@ TEST(NeuronGroup, CompareNeuronModels)
     ASSERT_TRUE(ng0Internal->canInitBeMerged(*ng1));
     ASSERT_FALSE(ng0Internal->canInitBeMerged(*ng2));
 
+    // Check that hash digests match wherever groups can be merged
+    NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal *>(ng1);
+    NeuronGroupInternal *ng2Internal = static_cast<NeuronGroupInternal *>(ng2);
+    ASSERT_EQ(ng0Internal->getHashDigest(), ng1Internal->getHashDigest());
+    ASSERT_EQ(ng0Internal->getHashDigest(), ng2Internal->getHashDigest());
+    ASSERT_EQ(ng0Internal->getInitHashDigest(), ng1Internal->getInitHashDigest());
+    ASSERT_NE(ng0Internal->getInitHashDigest(), ng2Internal->getInitHashDigest());
+
     // Create a backend
     CodeGenerator::SingleThreadedCPU::Preferences preferences;
     CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
@@ -293,6 +301,65 @@ TEST(NeuronGroup, CompareHeterogeneousParamVarState)
 }
 
 
+TEST(NeuronGroup, BatchParams)
+{
+    ModelSpecInternal model;
+    model.setBatchSize(3);
+
+    // Add two neuron groups to model
+    LIFAdditional::ParamValues paramVals(0.25, 10.0, 0.0, 0.0, 20.0, 0.0, 5.0);
+    LIFAdditional::VarValues varVals(0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<LIFAdditional>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<LIFAdditional>("Neurons1", 10, paramVals, varVals);
+
+    // Give first group per-instance offset currents and time constants and second group the same threshold in every instance
+    ng0->setBatchParamValues("Ioffset", {0.0, 1.0, 2.0});
+    ng0->setBatchParamValues("TauM", {10.0, 20.0, 10.0});
+    ng1->setBatchParamValues("Vthresh", {20.0, 20.0, 20.0});
+    ASSERT_THROW(ng1->setBatchParamValues("Vthreshold", {20.0, 20.0, 20.0}), std::runtime_error);
+
+    model.finalize();
+
+    // Check parameters and derived parameters of each instance
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
+    ASSERT_EQ(ng0Internal->getBatchParams().size(), 3);
+    ASSERT_EQ(ng0Internal->getBatchParams().at(2).at(5), 2.0);
+    ASSERT_EQ(ng0Internal->getBatchDerivedParams().at(1).at(1), 80.0);
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+    // Check all groups are merged, with an entry for each instance
+    ASSERT_TRUE(modelSpecMerged.getMergedNeuronUpdateGroups().size() == 1);
+    ASSERT_TRUE(modelSpecMerged.getMergedNeuronUpdateGroups().at(0).getGroups().size() == 6);
+
+    // Check that only parameters which differ between instances are heterogeneous
+    const auto &mergedGroup = modelSpecMerged.getMergedNeuronUpdateGroups().at(0);
+    ASSERT_FALSE(mergedGroup.isParamHeterogeneous(0));
+    ASSERT_TRUE(mergedGroup.isParamHeterogeneous(1));
+    ASSERT_FALSE(mergedGroup.isParamHeterogeneous(4));
+    ASSERT_TRUE(mergedGroup.isParamHeterogeneous(5));
+    ASSERT_TRUE(mergedGroup.isDerivedParamHeterogeneous(0));
+    ASSERT_TRUE(mergedGroup.isDerivedParamHeterogeneous(1));
+}
+
+TEST(NeuronGroup, BatchParamsInvalidSize)
+{
+    ModelSpecInternal model;
+    model.setBatchSize(3);
+
+    LIFAdditional::ParamValues paramVals(0.25, 10.0, 0.0, 0.0, 20.0, 0.0, 5.0);
+    LIFAdditional::VarValues varVals(0.0, 0.0);
+    auto *ng = model.addNeuronPopulation<LIFAdditional>("Neurons", 10, paramVals, varVals);
+    ng->setBatchParamValues("Ioffset", {0.0, 1.0});
+
+    ASSERT_THROW(model.finalize(), std::runtime_error);
+}
+
 TEST(NeuronGroup, CompareSimRNG)
 {
     ModelSpecInternal model;
@@ -365,6 +432,14 @@ TEST(NeuronGroup, CompareCurrentSources)
     ASSERT_TRUE(ng0Internal->canInitBeMerged(*ng3));
     ASSERT_FALSE(ng0Internal->canInitBeMerged(*ng4));
 
+    // Check that hash digests match wherever groups can be merged, independent of current source order
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal *>(ng1)->getHashDigest());
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal *>(ng2)->getHashDigest());
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal *>(ng3)->getHashDigest());
+    ASSERT_NE(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal *>(ng4)->getHashDigest());
+    ASSERT_EQ(ng0Internal->getInitHashDigest(), static_cast<NeuronGroupInternal *>(ng3)->getInitHashDigest());
+    ASSERT_NE(ng0Internal->getInitHashDigest(), static_cast<NeuronGroupInternal *>(ng4)->getInitHashDigest());
+
     // Create a backend
     CodeGenerator::SingleThreadedCPU::Preferences preferences;
     CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
@@ -0,0 +1,126 @@
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Userproject includes
+#include "../../userproject/include/spikeRecorder.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+const unsigned int numNeurons = 100;
+const unsigned int numTimesteps = 1000;
+
+unsigned int spikeCount = 0;
+unsigned int spikes[numNeurons];
+
+unsigned int &getSpikeCount(){ return spikeCount; }
+unsigned int *getSpikes(){ return spikes; }
+
+// Generate a known spike stream with varying numbers of spikes, including timesteps without any
+template<typename Writer, typename... WriterArgs>
+unsigned int record(WriterArgs &&... writerArgs)
+{
+    SpikeRecorder<Writer> recorder(&getSpikes, &getSpikeCount, std::forward<WriterArgs>(writerArgs)...);
+    for(unsigned int t = 0; t < numTimesteps; t++) {
+        spikeCount = (t * 37) % numNeurons;
+        for(unsigned int i = 0; i < spikeCount; i++) {
+            spikes[i] = (i * 13 + t) % numNeurons;
+        }
+        recorder.record(t * 0.1);
+    }
+    return recorder.getSum();
+}
+
+std::vector<char> readFile(const std::string &filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+//--------------------------------------------------------------------------
+// SpikeWriterAsyncTest
+//--------------------------------------------------------------------------
+class SpikeWriterAsyncTest : public ::testing::TestWithParam<size_t>
+{
+};
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST_P(SpikeWriterAsyncTest, MatchesText)
+{
+    const std::string textFilename = ::testing::TempDir() + "spikes_text.csv";
+    const std::string asyncFilename = ::testing::TempDir() + "spikes_async.csv";
+
+    // Record identical spike streams with synchronous and asynchronous writers, destroying writers to finish writing
+    const unsigned int textSum = record<SpikeWriterText>(textFilename, ",", true);
+    const unsigned int asyncSum = record<SpikeWriterAsync>(asyncFilename, ",", true, GetParam());
+    ASSERT_EQ(textSum, asyncSum);
+    ASSERT_GT(textSum, 0u);
+
+    // Check files are identical
+    const std::vector<char> text = readFile(textFilename);
+    const std::vector<char> async = readFile(asyncFilename);
+    std::remove(textFilename.c_str());
+    std::remove(asyncFilename.c_str());
+    ASSERT_FALSE(text.empty());
+    ASSERT_EQ(text, async);
+}
+
+TEST(SpikeWriterAsync, RingFull)
+{
+    const std::string textFilename = ::testing::TempDir() + "spikes_ring_full_text.csv";
+    const std::string asyncFilename = ::testing::TempDir() + "spikes_ring_full_async.csv";
+
+    // Every neuron spikes every timestep
+    spikeCount = numNeurons;
+    for(unsigned int i = 0; i < numNeurons; i++) {
+        spikes[i] = i;
+    }
+    {
+        SpikeRecorder<SpikeWriterText> recorder(&getSpikes, &getSpikeCount, textFilename);
+        for(unsigned int t = 0; t < numTimesteps; t++) {
+            recorder.record(t);
+        }
+    }
+    {
+        // With a single buffer, recording has to wait whenever the writer thread hasn't finished writing the previous timestep
+        SpikeRecorder<SpikeWriterAsync> recorder(&getSpikes, &getSpikeCount, asyncFilename, " ", false, 1);
+        for(unsigned int t = 0; t < numTimesteps; t++) {
+            recorder.record(t);
+        }
+
+        ASSERT_GT(recorder.getNumStalls(), 0u);
+        ASSERT_GE(recorder.getStallTime(), 0.0);
+        ASSERT_EQ(recorder.getMaxQueueLength(), 1u);
+    }
+
+    // Check all spikes were written once writer is destroyed
+    const std::vector<char> text = readFile(textFilename);
+    const std::vector<char> async = readFile(asyncFilename);
+    std::remove(textFilename.c_str());
+    std::remove(asyncFilename.c_str());
+    ASSERT_EQ((unsigned int)std::count(async.cbegin(), async.cend(), '\n'), numNeurons * numTimesteps);
+    ASSERT_EQ(text, async);
+}
+
+//--------------------------------------------------------------------------
+// Instatiations
+//--------------------------------------------------------------------------
+// Number of buffers which will fill whenever writer thread falls behind and which will rarely fill
+INSTANTIATE_TEST_CASE_P(NumBuffers,
+                        SpikeWriterAsyncTest,
+                        ::testing::Values(1, 2, 256));
@@ -666,4 +666,62 @@ TEST(SynapseGroup, SharedWeightSlaveInvalidMethods)
     }
     //setSparseConnectivityExtraGlobalParamLocation
     //setMaxSourceConnections
-}
\ No newline at end of file
+}
+TEST(SynapseGroup, BatchWUParams)
+{
+    ModelSpecInternal model;
+    model.setBatchSize(2);
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+
+    // Add STDP synapse group with per-instance potentiation rate
+    STDPAdditive::ParamValues params(10.0, 10.0, 0.01, 0.01, 0.0, 1.0);
+    STDPAdditive::VarValues varVals2(0.0);
+    STDPAdditive::PreVarValues preVarVals(0.0);
+    STDPAdditive::PostVarValues postVarVals(0.0);
+    auto *sg = model.addSynapsePopulation<STDPAdditive, PostsynapticModels::DeltaCurr>("Synapses", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                       "Neurons0", "Neurons1",
+                                                                                       params, varVals2, preVarVals, postVarVals,
+                                                                                       {}, {});
+    sg->setWUBatchParamValues("Aplus", {0.01, 0.02});
+    ASSERT_THROW(sg->setWUBatchParamValues("Aplush", {0.01, 0.02}), std::runtime_error);
+
+    model.finalize();
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+    // Check that potentiation rate is only heterogeneous in postsynaptic update, which uses it
+    ASSERT_FALSE(modelSpecMerged.getMergedPresynapticUpdateGroups().at(0).isWUParamHeterogeneous(2));
+    ASSERT_TRUE(modelSpecMerged.getMergedPostsynapticUpdateGroups().at(0).isWUParamHeterogeneous(2));
+    ASSERT_FALSE(modelSpecMerged.getMergedPostsynapticUpdateGroups().at(0).isWUParamHeterogeneous(3));
+}
+
+TEST(SynapseGroup, BatchWUParamsEventThreshold)
+{
+    ModelSpecInternal model;
+    model.setBatchSize(2);
+
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+
+    // Parameters used in event threshold conditions can't be set per-instance
+    WeightUpdateModels::StaticGraded::ParamValues gradedParams(0.0, 0.1);
+    WeightUpdateModels::StaticGraded::VarValues gradedVarVals(1.0);
+    auto *sg = model.addSynapsePopulation<WeightUpdateModels::StaticGraded, PostsynapticModels::DeltaCurr>("Synapses", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           gradedParams, gradedVarVals,
+                                                                                                           {}, {});
+    ASSERT_THROW(sg->setWUBatchParamValues("Epre", {0.0, 1.0}), std::runtime_error);
+    sg->setWUBatchParamValues("Vslope", {0.1, 0.2});
+}
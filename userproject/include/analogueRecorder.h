@@ -1,11 +1,15 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
 #include <fstream>
 #include <initializer_list>
 #include <string>
 #include <vector>
 
+// GeNN userproject includes
+#include "binaryRecording.h"
+
 //----------------------------------------------------------------------------
 // AnalogueRecorder
 //----------------------------------------------------------------------------
@@ -46,3 +50,52 @@ private:
     const unsigned int m_PopSize;
     const std::string m_Delimiter;
 };
+
+//----------------------------------------------------------------------------
+// AnalogueRecorderBinary
+//----------------------------------------------------------------------------
+//! Records variables to a memory-mappable binary recording file (see BinaryRecording)
+/*! Each timestep, the values of each variable are written consecutively so column c
+    contains the value of neuron (c % popSize) of variable (c / popSize) */
+template<typename T>
+class AnalogueRecorderBinary
+{
+public:
+    AnalogueRecorderBinary(const std::string &filename, const std::string &name, std::initializer_list<T*> variables,
+                           unsigned int popSize, double dt, uint64_t startTimestep = 0)
+    :   m_Writer(filename, name, BinaryRecording::getAnalogueEncoding<T>(), popSize, dt, startTimestep,
+                 popSize * (unsigned int)variables.size()),
+        m_Variables(variables), m_PopSize(popSize), m_Buffer(popSize * variables.size())
+    {
+    }
+    AnalogueRecorderBinary(const std::string &filename, const std::string &name, T *variable,
+                           unsigned int popSize, double dt, uint64_t startTimestep = 0)
+    :   AnalogueRecorderBinary(filename, name, {variable}, popSize, dt, startTimestep)
+    {
+    }
+
+    void record(double)
+    {
+        // If there's only one variable, write directly from it
+        if(m_Variables.size() == 1) {
+            m_Writer.writeAnalogue(m_Variables.front());
+        }
+        // Otherwise, gather variables into buffer and write that
+        else {
+            auto b = m_Buffer.begin();
+            for(auto *v : m_Variables) {
+                b = std::copy_n(v, m_PopSize, b);
+            }
+            m_Writer.writeAnalogue(m_Buffer.data());
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    BinaryRecording::Writer m_Writer;
+    std::vector<T*> m_Variables;
+    const unsigned int m_PopSize;
+    std::vector<T> m_Buffer;
+};
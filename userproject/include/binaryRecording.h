@@ -0,0 +1,658 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Standard C includes
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <intrin.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+// BinaryRecording
+//----------------------------------------------------------------------------
+//! Self-describing binary format for spike and analogue recordings which can be memory-mapped for analysis
+/*! A recording file consists of:
+    - a fixed-size Header
+    - the population name (Header::nameLength bytes, not null-terminated)
+    - if Header::columnsOffset is non-zero, a uint32_t neuron index for each of the Header::numColumns columns
+    - the data, starting at Header::dataOffset (aligned to 64 bytes), laid out according to Header::encoding
+    - for Encoding::SpikeList, a uint64_t index table starting at Header::indexOffset
+
+    All values are stored in the byte order of the machine which wrote the recording (little-endian in practice).
+    The format is also read by pygenn.binary_recording */
+namespace BinaryRecording
+{
+//! How data is laid out in the data section of a recording
+enum class Encoding : uint32_t
+{
+    //! Header::numColumns uint32_t words per timestep in which bit (i % 32) of word (i / 32) is set if neuron i spiked
+    //! i.e. the format used by GeNN's spike recording system
+    SpikeBitmask    = 0,
+
+    //! uint32_t ids of neurons which spiked, grouped by timestep. The index table contains
+    //! Header::numTimesteps + 1 uint64_t offsets (in ids) of the start of each timestep's spikes
+    SpikeList       = 1,
+
+    //! Header::numColumns float values per timestep
+    AnalogueFloat   = 2,
+
+    //! Header::numColumns double values per timestep
+    AnalogueDouble  = 3,
+};
+
+//! Version of the format described here
+const uint32_t version = 1;
+
+//! Alignment of the start of the data section
+const uint64_t dataAlignment = 64;
+
+//----------------------------------------------------------------------------
+// BinaryRecording::Header
+//----------------------------------------------------------------------------
+struct Header
+{
+    //! "GENNREC" followed by a null terminator
+    char magic[8];
+
+    uint32_t version;
+    Encoding encoding;
+
+    //! Number of neurons in population
+    uint32_t popSize;
+
+    //! Number of values or words recorded each timestep (zero for Encoding::SpikeList)
+    uint32_t numColumns;
+
+    //! Simulation timestep in ms
+    double dt;
+
+    //! Index of first timestep recorded and number of consecutive timesteps recorded
+    uint64_t startTimestep;
+    uint64_t numTimesteps;
+
+    //! Offsets from start of file of data section, Encoding::SpikeList index table (otherwise zero)
+    //! and column neuron index table (zero if column i corresponds to neuron (i % popSize))
+    uint64_t dataOffset;
+    uint64_t indexOffset;
+    uint64_t columnsOffset;
+
+    //! Length of population name which immediately follows header
+    uint32_t nameLength;
+    uint32_t padding;
+};
+static_assert(sizeof(Header) == 80, "Unexpected padding in binary recording header");
+
+//----------------------------------------------------------------------------
+// Free functions
+//----------------------------------------------------------------------------
+//! Get size in bytes of each element stored in data section for given encoding
+inline size_t getElementSize(Encoding encoding)
+{
+    return (encoding == Encoding::AnalogueDouble) ? sizeof(double) : sizeof(uint32_t);
+}
+
+//! Get encoding used to store analogue values of type T
+template<typename T>
+Encoding getAnalogueEncoding()
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                  "Analogue recordings must be of float or double values");
+    return std::is_same<T, float>::value ? Encoding::AnalogueFloat : Encoding::AnalogueDouble;
+}
+
+//! Get index of lowest set bit in non-zero word
+inline unsigned int ctz(uint32_t value)
+{
+    assert(value != 0);
+#ifdef _WIN32
+    unsigned long trailingZero = 0;
+    _BitScanForward(&trailingZero, value);
+    return trailingZero;
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+//----------------------------------------------------------------------------
+// BinaryRecording::Writer
+//----------------------------------------------------------------------------
+//! Writes a recording of one population to a binary recording file
+/*! Timesteps must be written in order, starting at startTimestep.
+    The header is finalised when the writer is closed or destroyed. */
+class Writer
+{
+public:
+    //! Create writer
+    /*! \param filename         path of file to create
+        \param name             name of population being recorded
+        \param encoding         how data should be stored
+        \param popSize          number of neurons in population
+        \param dt               simulation timestep in ms
+        \param startTimestep    index of first timestep which will be written
+        \param numColumns       number of values recorded each timestep for analogue encodings (defaults to popSize)
+        \param columns          optional neuron index of each column */
+    Writer(const std::string &filename, const std::string &name, Encoding encoding, unsigned int popSize, double dt,
+           uint64_t startTimestep = 0, unsigned int numColumns = 0, const std::vector<unsigned int> &columns = {})
+    :   m_Stream(filename, std::ios::binary), m_Header(), m_NumSpikes(0)
+    {
+        if(!m_Stream.good()) {
+            throw std::runtime_error("Unable to open binary recording file '" + filename + "'");
+        }
+
+        // Determine number of columns
+        if(encoding == Encoding::SpikeBitmask) {
+            numColumns = (popSize + 31) / 32;
+        }
+        else if(encoding == Encoding::SpikeList) {
+            numColumns = 0;
+        }
+        else if(numColumns == 0) {
+            numColumns = columns.empty() ? popSize : (unsigned int)columns.size();
+        }
+
+        if(!columns.empty() && columns.size() != numColumns) {
+            throw std::runtime_error("Binary recording column index table must have an entry for each column");
+        }
+
+        // Fill in header
+        std::memcpy(m_Header.magic, "GENNREC", 8);
+        m_Header.version = version;
+        m_Header.encoding = encoding;
+        m_Header.popSize = popSize;
+        m_Header.numColumns = numColumns;
+        m_Header.dt = dt;
+        m_Header.startTimestep = startTimestep;
+        m_Header.nameLength = (uint32_t)name.size();
+
+        // Lay out name, optional column table and start of data
+        uint64_t offset = sizeof(Header) + name.size();
+        if(!columns.empty()) {
+            offset = padSize(offset, sizeof(uint32_t));
+            m_Header.columnsOffset = offset;
+            offset += sizeof(uint32_t) * columns.size();
+        }
+        m_Header.dataOffset = padSize(offset, dataAlignment);
+
+        // Write header (which will be rewritten on close), name and column table
+        m_Stream.write(reinterpret_cast<const char*>(&m_Header), sizeof(Header));
+        m_Stream.write(name.data(), name.size());
+        if(!columns.empty()) {
+            writePadding(m_Header.columnsOffset);
+            const std::vector<uint32_t> columns32(columns.cbegin(), columns.cend());
+            m_Stream.write(reinterpret_cast<const char*>(columns32.data()), sizeof(uint32_t) * columns32.size());
+        }
+        writePadding(m_Header.dataOffset);
+
+        if(encoding == Encoding::SpikeList) {
+            m_SpikeListIndex.push_back(0);
+        }
+    }
+
+    Writer(const Writer&) = delete;
+
+    ~Writer()
+    {
+        if(m_Stream.is_open()) {
+            close();
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Write the ids of the neurons which spiked in the given timestep (Encoding::SpikeList only)
+    /*! Any timesteps skipped since the last call are recorded as having no spikes */
+    void writeSpikes(uint64_t timestep, unsigned int spikeCount, const unsigned int *spikes)
+    {
+        checkEncoding(Encoding::SpikeList);
+        advanceTo(timestep);
+
+        // Write spikes, converting to uint32_t if required
+        if(sizeof(unsigned int) == sizeof(uint32_t)) {
+            m_Stream.write(reinterpret_cast<const char*>(spikes), sizeof(uint32_t) * spikeCount);
+        }
+        else {
+            const std::vector<uint32_t> spikes32(spikes, spikes + spikeCount);
+            m_Stream.write(reinterpret_cast<const char*>(spikes32.data()), sizeof(uint32_t) * spikeCount);
+        }
+        m_NumSpikes += spikeCount;
+        m_SpikeListIndex.push_back(m_NumSpikes);
+        m_Header.numTimesteps++;
+    }
+
+    //! Write numTimesteps timesteps of data recorded using GeNN's spike recording system (Encoding::SpikeBitmask only)
+    /*! \param spkRecord pointer to spike recording data (accessable via ``recordSpk<neuron group name>`` or ``recordSpkEvent<neuron group name>``) */
+    void writeSpikeBitmask(const uint32_t *spkRecord, unsigned int numTimesteps)
+    {
+        checkEncoding(Encoding::SpikeBitmask);
+        m_Stream.write(reinterpret_cast<const char*>(spkRecord), sizeof(uint32_t) * m_Header.numColumns * numTimesteps);
+        m_Header.numTimesteps += numTimesteps;
+    }
+
+    //! Write one timestep of analogue data, consisting of Header::numColumns values
+    template<typename T>
+    void writeAnalogue(const T *values)
+    {
+        checkEncoding(getAnalogueEncoding<T>());
+        m_Stream.write(reinterpret_cast<const char*>(values), sizeof(T) * m_Header.numColumns);
+        m_Header.numTimesteps++;
+    }
+
+    //! Write index table if required, finalise header and close file
+    void close()
+    {
+        // Write spike list index table
+        if(m_Header.encoding == Encoding::SpikeList) {
+            m_Header.indexOffset = padSize(getPosition(), sizeof(uint64_t));
+            writePadding(m_Header.indexOffset);
+            m_Stream.write(reinterpret_cast<const char*>(m_SpikeListIndex.data()), sizeof(uint64_t) * m_SpikeListIndex.size());
+        }
+
+        // Rewrite header
+        m_Stream.seekp(0);
+        m_Stream.write(reinterpret_cast<const char*>(&m_Header), sizeof(Header));
+        m_Stream.close();
+    }
+
+    const Header &getHeader() const{ return m_Header; }
+
+private:
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    static uint64_t padSize(uint64_t size, uint64_t blockSize)
+    {
+        return ((size + blockSize - 1) / blockSize) * blockSize;
+    }
+
+    uint64_t getPosition()
+    {
+        return (uint64_t)m_Stream.tellp();
+    }
+
+    void writePadding(uint64_t offset)
+    {
+        const uint64_t position = getPosition();
+        assert(offset >= position);
+        const std::vector<char> padding(offset - position, 0);
+        m_Stream.write(padding.data(), padding.size());
+    }
+
+    void checkEncoding(Encoding encoding) const
+    {
+        if(m_Header.encoding != encoding) {
+            throw std::runtime_error("Data written to binary recording does not match its encoding");
+        }
+    }
+
+    void advanceTo(uint64_t timestep)
+    {
+        const uint64_t nextTimestep = m_Header.startTimestep + m_Header.numTimesteps;
+        if(timestep < nextTimestep) {
+            throw std::runtime_error("Timesteps must be written to binary recording in order");
+        }
+
+        // Add empty entries for any skipped timesteps
+        for(uint64_t t = nextTimestep; t < timestep; t++) {
+            m_SpikeListIndex.push_back(m_NumSpikes);
+            m_Header.numTimesteps++;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::ofstream m_Stream;
+    Header m_Header;
+
+    //! Number of spikes written to Encoding::SpikeList recording and index table
+    uint64_t m_NumSpikes;
+    std::vector<uint64_t> m_SpikeListIndex;
+};
+
+//----------------------------------------------------------------------------
+// BinaryRecording::Range
+//----------------------------------------------------------------------------
+//! Pair of iterators which can be used with range-based for
+template<typename Iterator>
+class Range
+{
+public:
+    Range(Iterator begin, Iterator end) : m_Begin(begin), m_End(end)
+    {
+    }
+
+    Iterator begin() const{ return m_Begin; }
+    Iterator end() const{ return m_End; }
+
+private:
+    Iterator m_Begin;
+    Iterator m_End;
+};
+
+//----------------------------------------------------------------------------
+// BinaryRecording::StridedIterator
+//----------------------------------------------------------------------------
+//! Iterator over every stride'th element of an array e.g. one column of analogue data
+template<typename T>
+class StridedIterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T* pointer;
+    typedef const T& reference;
+
+    StridedIterator(const T *data, size_t stride) : m_Data(data), m_Stride(stride)
+    {
+    }
+
+    reference operator*() const{ return *m_Data; }
+    StridedIterator &operator++(){ m_Data += m_Stride; return *this; }
+    StridedIterator operator++(int){ StridedIterator old = *this; ++(*this); return old; }
+    bool operator==(const StridedIterator &other) const{ return m_Data == other.m_Data; }
+    bool operator!=(const StridedIterator &other) const{ return m_Data != other.m_Data; }
+
+private:
+    const T *m_Data;
+    size_t m_Stride;
+};
+
+//----------------------------------------------------------------------------
+// BinaryRecording::SpikeIterator
+//----------------------------------------------------------------------------
+//! Iterator over ids of the neurons which spiked in one timestep, in either spike encoding
+class SpikeIterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef uint32_t value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const uint32_t* pointer;
+    typedef uint32_t reference;
+
+    //! Create iterator over spike list
+    explicit SpikeIterator(const uint32_t *spikes)
+    :   m_Data(spikes), m_Bitmask(false), m_Word(0), m_WordIndex(0)
+    {
+    }
+
+    //! Create iterator over spike bitmask words (begin() for word 0 and end() for word numWords)
+    SpikeIterator(const uint32_t *words, uint32_t wordIndex, uint32_t numWords)
+    :   m_Data(words), m_Bitmask(true), m_Word(0), m_WordIndex(wordIndex), m_NumWords(numWords)
+    {
+        if(m_WordIndex < m_NumWords) {
+            m_Word = m_Data[m_WordIndex];
+            skipEmptyWords();
+        }
+    }
+
+    reference operator*() const
+    {
+        return m_Bitmask ? ((m_WordIndex * 32) + ctz(m_Word)) : *m_Data;
+    }
+
+    SpikeIterator &operator++()
+    {
+        if(m_Bitmask) {
+            // Clear lowest set bit and move onto next word if required
+            m_Word &= (m_Word - 1);
+            skipEmptyWords();
+        }
+        else {
+            m_Data++;
+        }
+        return *this;
+    }
+
+    SpikeIterator operator++(int){ SpikeIterator old = *this; ++(*this); return old; }
+
+    bool operator==(const SpikeIterator &other) const
+    {
+        return m_Bitmask ? (m_WordIndex == other.m_WordIndex && m_Word == other.m_Word) : (m_Data == other.m_Data);
+    }
+    bool operator!=(const SpikeIterator &other) const{ return !(*this == other); }
+
+private:
+    void skipEmptyWords()
+    {
+        while(m_Word == 0 && ++m_WordIndex < m_NumWords) {
+            m_Word = m_Data[m_WordIndex];
+        }
+        if(m_Word == 0) {
+            m_WordIndex = m_NumWords;
+        }
+    }
+
+    const uint32_t *m_Data;
+    bool m_Bitmask;
+    uint32_t m_Word;
+    uint32_t m_WordIndex;
+    uint32_t m_NumWords;
+};
+
+//----------------------------------------------------------------------------
+// BinaryRecording::Reader
+//----------------------------------------------------------------------------
+//! Memory-maps a binary recording file and provides zero-copy access to its contents
+class Reader
+{
+public:
+    typedef Range<SpikeIterator> SpikeRange;
+
+    explicit Reader(const std::string &filename)
+    {
+#ifdef _WIN32
+        m_File = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(m_File == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Unable to open binary recording file '" + filename + "'");
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(m_File, &size);
+        m_Size = (size_t)size.QuadPart;
+        m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        m_Data = (m_Mapping == nullptr) ? nullptr : static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+        if(m_Data == nullptr) {
+            unmap();
+            throw std::runtime_error("Unable to memory-map binary recording file '" + filename + "'");
+        }
+#else
+        m_File = open(filename.c_str(), O_RDONLY);
+        if(m_File == -1) {
+            throw std::runtime_error("Unable to open binary recording file '" + filename + "'");
+        }
+        struct stat fileStat;
+        fstat(m_File, &fileStat);
+        m_Size = (size_t)fileStat.st_size;
+        void *data = mmap(nullptr, m_Size, PROT_READ, MAP_SHARED, m_File, 0);
+        if(data == MAP_FAILED) {
+            m_Data = nullptr;
+            unmap();
+            throw std::runtime_error("Unable to memory-map binary recording file '" + filename + "'");
+        }
+        m_Data = static_cast<const char*>(data);
+#endif
+        // Validate header
+        if(m_Size < sizeof(Header) || std::memcmp(getHeader().magic, "GENNREC", 8) != 0) {
+            unmap();
+            throw std::runtime_error("'" + filename + "' is not a binary recording file");
+        }
+        const uint32_t fileVersion = getHeader().version;
+        if(fileVersion != version) {
+            unmap();
+            throw std::runtime_error("'" + filename + "' uses unsupported binary recording version " + std::to_string(fileVersion));
+        }
+
+        // Check data section fits in file
+        const auto &header = getHeader();
+        const uint64_t dataEnd = header.dataOffset + (header.numTimesteps * header.numColumns * getElementSize(header.encoding));
+        const uint64_t indexEnd = header.indexOffset + (sizeof(uint64_t) * (header.numTimesteps + 1));
+        if(dataEnd > m_Size || (header.encoding == Encoding::SpikeList && (header.indexOffset == 0 || indexEnd > m_Size))) {
+            unmap();
+            throw std::runtime_error("Binary recording file '" + filename + "' is truncated");
+        }
+    }
+
+    Reader(const Reader&) = delete;
+
+    ~Reader()
+    {
+        unmap();
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    const Header &getHeader() const{ return *reinterpret_cast<const Header*>(m_Data); }
+
+    std::string getName() const{ return std::string(m_Data + sizeof(Header), getHeader().nameLength); }
+    Encoding getEncoding() const{ return getHeader().encoding; }
+    unsigned int getPopSize() const{ return getHeader().popSize; }
+    unsigned int getNumColumns() const{ return getHeader().numColumns; }
+    double getDT() const{ return getHeader().dt; }
+    uint64_t getStartTimestep() const{ return getHeader().startTimestep; }
+    uint64_t getNumTimesteps() const{ return getHeader().numTimesteps; }
+
+    //! Get time in ms of ith timestep in recording
+    double getTime(uint64_t i) const{ return (double)(getStartTimestep() + i) * getDT(); }
+
+    //! Get neuron index corresponding to column of analogue data
+    unsigned int getColumnNeuron(unsigned int column) const
+    {
+        assert(column < getNumColumns());
+        const auto &header = getHeader();
+        if(header.columnsOffset == 0) {
+            return column % header.popSize;
+        }
+        else {
+            return reinterpret_cast<const uint32_t*>(m_Data + header.columnsOffset)[column];
+        }
+    }
+
+    //! Get ids of neurons which spiked in the ith timestep of a spike recording
+    SpikeRange getSpikes(uint64_t i) const
+    {
+        assert(i < getNumTimesteps());
+        if(getEncoding() == Encoding::SpikeList) {
+            const uint64_t *index = getSpikeListIndex();
+            return SpikeRange(SpikeIterator(getSpikeListData() + index[i]), SpikeIterator(getSpikeListData() + index[i + 1]));
+        }
+        else if(getEncoding() == Encoding::SpikeBitmask) {
+            const uint32_t *words = getData<uint32_t>() + (i * getNumColumns());
+            return SpikeRange(SpikeIterator(words, 0, getNumColumns()), SpikeIterator(words, getNumColumns(), getNumColumns()));
+        }
+        else {
+            throw std::runtime_error("Spikes can only be read from spike recordings");
+        }
+    }
+
+    //! Does neuron spike in ith timestep of a spike recording
+    /*! **NOTE** this requires a linear search for Encoding::SpikeList recordings */
+    bool isSpike(uint64_t i, unsigned int neuron) const
+    {
+        if(getEncoding() == Encoding::SpikeBitmask) {
+            const uint32_t word = getData<uint32_t>()[(i * getNumColumns()) + (neuron / 32)];
+            return (word & (1u << (neuron % 32))) != 0;
+        }
+        else {
+            const auto spikes = getSpikes(i);
+            return std::find(spikes.begin(), spikes.end(), neuron) != spikes.end();
+        }
+    }
+
+    //! Get values of all columns in ith timestep of an analogue recording
+    template<typename T>
+    Range<const T*> getValues(uint64_t i) const
+    {
+        assert(i < getNumTimesteps());
+        const T *begin = getData<T>() + (i * getNumColumns());
+        return Range<const T*>(begin, begin + getNumColumns());
+    }
+
+    //! Get values of one column in every timestep of an analogue recording
+    template<typename T>
+    Range<StridedIterator<T>> getColumnValues(unsigned int column) const
+    {
+        assert(column < getNumColumns());
+        const T *begin = getData<T>() + column;
+        return Range<StridedIterator<T>>(StridedIterator<T>(begin, getNumColumns()),
+                                         StridedIterator<T>(begin + (getNumTimesteps() * getNumColumns()), getNumColumns()));
+    }
+
+    //! Get pointer to start of data section
+    template<typename T>
+    const T *getData() const
+    {
+        // Check type matches encoding
+        const Encoding encoding = getEncoding();
+        if((std::is_same<T, uint32_t>::value && (encoding == Encoding::SpikeBitmask || encoding == Encoding::SpikeList))
+           || (std::is_same<T, float>::value && encoding == Encoding::AnalogueFloat)
+           || (std::is_same<T, double>::value && encoding == Encoding::AnalogueDouble))
+        {
+            return reinterpret_cast<const T*>(m_Data + getHeader().dataOffset);
+        }
+        else {
+            throw std::runtime_error("Type does not match binary recording encoding");
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    const uint32_t *getSpikeListData() const{ return reinterpret_cast<const uint32_t*>(m_Data + getHeader().dataOffset); }
+    const uint64_t *getSpikeListIndex() const{ return reinterpret_cast<const uint64_t*>(m_Data + getHeader().indexOffset); }
+
+    void unmap()
+    {
+#ifdef _WIN32
+        if(m_Data != nullptr) {
+            UnmapViewOfFile(m_Data);
+        }
+        if(m_Mapping != nullptr) {
+            CloseHandle(m_Mapping);
+        }
+        CloseHandle(m_File);
+#else
+        if(m_Data != nullptr) {
+            munmap(const_cast<char*>(m_Data), m_Size);
+        }
+        ::close(m_File);
+#endif
+        m_Data = nullptr;
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+#ifdef _WIN32
+    HANDLE m_File;
+    HANDLE m_Mapping;
+#else
+    int m_File;
+#endif
+    const char *m_Data;
+    size_t m_Size;
+};
+}   // namespace BinaryRecording
@@ -34,7 +34,7 @@ public:
     SharedLibraryModel()
     :   m_Library(nullptr), m_AllocateMem(nullptr), m_AllocateRecordingBuffers(nullptr),
         m_FreeMem(nullptr), m_Initialize(nullptr), m_InitializeSparse(nullptr), 
-        m_StepTime(nullptr), m_PullRecordingBuffersFromDevice(nullptr)
+        m_StepTime(nullptr), m_StepTimeN(nullptr), m_PullRecordingBuffersFromDevice(nullptr)
     {
     }
 
@@ -86,6 +86,7 @@ public:
             m_InitializeSparse = (VoidFunction)getSymbol("initializeSparse");
 
             m_StepTime = (VoidFunction)getSymbol("stepTime");
+            m_StepTimeN = (StepTimeNFunction)getSymbol("stepTimeN", true);
             m_PullRecordingBuffersFromDevice = (VoidFunction)getSymbol("pullRecordingBuffersFromDevice", true);
             
             m_T = (scalar*)getSymbol("t");
@@ -381,6 +382,24 @@ public:
     {
         m_StepTime();
     }
+
+    //! Advance simulation by n timesteps inside the shared library,
+    //! calling callback with the current timestep every interval timesteps
+    void run(unsigned long long n, void (*callback)(unsigned long long) = nullptr, unsigned long long interval = 0)
+    {
+        // If model was generated by an older version of GeNN without stepTimeN, step from here
+        if(m_StepTimeN == nullptr) {
+            for(unsigned long long i = 1; i <= n; i++) {
+                m_StepTime();
+                if(callback != nullptr && interval != 0 && (i % interval) == 0) {
+                    callback(*m_Timestep);
+                }
+            }
+        }
+        else {
+            m_StepTimeN(n, callback, interval);
+        }
+    }
     
     void pullRecordingBuffersFromDevice()
     {
@@ -416,6 +435,15 @@ public:
     double getPostsynapticUpdateTime() const{ return *(double*)getSymbol("postsynapticUpdateTime"); }
     double getSynapseDynamicsTime() const{ return *(double*)getSymbol("synapseDynamicsTime"); }
     double getInitSparseTime() const{ return *(double*)getSymbol("initSparseTime"); }
+
+    // Per-group timing - only available if model was built with the enableGroupTiming preference
+    double getNeuronUpdateTime(const std::string &popName) const{ return ((GroupTimeFunction)getSymbol("get" + popName + "NeuronUpdateTime"))(); }
+    double getInitTime(const std::string &popName) const{ return ((GroupTimeFunction)getSymbol("get" + popName + "InitTime"))(); }
+    double getPresynapticUpdateTime(const std::string &popName) const{ return ((GroupTimeFunction)getSymbol("get" + popName + "PresynapticUpdateTime"))(); }
+    double getPostsynapticUpdateTime(const std::string &popName) const{ return ((GroupTimeFunction)getSymbol("get" + popName + "PostsynapticUpdateTime"))(); }
+    double getSynapseDynamicsTime(const std::string &popName) const{ return ((GroupTimeFunction)getSymbol("get" + popName + "SynapseDynamicsTime"))(); }
+    unsigned long long getNumPresynapticEvents(const std::string &popName) const{ return ((GroupCountFunction)getSymbol("get" + popName + "NumPresynapticEvents"))(); }
+    unsigned long long getNumSynapticEvents(const std::string &popName) const{ return ((GroupCountFunction)getSymbol("get" + popName + "NumSynapticEvents"))(); }
     
     void *getSymbol(const std::string &symbolName, bool allowMissing = false, void *defaultSymbol = nullptr) const
     {
@@ -451,6 +479,9 @@ private:
     typedef void (*PullFunction)(void);
     typedef void (*EGPFunction)(unsigned int);
     typedef size_t (*GetFreeMemFunction)(void);
+    typedef double (*GroupTimeFunction)(void);
+    typedef unsigned long long (*GroupCountFunction)(void);
+    typedef void (*StepTimeNFunction)(unsigned long long, void (*)(unsigned long long), unsigned long long);
 
     typedef std::pair<PushFunction, PullFunction> PushPullFunc;
     typedef std::tuple<EGPFunction, VoidFunction, EGPFunction, EGPFunction> EGPFunc;
@@ -521,6 +552,7 @@ private:
     VoidFunction m_Initialize;
     VoidFunction m_InitializeSparse;
     VoidFunction m_StepTime;
+    StepTimeNFunction m_StepTimeN;
     PullFunction m_PullRecordingBuffersFromDevice;
 
     std::unordered_map<std::string, PushPullFunc> m_PopulationVars;
@@ -2,17 +2,25 @@
 
 // Standard C++ includes
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
 // Standard C includes
 #include <cassert>
+#include <cmath>
 #include <cstdint>
 
+// GeNN userproject includes
+#include "binaryRecording.h"
+
 #ifdef _WIN32
 #include <intrin.h>
 #endif
@@ -142,6 +150,194 @@ private:
     std::list<std::pair<double, std::vector<unsigned int>>> m_Cache;
 };
 
+//----------------------------------------------------------------------------
+// SpikeWriterAsync
+//----------------------------------------------------------------------------
+//! Class to write spikes to text file from a background thread
+/*! Each timestep's spikes are copied into one of a fixed number of reusable buffers which are passed to the
+    writer thread through a bounded, lock-free single-producer, single-consumer queue. If the writer thread
+    falls behind and all buffers are in use, recording blocks until one becomes free and this is counted. */
+class SpikeWriterAsync
+{
+public:
+    SpikeWriterAsync(const std::string &filename, const std::string &delimiter = " ", bool header = false,
+                     size_t numBuffers = 256)
+    :   m_State(new State(filename, delimiter, numBuffers))
+    {
+        // Set precision
+        m_State->stream.precision(16);
+
+        if(header) {
+            m_State->stream << "Time [ms], Neuron ID" << std::endl;
+        }
+
+        // Start writer thread
+        State *state = m_State.get();
+        m_Thread = std::thread([state](){ writeThread(*state); });
+    }
+
+    SpikeWriterAsync(SpikeWriterAsync&& other) = default;
+
+    ~SpikeWriterAsync()
+    {
+        // If this writer hasn't been moved from, signal writer thread to write any remaining spikes and exit
+        if(m_Thread.joinable()) {
+            m_State->stop.store(true, std::memory_order_release);
+            m_Thread.join();
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! How many times has recording had to wait for the writer thread to free a buffer
+    unsigned long long getNumStalls() const{ return m_State->numStalls; }
+
+    //! Total time in seconds recording has spent waiting for the writer thread
+    double getStallTime() const{ return m_State->stallTime; }
+
+    //! Maximum number of timesteps which have been queued for writing at once
+    size_t getMaxQueueLength() const{ return m_State->maxQueueLength; }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected API
+    //----------------------------------------------------------------------------
+    void recordSpikes(double t, unsigned int spikeCount, const unsigned int *currentSpikes)
+    {
+        State &state = *m_State;
+        const size_t numBuffers = state.buffers.size();
+
+        // If queue is full, wait for writer thread to free a buffer
+        const size_t tail = state.tail.load(std::memory_order_relaxed);
+        if((tail - state.head.load(std::memory_order_acquire)) == numBuffers) {
+            const auto stallStart = std::chrono::high_resolution_clock::now();
+            do {
+                std::this_thread::yield();
+            } while((tail - state.head.load(std::memory_order_acquire)) == numBuffers);
+
+            state.numStalls++;
+            state.stallTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - stallStart).count();
+        }
+
+        // Copy spikes into next buffer
+        // **NOTE** buffers keep their capacity so, once they have grown, no more allocation is required
+        auto &buffer = state.buffers[tail % numBuffers];
+        buffer.first = t;
+        buffer.second.assign(currentSpikes, currentSpikes + spikeCount);
+
+        // Publish buffer to writer thread
+        state.tail.store(tail + 1, std::memory_order_release);
+        state.maxQueueLength = std::max(state.maxQueueLength, tail + 1 - state.head.load(std::memory_order_relaxed));
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // State
+    //----------------------------------------------------------------------------
+    //! State shared with writer thread - heap-allocated so SpikeWriterAsync can be moved while thread is running
+    struct State
+    {
+        State(const std::string &filename, const std::string &d, size_t numBuffers)
+        :   stream(filename), delimiter(d), buffers(numBuffers), head(0), tail(0), stop(false),
+            numStalls(0), stallTime(0.0), maxQueueLength(0)
+        {
+            assert(numBuffers > 0);
+        }
+
+        std::ofstream stream;
+        const std::string delimiter;
+        std::vector<std::pair<double, std::vector<unsigned int>>> buffers;
+
+        //! Number of buffers written by writer thread
+        std::atomic<size_t> head;
+
+        //! Number of buffers filled by simulation thread
+        std::atomic<size_t> tail;
+
+        std::atomic<bool> stop;
+
+        // Back-pressure statistics - only accessed by simulation thread
+        unsigned long long numStalls;
+        double stallTime;
+        size_t maxQueueLength;
+    };
+
+    //----------------------------------------------------------------------------
+    // Static methods
+    //----------------------------------------------------------------------------
+    static void writeThread(State &state)
+    {
+        const size_t numBuffers = state.buffers.size();
+        while(true) {
+            const size_t head = state.head.load(std::memory_order_relaxed);
+
+            // If queue is empty
+            if(head == state.tail.load(std::memory_order_acquire)) {
+                // If we've been told to stop and, having observed this, queue is still empty, stop
+                if(state.stop.load(std::memory_order_acquire)) {
+                    if(head == state.tail.load(std::memory_order_acquire)) {
+                        break;
+                    }
+                }
+                // Otherwise, sleep briefly before checking again
+                else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                continue;
+            }
+
+            // Write spikes in buffer and free it
+            const auto &buffer = state.buffers[head % numBuffers];
+            for(unsigned int spike : buffer.second) {
+                state.stream << buffer.first << state.delimiter << spike << "\n";
+            }
+            state.head.store(head + 1, std::memory_order_release);
+        }
+
+        state.stream.flush();
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::unique_ptr<State> m_State;
+    std::thread m_Thread;
+};
+
+//----------------------------------------------------------------------------
+// SpikeWriterBinary
+//----------------------------------------------------------------------------
+//! Class to write spikes to a memory-mappable binary recording file (see BinaryRecording)
+class SpikeWriterBinary
+{
+public:
+    SpikeWriterBinary(const std::string &filename, const std::string &name, unsigned int popSize, double dt,
+                      uint64_t startTimestep = 0)
+    :   m_Writer(new BinaryRecording::Writer(filename, name, BinaryRecording::Encoding::SpikeList, popSize, dt, startTimestep)),
+        m_DT(dt)
+    {
+    }
+
+    SpikeWriterBinary(SpikeWriterBinary&& other) = default;
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected API
+    //----------------------------------------------------------------------------
+    void recordSpikes(double t, unsigned int spikeCount, const unsigned int *currentSpikes)
+    {
+        m_Writer->writeSpikes((uint64_t)std::llround(t / m_DT), spikeCount, currentSpikes);
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::unique_ptr<BinaryRecording::Writer> m_Writer;
+    double m_DT;
+};
+
 //----------------------------------------------------------------------------
 // SpikeRecorderBase
 //----------------------------------------------------------------------------
@@ -202,6 +398,22 @@ inline void writeBinarySpikeRecording(const std::string &filename, const uint32_
 }
 
 
+//! Writes spikes recorded using GeNN's spike timing sytem to a memory-mappable binary recording file (see BinaryRecording)
+/*! \param filename string containing filename to write to.
+    \param name name of population being recorded
+    \param spkRecord pointer to spike recording data to write (accessable via ``recordSpk<neuron group name>`` or ``recordSpkEvent<neuron group name>``).
+    \param popSize number of neurons in population
+    \param numTimesteps how many timesteps were recorded (should match the value passed to ``allocateRecordingBuffers``).
+    \param dt double precision number specifying size of each timestep
+    \param startTimestep index of first timestep recorded. */
+inline void writeBinaryRecordingSpikeRecording(const std::string &filename, const std::string &name, const uint32_t *spkRecord,
+                                               unsigned int popSize, unsigned int numTimesteps, double dt, uint64_t startTimestep = 0)
+{
+    BinaryRecording::Writer writer(filename, name, BinaryRecording::Encoding::SpikeBitmask, popSize, dt, startTimestep);
+    writer.writeSpikeBitmask(spkRecord, numTimesteps);
+}
+
+
 inline int _clz(unsigned int value)
 {
 #ifdef _WIN32